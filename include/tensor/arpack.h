@@ -20,6 +20,7 @@
 #ifndef TENSOR_ARPACK_H
 #define TENSOR_ARPACK_H
 
+#include <string>
 #include <tensor/arpack_d.h>
 #include <tensor/arpack_z.h>
 
@@ -28,16 +29,73 @@ namespace linalg {
   template<class Tensor> class Arpack;
   template<> class Arpack<RTensor> : public RArpack {
   public:
-    Arpack(size_t n, enum EigType t, size_t neig) :
-      RArpack(n, t, neig) {}
+    Arpack(size_t n, enum EigType t, size_t neig, size_t ncv = 0) :
+      RArpack(n, t, neig, ncv) {}
   };
 
   template<> class Arpack<CTensor> : public CArpack {
   public:
-    Arpack(size_t n, enum EigType t, size_t neig) :
-      CArpack(n, t, neig) {}
+    Arpack(size_t n, enum EigType t, size_t neig, size_t ncv = 0) :
+      CArpack(n, t, neig, ncv) {}
   };
 
+  /**Solver of eigs() problems of a fixed size, that keeps the ARPACK
+     workspaces between calls to solve(). Unless disabled with
+     set_warm_start(), each solution starts from the Ritz vectors found by
+     the previous one, which is much faster when solving a sequence of
+     slowly changing problems.*/
+  template<class Tensor>
+  class EigsSolver {
+  public:
+    typedef typename Tensor::elt_t elt_t;
+    /**Solver for 'neig' eigenvalues of type 'eig_type' of n x n matrices,
+       with a Krylov basis of 'ncv' vectors (0 for the default of eigs()).*/
+    EigsSolver(size_t n, int eig_type, size_t neig, size_t ncv = 0);
+    ~EigsSolver();
+    /**Change the size of the Krylov basis, reallocating the workspaces.*/
+    void set_ncv(size_t ncv);
+    /**Relative accuracy of the eigenvalues (0 for machine precision).*/
+    void set_tolerance(double tol);
+    /**Maximum number of Arnoldi restarts (0 for the default of eigs()).*/
+    void set_maxiter(size_t maxiter);
+    void set_warm_start(bool warm) { warm_ = warm; }
+    /**Save the state of solve() to 'filename' every 'matvecs' products.
+       A later solve(), possibly by another process, resumes from that file
+       if it exists, and deletes it once the eigenvalues converge.*/
+    void set_checkpoint(const std::string &filename, size_t matvecs);
+    size_t ncv() const { return ncv_; }
+    double tolerance() const { return tol_; }
+    size_t maxiter() const { return maxit_; }
+    /**Number of applications of the matrix in the last call to solve().*/
+    size_t matvecs() const { return matvecs_; }
+
+    /**Eigenvalues and eigenvectors of A, as eigs(A, eig_type, neig,
+       vectors, converged). A 'vectors' argument with at least 'n' elements
+       is used as start vector, instead of the previous solution.*/
+    const Tensor solve(const Tensor &A, Tensor *vectors = NULL,
+                       bool *converged = NULL);
+    const Tensor solve(const tensor::Sparse<elt_t> &A, Tensor *vectors = NULL,
+                       bool *converged = NULL);
+    const Tensor solve(const Map<Tensor> &A, Tensor *vectors = NULL,
+                       bool *converged = NULL);
+  private:
+    EigsSolver(const EigsSolver &);
+    const EigsSolver &operator=(const EigsSolver &);
+
+    tensor::index n_, neig_;
+    size_t ncv_, maxit_, matvecs_;
+    int eig_type_;
+    double tol_;
+    bool warm_;
+    Arpack<Tensor> *arpack_;
+    Tensor previous_;
+    std::string checkpoint_;
+    size_t checkpoint_every_;
+  };
+
+  extern template class EigsSolver<RTensor>;
+  extern template class EigsSolver<CTensor>;
+
 } // namespace linalg
 
 #endif // TENSOR_ARPACK_H
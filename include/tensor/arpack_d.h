@@ -23,6 +23,11 @@
 #include <tensor/tensor_blas.h>
 #include <tensor/linalg.h>
 
+namespace sdf {
+  class OutDataFile;
+  class InDataFile;
+}
+
 namespace linalg {
 
 /*!\addtogroup Linalg */
@@ -44,8 +49,9 @@ class RArpack {
 	NoConvergence = 6,
     };
 
-    RArpack(size_t n, enum EigType t, size_t neig);
+    RArpack(size_t n, enum EigType t, size_t neig, size_t ncv = 0);
     ~RArpack();
+    void restart();
     void set_random_start_vector();
     void set_start_vector(const elt_t *v);
     void set_tolerance(double tol);
@@ -61,6 +67,20 @@ class RArpack {
     std::string error_message() { return std::string(error); };
     enum Status get_status() { return status; };
     size_t get_vector_size() { return n; };
+    size_t get_ncv() { return ncv; };
+    size_t get_maxiter() { return maxit; };
+    double get_tolerance() { return tol; };
+
+    /**Write the complete state of this eigenvalue problem, including that
+       of the Fortran routines, which is shared by all objects and belongs
+       to the last one that called update(). When saved while running, the
+       product for get_x() has to be in get_y() already.*/
+    void save_checkpoint(sdf::OutDataFile &file) const;
+    /**Continue a problem saved with save_checkpoint(), possibly in another
+       process: the next update() takes over where the saved one stopped.
+       The object must have the same size, number and type of eigenvalues
+       and number of Arnoldi vectors, and not be running.*/
+    void load_checkpoint(sdf::InDataFile &file);
 
     void prepare();
     void clear();
@@ -61,21 +61,6 @@ namespace tensor {
     std::fill(row_start_.begin(), row_start_.end(), 0);
   }
 
-  template<typename elt_t>
-  struct sparse_triplet {
-    index row, col;
-    elt_t value;
-    sparse_triplet() {};
-    sparse_triplet(index r, index c, elt_t v) : row(r), col(c), value(v) {}
-    bool operator<(const sparse_triplet &other) const {
-      if (row < other.row)
-        return 1;
-      if (row == other.row)
-        return col < other.col;
-      return 0;
-    }
-  };
-
   template<typename elt_t>
   Sparse<elt_t>::Sparse(const Indices &dims, const Indices &row_start,
                         const Indices &column, const Tensor<elt_t> &data) :
@@ -89,51 +74,20 @@ namespace tensor {
                         index nrows, index ncols) :
     dims_(2), row_start_(), column_(), data_()
   {
-    index i, j, last_row, last_col, l = rows.size();
+    index i, l = rows.size();
     assert(cols.size() == l);
     assert(data.size() == l);
 
-    /* Organize data in sparse_triplets (row,column,value), sorted in the
-     * same order in which we store data in Sparse
-     */
-    std::vector<sparse_triplet<elt_t> > sorted_data;
-    sorted_data.reserve(l);
     for (i = 0; i < l; i++) {
-      index r = rows[i];
-      index c = cols[i];
-      nrows = std::max(nrows, r);
-      ncols = std::max(ncols, c);
-      if (data[i] != number_zero<elt_t>()) {
-        sorted_data.push_back(sparse_triplet<elt_t>(r, c, data[i]));
-      }
+      nrows = std::max(nrows, rows[i]+1);
+      ncols = std::max(ncols, cols[i]+1);
     }
-    std::sort(sorted_data.begin(), sorted_data.end());
-    dims_.at(0) = nrows;
-    dims_.at(1) = ncols;
-    row_start_ = Indices(nrows+1);
-    column_ = Indices(l = sorted_data.size());
-    data_ = Tensor<elt_t>(l);
-
-    /* Fill in the Sparse structure.
-     */
-    std::fill(row_start_.begin(), row_start_.end(), 0);
-    for (last_col = 0, last_row = -1, j = i = 0; i < l; i++) {
-      const sparse_triplet<elt_t> &d = sorted_data[i];
-      if (d.row == last_row) {
-        if (d.col == last_col)
-          continue;
-      } else {
-        while(last_row < d.row) {
-          row_start_.at(++last_row) = j;
-        }
-      }
-      column_.at(j) = d.col;
-      data_.at(j) = d.value;
-      j++;
-    }
-    while (last_row < nrows) {
-      row_start_.at(++last_row) = j;
+    SparseBuilder<elt_t> builder(nrows, ncols);
+    builder.reserve(l);
+    for (i = 0; i < l; i++) {
+      builder.add(rows[i], cols[i], data[i]);
     }
+    *this = builder.build();
   }
 
   template<typename elt_t>
@@ -157,47 +111,81 @@ namespace tensor {
   // CONSTRUCTOR FROM FULL TENSOR TO SPARSE AND VICEVERSA
   //
 
+  /* Elements with an absolute value below or equal to 'tol' are not stored.
+   * The negated comparison keeps NaNs, just like a test for zero would. */
   template<typename elt_t>
-  static index
-  number_of_nonzero(const Tensor<elt_t> &data)
+  static inline bool
+  sparse_keep(elt_t v, double tol)
   {
-    index counter = 0;
-    for (typename Tensor<elt_t>::const_iterator it = data.begin();
-         it != data.end();
-         it++)
-    {
-      if (!(*it == number_zero<elt_t>())) counter++;
-    }
-    return counter;
+    return !(abs(v) <= tol);
   }
 
+  /* Dense matrices with more elements than this are converted in parallel. */
+  static const index SPARSE_PARALLEL_SIZE = 1 << 16;
+  /* Number of rows that each task scans in the dense to sparse conversion. */
+  static const index SPARSE_ROW_BLOCK = 256;
+
   template<typename elt_t>
-  Sparse<elt_t>::Sparse(const Tensor<elt_t> &t) :
+  Sparse<elt_t>::Sparse(const Tensor<elt_t> &t, double tol) :
     dims_(t.dimensions()), row_start_(t.rows()+1),
     column_(), data_()
   {
-    index nonzero = number_of_nonzero<elt_t>(t);
-    column_ = Indices(nonzero);
-    data_ = Tensor<elt_t>(nonzero);
-
     index nrows = rows();
     index ncols = columns();
-
-    Indices::iterator row_it = row_start_.begin();
-    Indices::iterator col_it = column_.begin();
-    Indices::iterator col_begin = col_it;
-    typename Tensor<elt_t>::iterator data_it = data_.begin();
-
-    *(row_it++) = 0;
+    index nblocks = (nrows + SPARSE_ROW_BLOCK - 1) / SPARSE_ROW_BLOCK;
+    bool parallel = (nrows * ncols > SPARSE_PARALLEL_SIZE);
+    const elt_t *p = t.begin();
+    index *start = row_start_.begin();
+    std::fill(start, start + nrows + 1, 0);
+
+    /* The tensor is stored in column-major order. Each task owns a block of
+     * rows and scans the matrix column by column, so that it always reads
+     * contiguous pieces of memory. We first count the elements in each row,
+     * shifted by one, so that the prefix sum gives where each row starts. */
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if(parallel)
+#endif
+    for (index b = 0; b < nblocks; b++) {
+      index r0 = b * SPARSE_ROW_BLOCK;
+      index r1 = std::min(r0 + SPARSE_ROW_BLOCK, nrows);
+      for (index c = 0; c < ncols; c++) {
+        const elt_t *column = p + c * nrows;
+        for (index r = r0; r < r1; r++) {
+          if (sparse_keep(column[r], tol)) start[r+1]++;
+        }
+      }
+    }
     for (index r = 0; r < nrows; r++) {
+      start[r+1] += start[r];
+    }
+
+    index nonzero = start[nrows];
+    column_ = Indices(nonzero);
+    data_ = Tensor<elt_t>(nonzero);
+    index *out_column = column_.begin();
+    elt_t *out_data = data_.begin();
+
+    /* Second pass: scatter the elements. Columns are visited in increasing
+     * order, hence each row ends up sorted. */
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if(parallel)
+#endif
+    for (index b = 0; b < nblocks; b++) {
+      index r0 = b * SPARSE_ROW_BLOCK;
+      index r1 = std::min(r0 + SPARSE_ROW_BLOCK, nrows);
+      index next[SPARSE_ROW_BLOCK];
+      std::copy(start + r0, start + r1, next);
       for (index c = 0; c < ncols; c++) {
-        elt_t v = t(r,c);
-        if (!(v == number_zero<elt_t>())) {
-          *(data_it++) = v;
-          *(col_it++) = c;
+        const elt_t *column = p + c * nrows;
+        for (index r = r0; r < r1; r++) {
+          elt_t v = column[r];
+          if (sparse_keep(v, tol)) {
+            index k = next[r - r0]++;
+            out_column[k] = c;
+            out_data[k] = v;
+          }
         }
       }
-      *(row_it++) = col_it - col_begin;
     }
   }
 
@@ -277,17 +265,8 @@ namespace tensor {
   {
     row = normalize_index(row, rows());
     col = normalize_index(col, columns());
-    for (index ndx1 = row_start_[row], ndx2 = row_start_[row+1];
-         ndx1 < ndx2; ndx1++)
-    {
-      index this_col = column_[ndx1];
-      if (this_col == col) {
-        return data_[ndx1];
-      } else if (this_col > col) {
-        break;
-      }
-    }
-    return number_zero<elt_t>();
+    index k = sparse_find(row_start_.begin(), column_.begin(), row, col);
+    return (k < 0)? number_zero<elt_t>() : data_[k];
   }
 
 } // namespace tensor
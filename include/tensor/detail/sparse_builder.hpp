@@ -0,0 +1,156 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#if !defined(TENSOR_SPARSE_H) || defined(TENSOR_DETAIL_SPARSE_BUILDER_HPP)
+#error "This header cannot be included manually"
+#else
+#define TENSOR_DETAIL_SPARSE_BUILDER_HPP
+
+#include <cassert>
+#include <algorithm>
+#include <tensor/detail/common.h>
+
+namespace tensor {
+
+  template<typename elt_t>
+  SparseBuilder<elt_t>::SparseBuilder(index rows, index cols, int nbuffers) :
+    rows_(rows), cols_(cols), buffers_(std::max(nbuffers, 1))
+  {
+    assert(rows >= 0 && cols >= 0);
+  }
+
+  template<typename elt_t>
+  void SparseBuilder<elt_t>::reserve(index nonzero, int buffer)
+  {
+    buffer_t &b = buffers_[buffer];
+    b.row.reserve(nonzero);
+    b.col.reserve(nonzero);
+    b.value.reserve(nonzero);
+  }
+
+  template<typename elt_t>
+  void SparseBuilder<elt_t>::clear()
+  {
+    for (size_t i = 0; i < buffers_.size(); i++) {
+      buffer_t &b = buffers_[i];
+      std::vector<index>().swap(b.row);
+      std::vector<index>().swap(b.col);
+      std::vector<elt_t>().swap(b.value);
+    }
+  }
+
+  template<typename elt_t>
+  index SparseBuilder<elt_t>::length() const
+  {
+    index l = 0;
+    for (size_t i = 0; i < buffers_.size(); i++)
+      l += buffers_[i].row.size();
+    return l;
+  }
+
+  struct sparse_column_order {
+    const index *column;
+    sparse_column_order(const index *c) : column(c) {}
+    bool operator()(index a, index b) const { return column[a] < column[b]; }
+  };
+
+  template<typename elt_t>
+  const Sparse<elt_t> SparseBuilder<elt_t>::build() const
+  {
+    index nrows = rows_, l = length();
+    Indices row_start(nrows+1);
+    Indices column(l);
+    Tensor<elt_t> data(l);
+
+    /* First pass: count the elements in each row and compute where each
+     * row starts. Rows are shifted by one, so that row_start[r+1] ends up
+     * being the insertion point for row 'r' in the second pass. */
+    std::fill(row_start.begin(), row_start.end(), 0);
+    index *start = row_start.begin();
+    for (size_t i = 0; i < buffers_.size(); i++) {
+      const std::vector<index> &row = buffers_[i].row;
+      for (size_t j = 0; j < row.size(); j++)
+        start[row[j]+1]++;
+    }
+    for (index r = 1; r <= nrows; r++)
+      start[r] += start[r-1];
+
+    /* Second pass: scatter the elements into their rows. */
+    {
+      Indices next(nrows);
+      std::copy(start, start + nrows, next.begin());
+      index *c = column.begin();
+      elt_t *d = data.begin();
+      for (size_t i = 0; i < buffers_.size(); i++) {
+        const buffer_t &b = buffers_[i];
+        for (size_t j = 0; j < b.row.size(); j++) {
+          index k = next.at(b.row[j])++;
+          c[k] = b.col[j];
+          d[k] = b.value[j];
+        }
+      }
+    }
+
+    /* Sort each row by column and accumulate repeated columns. Zeros that
+     * result from the sums are dropped, as in Matlab. Since the output never
+     * grows past the input, we compact the arrays in place. */
+    index *c = column.begin();
+    elt_t *d = data.begin();
+    std::vector<index> order, out_column;
+    std::vector<elt_t> out_data;
+    index k = 0;
+    for (index r = 0; r < nrows; r++) {
+      index begin = start[r], n = start[r+1] - begin;
+      order.resize(n);
+      for (index j = 0; j < n; j++)
+        order[j] = begin + j;
+      std::sort(order.begin(), order.end(), sparse_column_order(c));
+      out_column.clear();
+      out_data.clear();
+      for (index j = 0; j < n; ) {
+        index col = c[order[j]];
+        elt_t v = d[order[j]];
+        while (++j < n && c[order[j]] == col)
+          v += d[order[j]];
+        if (!(v == number_zero<elt_t>())) {
+          out_column.push_back(col);
+          out_data.push_back(v);
+        }
+      }
+      start[r] = k;
+      std::copy(out_column.begin(), out_column.end(), c + k);
+      std::copy(out_data.begin(), out_data.end(), d + k);
+      k += out_column.size();
+    }
+    start[nrows] = k;
+
+    if (k < l) {
+      Indices new_column(k);
+      Tensor<elt_t> new_data(k);
+      std::copy(c, c + k, new_column.begin());
+      std::copy(d, d + k, new_data.begin());
+      column = new_column;
+      data = new_data;
+    }
+    return Sparse<elt_t>(igen << nrows << cols_, row_start, column, data);
+  }
+
+} // namespace tensor
+
+#endif // !TENSOR_DETAIL_SPARSE_BUILDER_HPP
@@ -0,0 +1,163 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#if !defined(TENSOR_SPARSE_H) || defined(TENSOR_DETAIL_SPARSE_SLICE_HPP)
+#error "This header cannot be included manually"
+#else
+#define TENSOR_DETAIL_SPARSE_SLICE_HPP
+
+#include <cassert>
+#include <algorithm>
+#include <vector>
+#include <tensor/detail/common.h>
+
+namespace tensor {
+
+  //////////////////////////////////////////////////////////////////////
+  // SUBMATRICES
+  //
+
+  /* Extract the rows 'rows' (all of them if NULL) and the columns 'cols' of
+   * a sparse matrix. The cost is proportional to the number of elements in
+   * the selected rows plus the number of columns of 's'. */
+  template<typename elt_t>
+  static Sparse<elt_t>
+  do_sparse_submatrix(const Sparse<elt_t> &s, const Indices *rows,
+                      const Indices &cols)
+  {
+    index n = s.columns();
+    index nrows = rows? rows->size() : s.rows();
+    index ncols = cols.size();
+    const index *row_start = s.priv_row_start().begin();
+    const index *column = s.priv_column().begin();
+    const elt_t *data = s.priv_data().begin();
+
+    /* For each column of 's', the positions at which it appears in 'cols',
+     * as a linked list: first[c], next[first[c]], ... */
+    Indices first(n), next(ncols);
+    std::fill(first.begin(), first.end(), -1);
+    bool sorted = true;
+    for (index j = ncols; j--; ) {
+      index c = normalize_index(cols[j], n);
+      next.at(j) = first[c];
+      first.at(c) = j;
+      if (next[j] >= 0) sorted = false;
+    }
+    for (index j = 1; sorted && j < ncols; j++) {
+      sorted = normalize_index(cols[j-1], n) < normalize_index(cols[j], n);
+    }
+
+    /* First pass: number of elements in each output row. */
+    Indices out_row_start(nrows + 1);
+    Indices source(nrows);
+    index nonzero = out_row_start.at(0) = 0;
+    for (index i = 0; i < nrows; i++) {
+      index r = source.at(i) = rows? normalize_index((*rows)[i], s.rows()) : i;
+      for (index j = row_start[r]; j < row_start[r+1]; j++) {
+        for (index p = first[column[j]]; p >= 0; p = next[p])
+          nonzero++;
+      }
+      out_row_start.at(i+1) = nonzero;
+    }
+
+    /* Second pass: copy the elements. When the columns are not selected in
+     * increasing order, each row has to be sorted again. */
+    Indices out_column(nonzero);
+    Tensor<elt_t> out_data(nonzero);
+    index *c = out_column.begin();
+    elt_t *d = out_data.begin();
+    std::vector<std::pair<index,index> > row;
+    for (index i = 0; i < nrows; i++) {
+      index r = source[i];
+      row.clear();
+      for (index j = row_start[r]; j < row_start[r+1]; j++) {
+        for (index p = first[column[j]]; p >= 0; p = next[p])
+          row.push_back(std::pair<index,index>(p, j));
+      }
+      if (!sorted)
+        std::sort(row.begin(), row.end());
+      for (size_t k = 0; k < row.size(); k++) {
+        *(c++) = row[k].first;
+        *(d++) = data[row[k].second];
+      }
+    }
+    return Sparse<elt_t>(igen << nrows << ncols, out_row_start, out_column,
+                         out_data);
+  }
+
+  template<typename elt_t>
+  Sparse<elt_t>
+  Sparse<elt_t>::submatrix(const Indices &rows, const Indices &cols) const
+  {
+    return do_sparse_submatrix(*this, &rows, cols);
+  }
+
+  template<typename elt_t>
+  Sparse<elt_t>
+  Sparse<elt_t>::permute_columns(const Indices &permutation) const
+  {
+    index n = columns();
+    bool ok = (permutation.size() == n);
+    if (ok) {
+      Booleans seen(n);
+      std::fill(seen.begin(), seen.end(), false);
+      for (index j = 0; ok && j < n; j++) {
+        index c = permutation[j];
+        ok = (c >= 0) && (c < n) && !seen[c];
+        if (ok) seen.at(c) = true;
+      }
+    }
+    if (!ok) {
+      std::cerr << "In S.permute_columns(p), p is not a permutation of the "
+                << n << " columns of S.\n";
+      abort();
+    }
+    return do_sparse_submatrix(*this, (const Indices *)0, permutation);
+  }
+
+  template<typename elt_t>
+  Sparse<elt_t>
+  Sparse<elt_t>::row_range(index first, index last) const
+  {
+    if (first < 0 || last >= rows() || first > last + 1) {
+      std::cerr << "In S.row_range(" << first << ',' << last << "), the range "
+                << "does not fit in the " << rows() << " rows of S.\n";
+      abort();
+    }
+    index nrows = last - first + 1;
+    index begin = row_start_[first];
+    index nonzero = row_start_[last+1] - begin;
+
+    Indices out_row_start(nrows + 1);
+    for (index i = 0; i <= nrows; i++) {
+      out_row_start.at(i) = row_start_[first + i] - begin;
+    }
+    Indices out_column(nonzero);
+    Tensor<elt_t> out_data(nonzero);
+    std::copy(column_.begin() + begin, column_.begin() + begin + nonzero,
+              out_column.begin());
+    std::copy(data_.begin() + begin, data_.begin() + begin + nonzero,
+              out_data.begin());
+    return Sparse<elt_t>(igen << nrows << columns(), out_row_start,
+                         out_column, out_data);
+  }
+
+} // namespace tensor
+
+#endif // !TENSOR_DETAIL_SPARSE_SLICE_HPP
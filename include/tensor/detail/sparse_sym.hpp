@@ -0,0 +1,146 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#if !defined(TENSOR_SPARSE_H) || defined(TENSOR_DETAIL_SPARSE_SYM_HPP)
+#error "This header cannot be included manually"
+#else
+#define TENSOR_DETAIL_SPARSE_SYM_HPP
+
+#include <cassert>
+#include <algorithm>
+#include <tensor/detail/common.h>
+
+namespace tensor {
+
+  //////////////////////////////////////////////////////////////////////
+  // CONSTRUCTORS
+  //
+
+  template<typename elt_t>
+  SymSparse<elt_t>::SymSparse() :
+    dims_(2), row_start_(1), column_(0), data_(0)
+  {
+    dims_.at(0) = dims_.at(1) = row_start_.at(0) = 0;
+  }
+
+  template<typename elt_t>
+  SymSparse<elt_t>::SymSparse(index n, const Indices &row_start,
+                              const Indices &column, const Tensor<elt_t> &data) :
+    dims_(igen << n << n), row_start_(row_start), column_(column), data_(data)
+  {
+    assert(row_start.size() == n+1);
+  }
+
+  template<typename elt_t>
+  SymSparse<elt_t>::SymSparse(const Sparse<elt_t> &s, double tol) :
+    dims_(s.dimensions()), row_start_(s.rows()+1), column_(), data_()
+  {
+    index n = s.rows();
+    if (n != s.columns()) {
+      std::cerr << "In SymSparse(S), the matrix S is not square but has "
+                << s.rows() << " rows and " << s.columns() << " columns.\n";
+      abort();
+    }
+    const index *row_start = s.priv_row_start().begin();
+    const index *column = s.priv_column().begin();
+    const elt_t *data = s.priv_data().begin();
+
+    /* First pass: verify that every element has a matching conjugate on the
+     * other side of the diagonal, and count the upper triangle. */
+    index nonzero = 0;
+    for (index r = 0; r < n; r++) {
+      for (index j = row_start[r]; j < row_start[r+1]; j++) {
+        index c = column[j];
+        elt_t mirror;
+        if (c == r) {
+          mirror = data[j];
+        } else {
+          index k = sparse_find(row_start, column, c, r);
+          mirror = (k < 0)? number_zero<elt_t>() : data[k];
+        }
+        if (abs(data[j] - ::tensor::conj(mirror)) > tol) {
+          std::cerr << "In SymSparse(S), the matrix S is not "
+                    << "symmetric (hermitian): elements (" << r << ',' << c
+                    << ") and (" << c << ',' << r << ") do not match.\n";
+          abort();
+        }
+        if (c >= r) nonzero++;
+      }
+    }
+
+    /* Second pass: copy the upper triangle and the diagonal. */
+    column_ = Indices(nonzero);
+    data_ = Tensor<elt_t>(nonzero);
+    index *out_column = column_.begin();
+    elt_t *out_data = data_.begin();
+    index k = row_start_.at(0) = 0;
+    for (index r = 0; r < n; r++) {
+      for (index j = row_start[r]; j < row_start[r+1]; j++) {
+        if (column[j] >= r) {
+          out_column[k] = column[j];
+          out_data[k] = data[j];
+          k++;
+        }
+      }
+      row_start_.at(r+1) = k;
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // CONVERSION TO FULL TENSOR
+  //
+
+  template<typename elt_t>
+  const Tensor<elt_t> full(const SymSparse<elt_t> &s)
+  {
+    index n = s.rows();
+    Tensor<elt_t> output = Tensor<elt_t>::zeros(n, n);
+    const index *row_start = s.priv_row_start().begin();
+    const index *column = s.priv_column().begin();
+    const elt_t *data = s.priv_data().begin();
+    for (index r = 0; r < n; r++) {
+      for (index j = row_start[r]; j < row_start[r+1]; j++) {
+        index c = column[j];
+        output.at(r, c) = data[j];
+        if (c != r) output.at(c, r) = ::tensor::conj(data[j]);
+      }
+    }
+    return output;
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // ACCESSING ELEMENTS
+  //
+
+  template<typename elt_t>
+  elt_t SymSparse<elt_t>::operator()(index row, index col) const
+  {
+    row = normalize_index(row, rows());
+    col = normalize_index(col, columns());
+    bool lower = col < row;
+    if (lower) std::swap(row, col);
+    index k = sparse_find(row_start_.begin(), column_.begin(), row, col);
+    if (k < 0)
+      return number_zero<elt_t>();
+    return lower? ::tensor::conj(data_[k]) : data_[k];
+  }
+
+} // namespace tensor
+
+#endif // !TENSOR_DETAIL_SPARSE_SYM_HPP
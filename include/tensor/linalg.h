@@ -32,14 +32,152 @@ namespace linalg {
   using tensor::CTensor;
   using tensor::RSparse;
   using tensor::CSparse;
+  using tensor::RSymSparse;
+  using tensor::CSymSparse;
   using tensor::Map;
 
   const RTensor solve(const RTensor &A, const RTensor &B);
   const CTensor solve(const CTensor &A, const CTensor &B);
 
+  /**Solve A X = B with a single precision LU factorization, refined to
+     double precision accuracy.*/
+  const RTensor solve_refined(const RTensor &A, const RTensor &B,
+                              int *iterations = 0, double *backward_error = 0);
+  const CTensor solve_refined(const CTensor &A, const CTensor &B,
+                              int *iterations = 0, double *backward_error = 0);
+
+  /**Solutions of many independent linear systems, in parallel.*/
+  std::vector<RTensor> solve_batch(const std::vector<RTensor> &A,
+                                   const std::vector<RTensor> &B);
+  std::vector<CTensor> solve_batch(const std::vector<CTensor> &A,
+                                   const std::vector<CTensor> &B);
+
   const RTensor solve_with_svd(const RTensor &A, const RTensor &B, double tol = 0.0);
   const CTensor solve_with_svd(const CTensor &A, const CTensor &B, double tol = 0.0);
 
+  /**Moore-Penrose pseudoinverse of a matrix, A^+ = V S^-1 U^+, from its
+     economic SVD. Singular values below the tolerance are discarded once,
+     when A is factored, and the truncated factors are reused to solve
+     A X = B in the least squares sense for as many right hand sides as
+     needed.*/
+  template<class Tensor>
+  class PseudoInverse {
+  public:
+    PseudoInverse();
+    explicit PseudoInverse(const Tensor &A, double tol = 0.0);
+    /**Factor A, discarding singular values below 'tol' (DBL_EPSILON if
+       'tol' is not positive).*/
+    void factor(const Tensor &A, double tol = 0.0);
+    /**Least squares solution of A X = B, where B is a vector or has one
+       column per right hand side.*/
+    const Tensor solve(const Tensor &B) const;
+    /**Same as solve(B), writing into X, whose storage is reused if it has
+       the right dimensions.*/
+    void solve(const Tensor &B, Tensor *X) const;
+    /**Number of singular values that were kept.*/
+    tensor::index rank() const { return rank_; }
+    /**All singular values of A, in decreasing order.*/
+    const RTensor &singular_values() const { return s_; }
+  private:
+    Tensor U_, VT_;
+    RTensor s_;
+    tensor::index rank_;
+  };
+
+  extern template class PseudoInverse<RTensor>;
+  extern template class PseudoInverse<CTensor>;
+
+  /**Factorization used by solve(A, B, algorithm).*/
+  enum SolveAlgorithm {
+    SOLVE_LU,       /*!<LU with partial pivoting, as solve(A, B).*/
+    SOLVE_CHOLESKY, /*!<Cholesky, for Hermitian positive definite matrices.*/
+    SOLVE_AUTO      /*!<Cholesky if A is Hermitian and positive definite, LU otherwise.*/
+  };
+  const RTensor solve(const RTensor &A, const RTensor &B, SolveAlgorithm algorithm);
+  const CTensor solve(const CTensor &A, const CTensor &B, SolveAlgorithm algorithm);
+
+  /**LU factorization with partial pivoting, P A = L U, of a square matrix.
+     The factors are computed once and reused to solve A X = B for as many
+     right hand sides as needed.*/
+  template<class Tensor>
+  class LU {
+  public:
+    typedef typename Tensor::elt_t elt_t;
+    LU();
+    /**Factor A, aborting if it is singular.*/
+    explicit LU(const Tensor &A);
+    /**Factor A, returning false if it is singular.*/
+    bool factor(const Tensor &A);
+    /**Solution of A X = B, where B is a vector or has one column per right
+       hand side.*/
+    const Tensor solve(const Tensor &B) const;
+    /**Replace B with the solution of A X = B.*/
+    void solve_in_place(Tensor &B) const;
+    /**Estimate of the reciprocal of the condition number of A in the 1-norm.*/
+    double rcond() const { return rcond_; }
+    /**Number of equations, or zero if no matrix has been factored.*/
+    tensor::index size() const {
+      return factors_.rank()? factors_.rows() : 0;
+    }
+  private:
+    Tensor factors_;
+    tensor::Indices pivots_;
+    double rcond_;
+  };
+
+  /**Cholesky factorization, A = L L^+, of a Hermitian positive definite
+     matrix, read from its lower triangle.*/
+  template<class Tensor>
+  class Cholesky {
+  public:
+    typedef typename Tensor::elt_t elt_t;
+    Cholesky();
+    /**Factor A, aborting if it is not positive definite.*/
+    explicit Cholesky(const Tensor &A);
+    /**Factor A, returning false if it is not positive definite.*/
+    bool factor(const Tensor &A);
+    const Tensor solve(const Tensor &B) const;
+    void solve_in_place(Tensor &B) const;
+    double rcond() const { return rcond_; }
+    tensor::index size() const {
+      return factors_.rank()? factors_.rows() : 0;
+    }
+  private:
+    Tensor factors_;
+    double rcond_;
+  };
+
+  /**Symmetric indefinite factorization, A = L D L^+, with Bunch-Kaufman
+     pivoting, of a real symmetric or a complex Hermitian matrix, read from
+     its lower triangle. D is block diagonal with 1x1 and 2x2 blocks.*/
+  template<class Tensor>
+  class LDLT {
+  public:
+    typedef typename Tensor::elt_t elt_t;
+    LDLT();
+    /**Factor A, aborting if it is singular.*/
+    explicit LDLT(const Tensor &A);
+    /**Factor A, returning false if it is singular.*/
+    bool factor(const Tensor &A);
+    const Tensor solve(const Tensor &B) const;
+    void solve_in_place(Tensor &B) const;
+    double rcond() const { return rcond_; }
+    tensor::index size() const {
+      return factors_.rank()? factors_.rows() : 0;
+    }
+  private:
+    Tensor factors_;
+    tensor::Indices pivots_;
+    double rcond_;
+  };
+
+  extern template class LU<RTensor>;
+  extern template class LU<CTensor>;
+  extern template class Cholesky<RTensor>;
+  extern template class Cholesky<CTensor>;
+  extern template class LDLT<RTensor>;
+  extern template class LDLT<CTensor>;
+
   const RTensor do_cgs(const Map<RTensor> *A, const RTensor &b,
                        const RTensor *x_start = 0, int maxiter = 0, double tol = 0);
   const CTensor do_cgs(const Map<CTensor> *A, const CTensor &b,
@@ -56,7 +194,7 @@ namespace linalg {
   const RTensor cgs(const RSparse &A, const RTensor &b, const RTensor *x_start = 0,
                     int maxiter = 0, double tol = 0);
   /**Solve a real linear system of equations by the conjugate gradient method.*/
-  const CTensor cgs(const RSparse &A, const CTensor &b, const CTensor *x_start = 0,
+  const CTensor cgs(const CSparse &A, const CTensor &b, const CTensor *x_start = 0,
                     int maxiter = 0, double tol = 0);
 
   /**Solve a real linear system of equations by the conjugate gradient
@@ -69,14 +207,241 @@ namespace linalg {
     return do_cgs(new tensor::FunctionMap<func,Tensor>(f), b, x_start, maxiter, tol);
   }
 
+  /**Jacobi preconditioner for the iterative solvers: it multiplies a
+     vector, or the columns of a matrix, by the inverse of the diagonal of
+     a sparse matrix.*/
+  template<typename elt_t>
+  struct JacobiPreconditioner : public Map<tensor::Tensor<elt_t> > {
+    typedef tensor::Tensor<elt_t> tensor_t;
+    JacobiPreconditioner(const tensor::Sparse<elt_t> &A);
+    virtual ~JacobiPreconditioner();
+    virtual const tensor_t operator()(const tensor_t &arg) const;
+    virtual void apply_into(const tensor_t &arg, tensor_t &output) const;
+  private:
+    tensor_t inverse_diagonal_;
+  };
+
+  /**Incomplete LU factorization without fill-in, ILU(0), of a sparse
+     matrix, used as a preconditioner. L and U share the sparsity pattern
+     of the matrix, which must contain the whole diagonal. The map solves
+     L U x = b for a vector, or for the columns of a matrix.*/
+  template<typename elt_t>
+  struct ILU0Preconditioner : public Map<tensor::Tensor<elt_t> > {
+    typedef tensor::Tensor<elt_t> tensor_t;
+    ILU0Preconditioner(const tensor::Sparse<elt_t> &A);
+    virtual ~ILU0Preconditioner();
+    virtual const tensor_t operator()(const tensor_t &arg) const;
+    virtual void apply_into(const tensor_t &arg, tensor_t &output) const;
+  private:
+    tensor::Indices row_start_, column_, diagonal_;
+    tensor_t data_;
+  };
+
+  extern template struct JacobiPreconditioner<double>;
+  extern template struct JacobiPreconditioner<tensor::cdouble>;
+  extern template struct ILU0Preconditioner<double>;
+  extern template struct ILU0Preconditioner<tensor::cdouble>;
+
+  const RTensor do_pcg(const Map<RTensor> *A, const RTensor &b,
+                       const Map<RTensor> *preconditioner, const RTensor *x_start,
+                       int maxiter, double tol, RTensor *history);
+  const CTensor do_pcg(const Map<CTensor> *A, const CTensor &b,
+                       const Map<CTensor> *preconditioner, const CTensor *x_start,
+                       int maxiter, double tol, RTensor *history);
+
+  /**Solve a Hermitian positive definite system of equations A x = b with the
+     preconditioned conjugate gradient method. 'preconditioner', when not
+     NULL, approximates the inverse of A and must also be positive definite;
+     it remains owned by the caller. The iteration starts from 'x_start', or
+     zero, and stops when the norm of the residual is below 'tol' (default
+     1e-10) times that of 'b', or after 'maxiter' iterations. 'history'
+     outputs the relative residual of the starting point and of every
+     iteration, which also tells whether the solver converged.*/
+  const RTensor pcg(const RTensor &A, const RTensor &b,
+                    const Map<RTensor> *preconditioner = 0,
+                    const RTensor *x_start = 0, int maxiter = 0, double tol = 0,
+                    RTensor *history = 0);
+  const CTensor pcg(const CTensor &A, const CTensor &b,
+                    const Map<CTensor> *preconditioner = 0,
+                    const CTensor *x_start = 0, int maxiter = 0, double tol = 0,
+                    RTensor *history = 0);
+  const RTensor pcg(const RSparse &A, const RTensor &b,
+                    const Map<RTensor> *preconditioner = 0,
+                    const RTensor *x_start = 0, int maxiter = 0, double tol = 0,
+                    RTensor *history = 0);
+  const CTensor pcg(const CSparse &A, const CTensor &b,
+                    const Map<CTensor> *preconditioner = 0,
+                    const CTensor *x_start = 0, int maxiter = 0, double tol = 0,
+                    RTensor *history = 0);
+
+  /**Preconditioned conjugate gradient method for a linear map 'f', which
+     takes a Tensor and returns a Tensor of the same class and dimensions.*/
+  template<class func, class Tensor>
+  const Tensor pcg(const func &f, const Tensor &b,
+                   const Map<Tensor> *preconditioner = 0,
+                   const Tensor *x_start = 0, int maxiter = 0, double tol = 0,
+                   RTensor *history = 0)
+  {
+    return do_pcg(new tensor::FunctionMap<func,Tensor>(f), b, preconditioner,
+                  x_start, maxiter, tol, history);
+  }
+
+  const RTensor do_bicgstab(const Map<RTensor> *A, const RTensor &b,
+                            const Map<RTensor> *preconditioner,
+                            const RTensor *x_start, int maxiter, double tol,
+                            RTensor *history);
+  const CTensor do_bicgstab(const Map<CTensor> *A, const CTensor &b,
+                            const Map<CTensor> *preconditioner,
+                            const CTensor *x_start, int maxiter, double tol,
+                            RTensor *history);
+
+  /**Solve a general system of equations A x = b with the BiCGSTAB method
+     and right preconditioning. The arguments are those of pcg(), but
+     neither A nor the preconditioner need to be Hermitian.*/
+  const RTensor bicgstab(const RTensor &A, const RTensor &b,
+                         const Map<RTensor> *preconditioner = 0,
+                         const RTensor *x_start = 0, int maxiter = 0,
+                         double tol = 0, RTensor *history = 0);
+  const CTensor bicgstab(const CTensor &A, const CTensor &b,
+                         const Map<CTensor> *preconditioner = 0,
+                         const CTensor *x_start = 0, int maxiter = 0,
+                         double tol = 0, RTensor *history = 0);
+  const RTensor bicgstab(const RSparse &A, const RTensor &b,
+                         const Map<RTensor> *preconditioner = 0,
+                         const RTensor *x_start = 0, int maxiter = 0,
+                         double tol = 0, RTensor *history = 0);
+  const CTensor bicgstab(const CSparse &A, const CTensor &b,
+                         const Map<CTensor> *preconditioner = 0,
+                         const CTensor *x_start = 0, int maxiter = 0,
+                         double tol = 0, RTensor *history = 0);
+
+  /**BiCGSTAB method for a linear map 'f'.*/
+  template<class func, class Tensor>
+  const Tensor bicgstab(const func &f, const Tensor &b,
+                        const Map<Tensor> *preconditioner = 0,
+                        const Tensor *x_start = 0, int maxiter = 0,
+                        double tol = 0, RTensor *history = 0)
+  {
+    return do_bicgstab(new tensor::FunctionMap<func,Tensor>(f), b,
+                       preconditioner, x_start, maxiter, tol, history);
+  }
+
+  const RTensor do_gmres(const Map<RTensor> *A, const RTensor &b,
+                         const Map<RTensor> *preconditioner,
+                         const RTensor *x_start, int maxiter, double tol,
+                         RTensor *history, int restart);
+  const CTensor do_gmres(const Map<CTensor> *A, const CTensor &b,
+                         const Map<CTensor> *preconditioner,
+                         const CTensor *x_start, int maxiter, double tol,
+                         RTensor *history, int restart);
+
+  /**Solve a general system of equations A x = b with the restarted
+     GMRES(m) method and right preconditioning. The arguments are those of
+     pcg(), plus the size 'restart' of the Krylov basis (default 30).
+     'maxiter' counts the iterations of all cycles.*/
+  const RTensor gmres(const RTensor &A, const RTensor &b,
+                      const Map<RTensor> *preconditioner = 0,
+                      const RTensor *x_start = 0, int maxiter = 0,
+                      double tol = 0, RTensor *history = 0, int restart = 0);
+  const CTensor gmres(const CTensor &A, const CTensor &b,
+                      const Map<CTensor> *preconditioner = 0,
+                      const CTensor *x_start = 0, int maxiter = 0,
+                      double tol = 0, RTensor *history = 0, int restart = 0);
+  const RTensor gmres(const RSparse &A, const RTensor &b,
+                      const Map<RTensor> *preconditioner = 0,
+                      const RTensor *x_start = 0, int maxiter = 0,
+                      double tol = 0, RTensor *history = 0, int restart = 0);
+  const CTensor gmres(const CSparse &A, const CTensor &b,
+                      const Map<CTensor> *preconditioner = 0,
+                      const CTensor *x_start = 0, int maxiter = 0,
+                      double tol = 0, RTensor *history = 0, int restart = 0);
+
+  /**GMRES(m) method for a linear map 'f'.*/
+  template<class func, class Tensor>
+  const Tensor gmres(const func &f, const Tensor &b,
+                     const Map<Tensor> *preconditioner = 0,
+                     const Tensor *x_start = 0, int maxiter = 0,
+                     double tol = 0, RTensor *history = 0, int restart = 0)
+  {
+    return do_gmres(new tensor::FunctionMap<func,Tensor>(f), b, preconditioner,
+                    x_start, maxiter, tol, history, restart);
+  }
+
   extern bool accurate_svd;
 
+  /**LAPACK drivers for the singular value decomposition.*/
+  enum SVDAlgorithm {
+    SVD_GESVD,  /*!<QR iteration.*/
+    SVD_GESDD,  /*!<Divide and conquer.*/
+    SVD_GESVDX  /*!<Subset of singular values (truncated svd only).*/
+  };
+  extern SVDAlgorithm svd_algorithm;
+
   #define SVD_ECONOMIC true
   RTensor svd(RTensor A, RTensor *pU = 0, RTensor *pVT = 0, bool economic = 0);
   RTensor svd(CTensor A, CTensor *pU = 0, CTensor *pVT = 0, bool economic = 0);
+  RTensor svd(RTensor A, tensor::index max_rank, double tol,
+              RTensor *pU = 0, RTensor *pVT = 0);
+  RTensor svd(CTensor A, tensor::index max_rank, double tol,
+              CTensor *pU = 0, CTensor *pVT = 0);
 
   RTensor block_svd(RTensor A, RTensor *pU = 0, RTensor *pVT = 0, bool economic = 0);
   RTensor block_svd(CTensor A, CTensor *pU = 0, CTensor *pVT = 0, bool economic = 0);
+  RTensor block_svd(const RSparse &A, RTensor *pU = 0, RTensor *pVT = 0, bool economic = 0);
+  RTensor block_svd(const CSparse &A, CTensor *pU = 0, CTensor *pVT = 0, bool economic = 0);
+
+  /**Singular value decompositions of many independent matrices, in
+     parallel.*/
+  std::vector<RTensor> svd_batch(const std::vector<RTensor> &A,
+                                 std::vector<RTensor> *pU = 0,
+                                 std::vector<RTensor> *pVT = 0,
+                                 bool economic = 0);
+  std::vector<RTensor> svd_batch(const std::vector<CTensor> &A,
+                                 std::vector<CTensor> *pU = 0,
+                                 std::vector<CTensor> *pVT = 0,
+                                 bool economic = 0);
+
+  /**Randomized SVD: the 'rank' largest singular values and vectors,
+     sampled with 'rank + oversampling' random vectors and refined with
+     'power_iters' steps of subspace iteration.*/
+  RTensor rsvd(const RTensor &A, tensor::index rank,
+               tensor::index oversampling = 10, int power_iters = 2,
+               RTensor *pU = 0, RTensor *pVT = 0);
+  RTensor rsvd(const CTensor &A, tensor::index rank,
+               tensor::index oversampling = 10, int power_iters = 2,
+               CTensor *pU = 0, CTensor *pVT = 0);
+  RTensor rsvd(const RSparse &A, tensor::index rank,
+               tensor::index oversampling = 10, int power_iters = 2,
+               RTensor *pU = 0, RTensor *pVT = 0);
+  RTensor rsvd(const CSparse &A, tensor::index rank,
+               tensor::index oversampling = 10, int power_iters = 2,
+               CTensor *pU = 0, CTensor *pVT = 0);
+  /**Randomized SVD of a 'rows' x 'columns' operator, given as maps for A
+     and its adjoint, which act on blocks of column vectors. The maps remain
+     owned by the caller.*/
+  RTensor rsvd(const Map<RTensor> *A, const Map<RTensor> *Ah,
+               tensor::index rows, tensor::index columns, tensor::index rank,
+               tensor::index oversampling = 10, int power_iters = 2,
+               RTensor *pU = 0, RTensor *pVT = 0);
+  RTensor rsvd(const Map<CTensor> *A, const Map<CTensor> *Ah,
+               tensor::index rows, tensor::index columns, tensor::index rank,
+               tensor::index oversampling = 10, int power_iters = 2,
+               CTensor *pU = 0, CTensor *pVT = 0);
+
+  /**QR decomposition, A = Q R, with Q of orthonormal columns and R upper
+     triangular.*/
+  void qr(const RTensor &A, RTensor *pQ, RTensor *pR, bool economic = 0);
+  void qr(const CTensor &A, CTensor *pQ, CTensor *pR, bool economic = 0);
+  /**QR decomposition with column pivoting, A(:,p) = Q R, where the
+     permutation p is the output.*/
+  tensor::Indices qr_pivoted(const RTensor &A, RTensor *pQ, RTensor *pR,
+                             bool economic = 0);
+  tensor::Indices qr_pivoted(const CTensor &A, CTensor *pQ, CTensor *pR,
+                             bool economic = 0);
+  /**LQ decomposition, A = L Q, with L lower triangular and Q of
+     orthonormal rows.*/
+  void lq(const RTensor &A, RTensor *pL, RTensor *pQ, bool economic = 0);
+  void lq(const CTensor &A, CTensor *pL, CTensor *pQ, bool economic = 0);
 
   /**Eigenvalue decomposition of a real matrix.*/
   const CTensor eig(const RTensor &A, CTensor *R = 0, CTensor *L = 0);
@@ -85,58 +450,158 @@ namespace linalg {
   const CTensor eig(const CTensor &A, CTensor *R = 0, CTensor *L = 0);
 
   /**Compute the right eigenvector with the largest absolute eigenvalue using the
-     power method.*/
+     power method. If 'iterations' is not null, it is set to the number of
+     applications of A.*/
   double eig_power_right(const RTensor &A, RTensor *vector,
-                         size_t iter = 0, double tol = 1e-11);
+                         size_t iter = 0, double tol = 1e-11, int *iterations = 0);
   /**Compute the left eigenvector with the largest absolute eigenvalue using the
      power method.*/
   double eig_power_left(const RTensor &A, RTensor *vector,
-                        size_t iter = 0, double tol = 1e-11);
+                        size_t iter = 0, double tol = 1e-11, int *iterations = 0);
   /**Compute the right eigenvector with the largest absolute eigenvalue using the
      power method.*/
   double eig_power_right(const RSparse &A, RTensor *vector,
-                         size_t iter = 0, double tol = 1e-11);
+                         size_t iter = 0, double tol = 1e-11, int *iterations = 0);
   /**Compute the left eigenvector with the largest absolute eigenvalue using the
      power method.*/
   double eig_power_left(const RSparse &A, RTensor *vector,
-                        size_t iter = 0, double tol = 1e-11);
+                        size_t iter = 0, double tol = 1e-11, int *iterations = 0);
   /**Compute the right eigenvector with the largest absolute eigenvalue using the
      power method.*/
   tensor::cdouble eig_power_right(const CTensor &A, CTensor *vector,
-                                  size_t iter = 0, double tol = 1e-11);
+                                  size_t iter = 0, double tol = 1e-11,
+                                  int *iterations = 0);
   /**Compute the left eigenvector with the largest absolute eigenvalue using the
      power method.*/
   tensor::cdouble eig_power_left(const CTensor &A, CTensor *vector,
-                                 size_t iter = 0, double tol = 1e-11);
+                                 size_t iter = 0, double tol = 1e-11,
+                                 int *iterations = 0);
   /**Compute the right eigenvector with the largest absolute eigenvalue using the
      power method.*/
   tensor::cdouble eig_power_right(const CSparse &A, CTensor *vector,
-                                  size_t iter = 0, double tol = 1e-11);
+                                  size_t iter = 0, double tol = 1e-11,
+                                  int *iterations = 0);
   /**Compute the left eigenvector with the largest absolute eigenvalue using the
      power method.*/
   tensor::cdouble eig_power_left(const CSparse &A, CTensor *vector,
-                                 size_t iter = 0, double tol = 1e-11);
+                                 size_t iter = 0, double tol = 1e-11,
+                                 int *iterations = 0);
+
+  /**Compute the 'neig' right eigenvectors whose eigenvalues are farthest
+     from 'shift', using the power method with deflation. The eigenvectors
+     are the columns of 'vectors' and the eigenvalues are returned. A
+     'shift' near the unwanted part of the spectrum speeds up convergence.*/
+  const RTensor eig_power_right(const RTensor &A, int neig, RTensor *vectors,
+                                double shift = 0, size_t iter = 0,
+                                double tol = 1e-11, int *iterations = 0);
+  /**Compute the 'neig' left eigenvectors whose eigenvalues are farthest
+     from 'shift', using the power method with deflation.*/
+  const RTensor eig_power_left(const RTensor &A, int neig, RTensor *vectors,
+                               double shift = 0, size_t iter = 0,
+                               double tol = 1e-11, int *iterations = 0);
+  const RTensor eig_power_right(const RSparse &A, int neig, RTensor *vectors,
+                                double shift = 0, size_t iter = 0,
+                                double tol = 1e-11, int *iterations = 0);
+  const RTensor eig_power_left(const RSparse &A, int neig, RTensor *vectors,
+                               double shift = 0, size_t iter = 0,
+                               double tol = 1e-11, int *iterations = 0);
+  const CTensor eig_power_right(const CTensor &A, int neig, CTensor *vectors,
+                                tensor::cdouble shift = 0, size_t iter = 0,
+                                double tol = 1e-11, int *iterations = 0);
+  const CTensor eig_power_left(const CTensor &A, int neig, CTensor *vectors,
+                               tensor::cdouble shift = 0, size_t iter = 0,
+                               double tol = 1e-11, int *iterations = 0);
+  const CTensor eig_power_right(const CSparse &A, int neig, CTensor *vectors,
+                                tensor::cdouble shift = 0, size_t iter = 0,
+                                double tol = 1e-11, int *iterations = 0);
+  const CTensor eig_power_left(const CSparse &A, int neig, CTensor *vectors,
+                               tensor::cdouble shift = 0, size_t iter = 0,
+                               double tol = 1e-11, int *iterations = 0);
 
   double do_eig_power(const Map<RTensor> *A, size_t dim, RTensor *vector,
-                      size_t iter = 0, double tol = 1e-11);
+                      size_t iter = 0, double tol = 1e-11, int *iterations = 0);
   tensor::cdouble do_eig_power(const Map<CTensor> *A, size_t dim, CTensor *vector,
-                               size_t iter = 0, double tol = 1e-11);
+                               size_t iter = 0, double tol = 1e-11,
+                               int *iterations = 0);
+  const RTensor do_eig_power(const Map<RTensor> *A, size_t dim, int neig,
+                             RTensor *vectors, double shift = 0, size_t iter = 0,
+                             double tol = 1e-11, int *iterations = 0);
+  const CTensor do_eig_power(const Map<CTensor> *A, size_t dim, int neig,
+                             CTensor *vectors, tensor::cdouble shift = 0,
+                             size_t iter = 0, double tol = 1e-11,
+                             int *iterations = 0);
 
   /**Compute the eigenvector with the largest absolute eigenvalue using the
      power method. 'f' is a function that takes in a Tensor and returns also a
      Tensor of the same class and dimension. */
   template<class func, class Tensor>
   const typename Tensor::elt_t
-  eig_power(const func &f, size_t dim, Tensor *vector, size_t iter = 0, double tol = 1e-11)
+  eig_power(const func &f, size_t dim, Tensor *vector, size_t iter = 0,
+            double tol = 1e-11, int *iterations = 0)
+  {
+    return do_eig_power(new tensor::FunctionMap<func,Tensor>(f), dim, vector,
+                        iter, tol, iterations);
+  }
+
+  /**Compute the 'neig' eigenvectors of the map 'f' whose eigenvalues are
+     farthest from 'shift', using the power method with deflation. */
+  template<class func, class Tensor>
+  const Tensor
+  eig_power(const func &f, size_t dim, int neig, Tensor *vectors,
+            typename Tensor::elt_t shift = 0, size_t iter = 0,
+            double tol = 1e-11, int *iterations = 0)
   {
-    return do_eig_power(new tensor::FunctionMap<func,Tensor>(f), dim, vector, iter, tol);
+    return do_eig_power(new tensor::FunctionMap<func,Tensor>(f), dim, neig,
+                        vectors, shift, iter, tol, iterations);
   }
 
+  /**LAPACK drivers for the symmetric (Hermitian) eigenvalue problem.*/
+  enum EigSymAlgorithm {
+    EIG_SYM_SYEV,  /*!<QR iteration.*/
+    EIG_SYM_SYEVD, /*!<Divide and conquer.*/
+    EIG_SYM_SYEVR  /*!<Relatively robust representations (MRRR).*/
+  };
+  extern EigSymAlgorithm eig_sym_algorithm;
+
   RTensor eig_sym(const RTensor &A, RTensor *pR = 0);
   RTensor eig_sym(const CTensor &A, CTensor *pR = 0);
-
-  const RTensor expm(const RTensor &A, unsigned int order = 7);
-  const CTensor expm(const CTensor &A, unsigned int order = 7);
+  /**Eigenvalues (and vectors) 'first' to 'last' of a symmetric matrix, in
+     increasing order, starting from 0.*/
+  RTensor eig_sym(const RTensor &A, RTensor *pR, tensor::index first,
+                  tensor::index last);
+  RTensor eig_sym(const CTensor &A, CTensor *pR, tensor::index first,
+                  tensor::index last);
+  /**Eigenvalues (and vectors) of a symmetric matrix in (lower, upper].*/
+  RTensor eig_sym_interval(const RTensor &A, RTensor *pR, double lower,
+                           double upper);
+  RTensor eig_sym_interval(const CTensor &A, CTensor *pR, double lower,
+                           double upper);
+  /**Eigenvalue decompositions of many independent symmetric (Hermitian)
+     matrices, in parallel.*/
+  std::vector<RTensor> eig_sym_batch(const std::vector<RTensor> &A,
+                                     std::vector<RTensor> *pV = 0);
+  std::vector<RTensor> eig_sym_batch(const std::vector<CTensor> &A,
+                                     std::vector<CTensor> *pV = 0);
+
+  const RTensor expm(const RTensor &A, unsigned int order = 0);
+  const CTensor expm(const CTensor &A, unsigned int order = 0);
+
+  /**Compute exp(t*A)*v without forming the exponential, with a Krylov
+     method that splits the interval [0,t] in adaptive steps. 'tol' bounds
+     the error relative to the norm of 'v' (default 1e-10), and
+     'krylov_dim' is the dimension of the Krylov subspace of each step
+     (default 30). The map remains owned by the caller. For the evolution
+     of a quantum state use t = -i*dt and A the Hamiltonian.*/
+  const RTensor expmv(const Map<RTensor> *A, double t, const RTensor &v,
+                      double tol = 0, int krylov_dim = 0);
+  const CTensor expmv(const Map<CTensor> *A, tensor::cdouble t,
+                      const CTensor &v, double tol = 0, int krylov_dim = 0);
+  const RTensor expmv(const RSparse &A, double t, const RTensor &v,
+                      double tol = 0, int krylov_dim = 0);
+  const CTensor expmv(const CSparse &A, tensor::cdouble t, const CTensor &v,
+                      double tol = 0, int krylov_dim = 0);
+  const CTensor expmv(const RSparse &A, tensor::cdouble t, const CTensor &v,
+                      double tol = 0, int krylov_dim = 0);
 
   /**Type of eigenvalues that eigs and Arpack compute.*/
   enum EigType {
@@ -213,6 +678,143 @@ namespace linalg {
   RTensor eigs_sym(const CSparse &A, int eig_type, size_t neig,
                    CTensor *vectors = NULL, bool *converged = NULL);
 
+  /**Find out a few eigenvalues and eigenvectors of a symmetric real sparse
+     matrix, stored as its upper triangle.*/
+  RTensor eigs_sym(const RSymSparse &A, int eig_type, size_t neig,
+                   RTensor *vectors = NULL, bool *converged = NULL);
+
+  /**Find out a few eigenvalues and eigenvectors of a hermitian complex sparse
+     matrix, stored as its upper triangle.*/
+  RTensor eigs_sym(const CSymSparse &A, int eig_type, size_t neig,
+                   CTensor *vectors = NULL, bool *converged = NULL);
+
+  /**Algorithms that eigs_sym() can use on sparse matrices and linear maps.*/
+  enum EigsSymBackend {
+    EigsArpack = 0, /*!<Implicitly restarted Lanczos method from ARPACK.*/
+    EigsLanczos = 1 /*!<Native thick-restart Lanczos method.*/
+  };
+
+  /**Select the algorithm used by eigs_sym() on sparse matrices and linear
+     maps, returning the previous choice.*/
+  int set_eigs_sym_backend(int backend);
+
+  RTensor do_eigs_sym(const Map<RTensor> *A, size_t dim, int eig_type,
+                      size_t neig, RTensor *vectors, bool *converged);
+  RTensor do_eigs_sym(const Map<CTensor> *A, size_t dim, int eig_type,
+                      size_t neig, CTensor *vectors, bool *converged);
+
+  /**Find out a few eigenvalues and eigenvectors of a symmetric (Hermitian)
+     linear map 'f' of dimension 'dim', using the backend selected with
+     set_eigs_sym_backend(). */
+  template<class func, class Tensor>
+  RTensor eigs_sym(const func &f, size_t dim, int eig_type, size_t neig,
+                   Tensor *vectors = NULL, bool *converged = NULL) {
+    return do_eigs_sym(new tensor::FunctionMap<func,Tensor>(f), dim, eig_type,
+                       neig, vectors, converged);
+  }
+
+  RTensor do_eigs_lanczos(const Map<RTensor> *A, size_t dim, int eig_type,
+                          size_t neig, RTensor *vectors, bool *converged);
+  RTensor do_eigs_lanczos(const Map<CTensor> *A, size_t dim, int eig_type,
+                          size_t neig, CTensor *vectors, bool *converged);
+
+  /**Find out a few eigenvalues and eigenvectors of a symmetric (Hermitian)
+     linear map 'f' of dimension 'dim' with a thick-restart Lanczos method.
+     Only LargestMagnitude, SmallestMagnitude, LargestAlgebraic and
+     SmallestAlgebraic are valid choices of 'eig_type'. 'vectors' is used to
+     output the eigenvectors, but its first column may also contain a
+     starting vector. 'converged' is true when the algorithm finished
+     properly. */
+  template<class func, class Tensor>
+  RTensor eigs_lanczos(const func &f, size_t dim, int eig_type, size_t neig,
+                       Tensor *vectors = NULL, bool *converged = NULL) {
+    return do_eigs_lanczos(new tensor::FunctionMap<func,Tensor>(f), dim,
+                           eig_type, neig, vectors, converged);
+  }
+
+  RTensor do_lobpcg(const Map<RTensor> *A, size_t dim, int eig_type,
+                    size_t neig, RTensor *vectors, bool *converged,
+                    const Map<RTensor> *preconditioner, double tol,
+                    size_t maxiter);
+  RTensor do_lobpcg(const Map<CTensor> *A, size_t dim, int eig_type,
+                    size_t neig, CTensor *vectors, bool *converged,
+                    const Map<CTensor> *preconditioner, double tol,
+                    size_t maxiter);
+
+  /**Find out a few of the smallest (SmallestAlgebraic) or largest
+     (LargestAlgebraic) eigenvalues and eigenvectors of a symmetric
+     (Hermitian) matrix with the LOBPCG block method. The matrix is applied
+     to blocks of vectors at once. 'vectors' is used to output the
+     eigenvectors, but it can also contain an estimate of them.
+     'preconditioner', when not NULL, should approximate the inverse of A
+     (possibly shifted); it is also applied to blocks of vectors, and it
+     remains owned by the caller. 'tol' is the tolerance in the norm of the
+     residuals, relative to the largest eigenvalue (default 1e-10).
+     'converged' is true when the algorithm finished properly.*/
+  RTensor lobpcg(const RTensor &A, int eig_type, size_t neig,
+                 RTensor *vectors = NULL, bool *converged = NULL,
+                 const Map<RTensor> *preconditioner = NULL, double tol = 0,
+                 size_t maxiter = 0);
+  RTensor lobpcg(const CTensor &A, int eig_type, size_t neig,
+                 CTensor *vectors = NULL, bool *converged = NULL,
+                 const Map<CTensor> *preconditioner = NULL, double tol = 0,
+                 size_t maxiter = 0);
+  RTensor lobpcg(const RSparse &A, int eig_type, size_t neig,
+                 RTensor *vectors = NULL, bool *converged = NULL,
+                 const Map<RTensor> *preconditioner = NULL, double tol = 0,
+                 size_t maxiter = 0);
+  RTensor lobpcg(const CSparse &A, int eig_type, size_t neig,
+                 CTensor *vectors = NULL, bool *converged = NULL,
+                 const Map<CTensor> *preconditioner = NULL, double tol = 0,
+                 size_t maxiter = 0);
+  RTensor lobpcg(const RSymSparse &A, int eig_type, size_t neig,
+                 RTensor *vectors = NULL, bool *converged = NULL,
+                 const Map<RTensor> *preconditioner = NULL, double tol = 0,
+                 size_t maxiter = 0);
+  RTensor lobpcg(const CSymSparse &A, int eig_type, size_t neig,
+                 CTensor *vectors = NULL, bool *converged = NULL,
+                 const Map<CTensor> *preconditioner = NULL, double tol = 0,
+                 size_t maxiter = 0);
+
+  /**LOBPCG method for a symmetric (Hermitian) linear map 'f' of dimension
+     'dim'. 'f' receives a matrix whose columns are the vectors on which it
+     acts, and must return the matrix of their images.*/
+  template<class func, class Tensor>
+  RTensor lobpcg(const func &f, size_t dim, int eig_type, size_t neig,
+                 Tensor *vectors = NULL, bool *converged = NULL,
+                 const Map<Tensor> *preconditioner = NULL, double tol = 0,
+                 size_t maxiter = 0) {
+    return do_lobpcg(new tensor::FunctionMap<func,Tensor>(f), dim, eig_type,
+                     neig, vectors, converged, preconditioner, tol, maxiter);
+  }
+
+  /**Find out the 'neig' lowest eigenvalues and eigenvectors of a symmetric
+     (Hermitian) linear map A with the Davidson method, using 'diagonal',
+     the diagonal of A, as preconditioner. This converges quickly for
+     diagonally dominant operators. The map remains owned by the caller.
+     'vectors' outputs the eigenvectors, but if not empty it is also used as
+     a starting guess. 'tol' is the tolerance in the norm of the residuals,
+     relative to the eigenvalue (default 1e-10). 'max_subspace' is the size
+     of the basis before restarting (default max(20, 4*neig), at least
+     2*neig). 'matvecs' outputs the number of applications of A.*/
+  RTensor davidson(const Map<RTensor> *A, const RTensor &diagonal, size_t neig,
+                   RTensor *vectors = NULL, bool *converged = NULL,
+                   double tol = 0, size_t max_subspace = 0,
+                   size_t *matvecs = NULL);
+  RTensor davidson(const Map<CTensor> *A, const RTensor &diagonal, size_t neig,
+                   CTensor *vectors = NULL, bool *converged = NULL,
+                   double tol = 0, size_t max_subspace = 0,
+                   size_t *matvecs = NULL);
+
+  /**Davidson method for a symmetric (Hermitian) sparse matrix, whose
+     diagonal is used as preconditioner.*/
+  RTensor davidson(const RSparse &A, size_t neig, RTensor *vectors = NULL,
+                   bool *converged = NULL, double tol = 0,
+                   size_t max_subspace = 0, size_t *matvecs = NULL);
+  RTensor davidson(const CSparse &A, size_t neig, CTensor *vectors = NULL,
+                   bool *converged = NULL, double tol = 0,
+                   size_t max_subspace = 0, size_t *matvecs = NULL);
+
 } // namespace linalg
 
 
@@ -27,8 +27,25 @@ namespace tensor {
 
   template<class Tensor>
   struct Map {
+    typedef typename Tensor::elt_t elt_t;
     virtual ~Map() {};
     virtual const Tensor operator()(const Tensor &arg) const { return arg; };
+    /**Apply the map to 'arg', writing the result into 'output'. Maps that
+       support it reuse the storage of 'output' when it has the right
+       dimensions, avoiding any allocation.*/
+    virtual void apply_into(const Tensor &arg, Tensor &output) const {
+      output = (*this)(arg);
+    }
+    /**Apply the map to a vector of 'n' elements, writing the result into
+       another vector of the same size. Both vectors are wrapped in tensors
+       that do not own the data.*/
+    void apply(index n, const elt_t *arg, elt_t *output) const {
+      Tensor x(Vector<elt_t>(n, const_cast<elt_t*>(arg)));
+      Tensor y(Vector<elt_t>(n, output));
+      apply_into(x, y);
+      if (y.begin_const() != output)
+        std::copy(y.begin_const(), y.begin_const() + n, output);
+    }
   };
 
   template<class Matrix>
@@ -37,6 +54,7 @@ namespace tensor {
     MatrixMap(const Matrix &m, bool transpose = false);
     virtual ~MatrixMap();
     virtual const tensor_t operator()(const tensor_t &arg) const;
+    virtual void apply_into(const tensor_t &arg, tensor_t &output) const;
   private:
     const Matrix m_;
     const bool transpose_;
@@ -51,6 +69,24 @@ namespace tensor {
     const Func &f_;
   };
 
+  /**Map given by a function or functor that is invoked as f(arg, output)
+     and writes its result into an existing tensor.*/
+  template<class Func, class Tensor>
+  struct FunctionIntoMap : public Map<Tensor> {
+    FunctionIntoMap(const Func &f) : f_(f) {}
+    virtual ~FunctionIntoMap() {};
+    virtual const Tensor operator()(const Tensor &arg) const {
+      Tensor output;
+      f_(arg, output);
+      return output;
+    }
+    virtual void apply_into(const Tensor &arg, Tensor &output) const {
+      f_(arg, output);
+    }
+  private:
+    const Func &f_;
+  };
+
   template<class out, class arg0, class arg1, class par1>
   struct Closure1 {
     typedef out (*f_ptr)(arg0, arg1);
@@ -162,6 +198,8 @@ namespace tensor {
   extern template class MatrixMap<CTensor>;
   extern template class MatrixMap<RSparse>;
   extern template class MatrixMap<CSparse>;
+  extern template class MatrixMap<RSymSparse>;
+  extern template class MatrixMap<CSymSparse>;
 
 } // namespace tensor
 
@@ -21,6 +21,7 @@
 #ifndef TENSOR_SPARSE_H
 #define TENSOR_SPARSE_H
 
+#include <algorithm>
 #include <tensor/tensor.h>
 
 namespace tensor {
@@ -43,15 +44,17 @@ namespace tensor {
     Sparse();
     /**Create a matrix with all elements set to zero.*/
     Sparse(index rows, index cols, index nonzero = 0);
-    /**Create a sparse matrix from the coordinates and values. */
+    /**Create a sparse matrix from the coordinates and values. Values with
+       repeated coordinates are added together. */
     Sparse(const Indices &row_indices, const Indices &column_indices,
            const Tensor<elt_t> &data,
            index rows = 0, index columns = 0);
     /* Create a sparse matrix from its internal representation. */
     Sparse(const Indices &dims, const Indices &row_start,
            const Indices &column, const Tensor<elt_t> &data);
-    /**Convert a tensor to sparse form.*/
-    explicit Sparse(const Tensor<elt_t> &tensor);
+    /**Convert a tensor to sparse form, dropping the elements whose absolute
+       value does not exceed 'tol'.*/
+    explicit Sparse(const Tensor<elt_t> &tensor, double tol = 0.0);
     /**Copy constructor.*/
     Sparse(const Sparse<elt_t> &s);
     /**Assignment operator.*/
@@ -65,6 +68,15 @@ namespace tensor {
     /**Return an element of the sparse matrix.*/
     elt_t operator()(index row, index col) const;
 
+    /**Matrix made of the given rows and columns, in that order, as in
+       Matlab's S(rows,cols). Indices may be repeated.*/
+    Sparse<elt_t> submatrix(const Indices &rows, const Indices &cols) const;
+    /**Matrix made of the rows 'first' to 'last', both included.*/
+    Sparse<elt_t> row_range(index first, index last) const;
+    /**Matrix with columns reordered, so that column 'i' of the output is
+       column 'permutation[i]' of this one.*/
+    Sparse<elt_t> permute_columns(const Indices &permutation) const;
+
     /**Return Sparse matrix dimensions.*/
     const Indices &dimensions() const { return dims_; }
     /**Length of a given Sparse matrix index.*/
@@ -109,6 +121,72 @@ namespace tensor {
   const CSparse to_complex(const RSparse &s);
   inline const CSparse to_complex(const CSparse &c) { return c; }
 
+  /* Position of element (row,col) in a compressed row matrix, or -1 if the
+   * element is not stored. Columns in a row are sorted, so that we may
+   * use a binary search. */
+  static inline index
+  sparse_find(const index *row_start, const index *column, index row, index col)
+  {
+    const index *begin = column + row_start[row];
+    const index *end = column + row_start[row+1];
+    const index *pos = std::lower_bound(begin, end, col);
+    return (pos != end && *pos == col)? (pos - column) : -1;
+  }
+
+  /**Incremental construction of a sparse matrix. Elements are inserted one
+     by one in any order as (row,column,value) triplets, and build() produces
+     a Sparse matrix in which repeated coordinates have been summed up, as in
+     Matlab's sparse() function.
+
+     The builder may hold several independent insertion buffers, so that
+     different threads can add elements concurrently, each one using its own
+     buffer number (for instance, omp_get_thread_num()). Memory usage is
+     proportional to the number of insertions.
+
+     \ingroup Tensors
+  */
+  template<typename elt>
+  class SparseBuilder {
+  public:
+    typedef elt elt_t;
+
+    /**Create a builder for a matrix of the given size.*/
+    SparseBuilder(index rows, index cols, int nbuffers = 1);
+
+    /**Add 'value' to the element at (row,col), using the given buffer.*/
+    void add(index row, index col, elt_t value, int buffer = 0) {
+      assert(row >= 0 && row < rows_ && col >= 0 && col < cols_);
+      buffer_t &b = buffers_[buffer];
+      b.row.push_back(row);
+      b.col.push_back(col);
+      b.value.push_back(value);
+    }
+    /**Preallocate space for 'nonzero' insertions in the given buffer.*/
+    void reserve(index nonzero, int buffer = 0);
+    /**Remove all inserted elements.*/
+    void clear();
+
+    /**Number of rows.*/
+    index rows() const { return rows_; }
+    /**Number of columns*/
+    index columns() const { return cols_; }
+    /**Number of insertions, including repeated coordinates.*/
+    index length() const;
+    /**Number of insertion buffers.*/
+    int buffers() const { return buffers_.size(); }
+
+    /**Sparse matrix with the sum of all inserted elements.*/
+    const Sparse<elt_t> build() const;
+
+  private:
+    struct buffer_t {
+      std::vector<index> row, col;
+      std::vector<elt_t> value;
+    };
+    index rows_, cols_;
+    std::vector<buffer_t> buffers_;
+  };
+
   //
   // Comparison
   //
@@ -149,6 +227,13 @@ namespace tensor {
   /* Matrix multiplication between tensor and sparse matrix. */
   const CTensor mmult(const CSparse &m1, const CTensor &m2);
 
+  /* Matrix multiplication between tensor and sparse matrix, reusing the
+     memory of the output tensor when it has the right dimensions. */
+  void mmult_into(RTensor &output, const RTensor &m1, const RSparse &m2);
+  void mmult_into(CTensor &output, const CTensor &m1, const CSparse &m2);
+  void mmult_into(RTensor &output, const RSparse &m1, const RTensor &m2);
+  void mmult_into(CTensor &output, const CSparse &m1, const CTensor &m2);
+
   /* Real part of a sparse matrix.*/
   inline const RSparse &real(const RSparse &A) { return A; }
   /* Conjugate of a sparse matrix.*/
@@ -196,8 +281,31 @@ namespace tensor {
   const CSparse operator/(const RSparse &a, cdouble b);
   const CSparse operator*(cdouble a, const RSparse &b);
 
+  /**Accumulate H += alpha * T. When the nonzero elements of T are a subset of
+     those of H, the values of H are updated without allocating memory.*/
+  void sparse_axpy_inplace(RSparse &H, double alpha, const RSparse &T);
+  /**Accumulate H += alpha * T. When the nonzero elements of T are a subset of
+     those of H, the values of H are updated without allocating memory.*/
+  void sparse_axpy_inplace(CSparse &H, cdouble alpha, const CSparse &T);
+
+  /**Sum of sparse matrices with equal dimensions, merged in a single pass.*/
+  const RSparse sparse_sum(const std::vector<RSparse> &terms);
+  /**Linear combination of sparse matrices with equal dimensions, merged in a
+     single pass.*/
+  const RSparse sparse_sum(const std::vector<RSparse> &terms, const RTensor &weights);
+  /**Sum of sparse matrices with equal dimensions, merged in a single pass.*/
+  const CSparse sparse_sum(const std::vector<CSparse> &terms);
+  /**Linear combination of sparse matrices with equal dimensions, merged in a
+     single pass.*/
+  const CSparse sparse_sum(const std::vector<CSparse> &terms, const CTensor &weights);
+
   /**Kronecker product between matrices, in Matlab order.*/
   const RSparse kron(const RSparse &s1, const RSparse &s2);
+  /**Kronecker product of three matrices, in Matlab order.*/
+  const RSparse kron(const RSparse &s1, const RSparse &s2, const RSparse &s3);
+  /**Kronecker product of a list of matrices, in Matlab order, computed
+     without intermediate matrices.*/
+  const RSparse kron(const std::vector<RSparse> &factors);
   /**Kronecker product between matrices, opposite to Matlab order.*/
   const RSparse kron2(const RSparse &s1, const RSparse &s2);
   /**Implements A+B where A and B act on different spaces of a tensor product.*/
@@ -205,15 +313,99 @@ namespace tensor {
 
   /**Kronecker product between matrices, in Matlab order.*/
   const CSparse kron(const CSparse &s1, const CSparse &s2);
+  /**Kronecker product of three matrices, in Matlab order.*/
+  const CSparse kron(const CSparse &s1, const CSparse &s2, const CSparse &s3);
+  /**Kronecker product of a list of matrices, in Matlab order, computed
+     without intermediate matrices.*/
+  const CSparse kron(const std::vector<CSparse> &factors);
   /**Kronecker product between matrices, opposite to Matlab order.*/
   const CSparse kron2(const CSparse &s1, const CSparse &s2);
   /**Implements A+B where A and B act on different spaces of a tensor product.*/
   const CSparse kron2_sum(const CSparse &s1, const CSparse &s2);
 
+  /**A symmetric or Hermitian sparse matrix. Only the diagonal and the upper
+     triangle are stored, using the same compressed row format as Sparse. The
+     lower triangle is implicitly given by the complex conjugate of the upper
+     one, so that real matrices are symmetric and complex ones are Hermitian.
+
+     \ingroup Tensors
+  */
+  template<typename elt>
+  class SymSparse {
+  public:
+    typedef elt elt_t;
+    typedef Tensor<elt> tensor;
+
+    /**Build an empty matrix.*/
+    SymSparse();
+    /**Fold a symmetric (Hermitian) matrix, keeping only its upper
+       triangle. The routine aborts if some element differs from the conjugate
+       of its transpose by more than 'tol'.*/
+    explicit SymSparse(const Sparse<elt_t> &s, double tol = 0.0);
+    /* Create a symmetric matrix from its internal representation. */
+    SymSparse(index n, const Indices &row_start,
+              const Indices &column, const Tensor<elt_t> &data);
+
+    /**Return an element of the sparse matrix.*/
+    elt_t operator()(index row, index col) const;
+
+    /**Return matrix dimensions.*/
+    const Indices &dimensions() const { return dims_; }
+    /**Number of rows.*/
+    index rows() const { return dims_[0]; }
+    /**Number of columns*/
+    index columns() const { return dims_[1]; }
+    /**Number of stored elements, i.e. upper triangle and diagonal.*/
+    index length() const { index r = rows(); return r? row_start_[r] : 0; }
+
+    /**Empty matrix?*/
+    bool is_empty() const { return rows() == 0; }
+
+    const Indices &priv_dims() const { return dims_; }
+    const Indices &priv_row_start() const { return row_start_; }
+    const Indices &priv_column() const { return column_; }
+    const Tensor<elt> &priv_data() const { return data_; }
+
+  public:
+    /** The dimensions (rows and columns) of the sparse matrix. */
+    Indices dims_;
+    /** For each row of the matrix, where its column_/data_ entries start. */
+    Indices row_start_;
+    /** For each data_ entry the column in the matrix, never below the row. */
+    Indices column_;
+    /** The elements of the upper triangle, including the diagonal. */
+    Tensor<elt_t> data_;
+  };
+
+  typedef SymSparse<double> RSymSparse;
+  typedef SymSparse<cdouble> CSymSparse;
+
+  /**Expand a symmetric (Hermitian) matrix to its full form.*/
+  template<typename t> const Tensor<t> full(const SymSparse<t> &s);
+
+  /* Matrix multiplication between symmetric sparse matrix and tensor. */
+  const RTensor mmult(const RSymSparse &m1, const RTensor &m2);
+  /* Matrix multiplication between symmetric sparse matrix and tensor. */
+  const CTensor mmult(const CSymSparse &m1, const CTensor &m2);
+  /* Matrix multiplication between tensor and symmetric sparse matrix. */
+  const RTensor mmult(const RTensor &m1, const RSymSparse &m2);
+  /* Matrix multiplication between tensor and symmetric sparse matrix. */
+  const CTensor mmult(const CTensor &m1, const CSymSparse &m2);
+
+  /* Matrix multiplication with a symmetric sparse matrix, reusing the
+     memory of the output tensor when it has the right dimensions. */
+  void mmult_into(RTensor &output, const RSymSparse &m1, const RTensor &m2);
+  void mmult_into(CTensor &output, const CSymSparse &m1, const CTensor &m2);
+  void mmult_into(RTensor &output, const RTensor &m1, const RSymSparse &m2);
+  void mmult_into(CTensor &output, const CTensor &m1, const CSymSparse &m2);
+
 } // namespace tensor
 
 #ifdef TENSOR_LOAD_IMPL
 #include <tensor/detail/sparse_base.hpp>
+#include <tensor/detail/sparse_builder.hpp>
+#include <tensor/detail/sparse_slice.hpp>
+#include <tensor/detail/sparse_sym.hpp>
 #endif
 
 #endif // !TENSOR_SPARSE_H
@@ -557,6 +557,8 @@ namespace tensor {
   const CTensor mmult(const RTensor &a, const CTensor &b);
   const CTensor mmult(const CTensor &a, const RTensor &b);
 
+  void mmult_into(CTensor &output, const CTensor &a, const CTensor &b);
+
   const RTensor scale(const RTensor &t, int ndx1, const RTensor &v);
   const CTensor scale(const CTensor &t, int ndx1, const CTensor &v);
   const CTensor scale(const CTensor &t, int ndx1, const RTensor &v);
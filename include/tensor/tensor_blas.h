@@ -86,10 +86,12 @@ namespace blas {
 #ifdef TENSOR_USE_VECLIB
   typedef __CLPK_integer integer;
   typedef __CLPK_doublecomplex cdouble;
+  typedef __CLPK_complex cfloat;
 #endif
 #ifdef TENSOR_USE_ATLAS
   typedef int integer;
   typedef struct { double re, im; } cdouble;
+  typedef struct { float re, im; } cfloat;
   typedef int __CLPK_integer;
   typedef double __CLPK_doublereal;
   typedef cdouble __CLPK_doublecomplex;
@@ -97,6 +99,7 @@ namespace blas {
 #ifdef TENSOR_USE_OPENBLAS
   typedef blasint integer;
   typedef openblas_complex_double cdouble;
+  typedef openblas_complex_float cfloat;
   typedef blasint __CLPK_integer;
   typedef double __CLPK_doublereal;
   typedef cdouble __CLPK_doublecomplex;
@@ -104,10 +107,12 @@ namespace blas {
 #ifdef TENSOR_USE_MKL
   typedef MKL_INT integer;
   typedef MKL_Complex16 cdouble;
+  typedef MKL_Complex8 cfloat;
 #endif
 #ifdef TENSOR_USE_ACML
   typedef int integer;
   typedef doublecomplex cdouble;
+  typedef complex cfloat;
   typedef int __CLPK_integer;
   typedef double __CLPK_doublereal;
   typedef cdouble __CLPK_doublecomplex;
@@ -115,6 +120,7 @@ namespace blas {
 #ifdef TENSOR_USE_ESSL
   typedef _ESVINT integer;
   typedef _ESVCOM cdouble;
+  typedef struct { float re, im; } cfloat;
   typedef _ESVINT __CLPK_integer;
   typedef double __CLPK_doublereal;
   typedef _ESVCOM __CLPK_doublecomplex;
@@ -122,6 +128,7 @@ namespace blas {
 #ifdef TENSOR_USE_CBLAPACK
   typedef ::integer integer;
   typedef doublecomplex cdouble;
+  typedef complex cfloat;
   typedef integer __CLPK_integer;
   typedef double __CLPK_doublereal;
   typedef cdouble __CLPK_doublecomplex;
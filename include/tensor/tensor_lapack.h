@@ -83,6 +83,196 @@ extern "C" {
      __CLPK_integer *n, __CLPK_doublecomplex *a, __CLPK_integer *lda,
      __CLPK_doublereal *w, __CLPK_doublecomplex *work,
      __CLPK_integer *lwork, __CLPK_doublereal *rwork, __CLPK_integer *info);
+  void F77NAME(dsyevd)
+    (char *jobz, char *uplo, __CLPK_integer *n, __CLPK_doublereal *a,
+     __CLPK_integer *lda, __CLPK_doublereal *w, __CLPK_doublereal *work,
+     __CLPK_integer *lwork, __CLPK_integer *iwork, __CLPK_integer *liwork,
+     __CLPK_integer *info);
+  void F77NAME(zheevd)
+    (char *jobz, char *uplo, __CLPK_integer *n, __CLPK_doublecomplex *a,
+     __CLPK_integer *lda, __CLPK_doublereal *w, __CLPK_doublecomplex *work,
+     __CLPK_integer *lwork, __CLPK_doublereal *rwork, __CLPK_integer *lrwork,
+     __CLPK_integer *iwork, __CLPK_integer *liwork, __CLPK_integer *info);
+  void F77NAME(dsyevr)
+    (char *jobz, char *range, char *uplo, __CLPK_integer *n,
+     __CLPK_doublereal *a, __CLPK_integer *lda, __CLPK_doublereal *vl,
+     __CLPK_doublereal *vu, __CLPK_integer *il, __CLPK_integer *iu,
+     __CLPK_doublereal *abstol, __CLPK_integer *m, __CLPK_doublereal *w,
+     __CLPK_doublereal *z, __CLPK_integer *ldz, __CLPK_integer *isuppz,
+     __CLPK_doublereal *work, __CLPK_integer *lwork, __CLPK_integer *iwork,
+     __CLPK_integer *liwork, __CLPK_integer *info);
+  void F77NAME(zheevr)
+    (char *jobz, char *range, char *uplo, __CLPK_integer *n,
+     __CLPK_doublecomplex *a, __CLPK_integer *lda, __CLPK_doublereal *vl,
+     __CLPK_doublereal *vu, __CLPK_integer *il, __CLPK_integer *iu,
+     __CLPK_doublereal *abstol, __CLPK_integer *m, __CLPK_doublereal *w,
+     __CLPK_doublecomplex *z, __CLPK_integer *ldz, __CLPK_integer *isuppz,
+     __CLPK_doublecomplex *work, __CLPK_integer *lwork,
+     __CLPK_doublereal *rwork, __CLPK_integer *lrwork, __CLPK_integer *iwork,
+     __CLPK_integer *liwork, __CLPK_integer *info);
+  int F77NAME(dgesdd)
+    (char *jobz, __CLPK_integer *m, __CLPK_integer *n,
+     __CLPK_doublereal *a, __CLPK_integer *lda, __CLPK_doublereal *s,
+     __CLPK_doublereal *u, __CLPK_integer *ldu, __CLPK_doublereal *vt,
+     __CLPK_integer *ldvt, __CLPK_doublereal *work, __CLPK_integer *lwork,
+     __CLPK_integer *iwork, __CLPK_integer *info);
+  int F77NAME(zgesdd)
+    (char *jobz, __CLPK_integer *m, __CLPK_integer *n,
+     __CLPK_doublecomplex *a, __CLPK_integer *lda, __CLPK_doublereal *s,
+     __CLPK_doublecomplex *u, __CLPK_integer *ldu, __CLPK_doublecomplex *vt,
+     __CLPK_integer *ldvt, __CLPK_doublecomplex *work,
+     __CLPK_integer *lwork, __CLPK_doublereal *rwork, __CLPK_integer *iwork,
+     __CLPK_integer *info);
+  int F77NAME(dgesvdx)
+    (char *jobu, char *jobvt, char *range, __CLPK_integer *m,
+     __CLPK_integer *n, __CLPK_doublereal *a, __CLPK_integer *lda,
+     __CLPK_doublereal *vl, __CLPK_doublereal *vu, __CLPK_integer *il,
+     __CLPK_integer *iu, __CLPK_integer *ns, __CLPK_doublereal *s,
+     __CLPK_doublereal *u, __CLPK_integer *ldu, __CLPK_doublereal *vt,
+     __CLPK_integer *ldvt, __CLPK_doublereal *work, __CLPK_integer *lwork,
+     __CLPK_integer *iwork, __CLPK_integer *info);
+  int F77NAME(zgesvdx)
+    (char *jobu, char *jobvt, char *range, __CLPK_integer *m,
+     __CLPK_integer *n, __CLPK_doublecomplex *a, __CLPK_integer *lda,
+     __CLPK_doublereal *vl, __CLPK_doublereal *vu, __CLPK_integer *il,
+     __CLPK_integer *iu, __CLPK_integer *ns, __CLPK_doublereal *s,
+     __CLPK_doublecomplex *u, __CLPK_integer *ldu, __CLPK_doublecomplex *vt,
+     __CLPK_integer *ldvt, __CLPK_doublecomplex *work,
+     __CLPK_integer *lwork, __CLPK_doublereal *rwork, __CLPK_integer *iwork,
+     __CLPK_integer *info);
+  int F77NAME(dgeqrf)
+    (__CLPK_integer *m, __CLPK_integer *n, __CLPK_doublereal *a,
+     __CLPK_integer *lda, __CLPK_doublereal *tau, __CLPK_doublereal *work,
+     __CLPK_integer *lwork, __CLPK_integer *info);
+  int F77NAME(zgeqrf)
+    (__CLPK_integer *m, __CLPK_integer *n, __CLPK_doublecomplex *a,
+     __CLPK_integer *lda, __CLPK_doublecomplex *tau,
+     __CLPK_doublecomplex *work, __CLPK_integer *lwork,
+     __CLPK_integer *info);
+  int F77NAME(dgeqp3)
+    (__CLPK_integer *m, __CLPK_integer *n, __CLPK_doublereal *a,
+     __CLPK_integer *lda, __CLPK_integer *jpvt, __CLPK_doublereal *tau,
+     __CLPK_doublereal *work, __CLPK_integer *lwork, __CLPK_integer *info);
+  int F77NAME(zgeqp3)
+    (__CLPK_integer *m, __CLPK_integer *n, __CLPK_doublecomplex *a,
+     __CLPK_integer *lda, __CLPK_integer *jpvt, __CLPK_doublecomplex *tau,
+     __CLPK_doublecomplex *work, __CLPK_integer *lwork,
+     __CLPK_doublereal *rwork, __CLPK_integer *info);
+  int F77NAME(dorgqr)
+    (__CLPK_integer *m, __CLPK_integer *n, __CLPK_integer *k,
+     __CLPK_doublereal *a, __CLPK_integer *lda, __CLPK_doublereal *tau,
+     __CLPK_doublereal *work, __CLPK_integer *lwork, __CLPK_integer *info);
+  int F77NAME(zungqr)
+    (__CLPK_integer *m, __CLPK_integer *n, __CLPK_integer *k,
+     __CLPK_doublecomplex *a, __CLPK_integer *lda,
+     __CLPK_doublecomplex *tau, __CLPK_doublecomplex *work,
+     __CLPK_integer *lwork, __CLPK_integer *info);
+  int F77NAME(dgelqf)
+    (__CLPK_integer *m, __CLPK_integer *n, __CLPK_doublereal *a,
+     __CLPK_integer *lda, __CLPK_doublereal *tau, __CLPK_doublereal *work,
+     __CLPK_integer *lwork, __CLPK_integer *info);
+  int F77NAME(zgelqf)
+    (__CLPK_integer *m, __CLPK_integer *n, __CLPK_doublecomplex *a,
+     __CLPK_integer *lda, __CLPK_doublecomplex *tau,
+     __CLPK_doublecomplex *work, __CLPK_integer *lwork,
+     __CLPK_integer *info);
+  int F77NAME(dorglq)
+    (__CLPK_integer *m, __CLPK_integer *n, __CLPK_integer *k,
+     __CLPK_doublereal *a, __CLPK_integer *lda, __CLPK_doublereal *tau,
+     __CLPK_doublereal *work, __CLPK_integer *lwork, __CLPK_integer *info);
+  int F77NAME(zunglq)
+    (__CLPK_integer *m, __CLPK_integer *n, __CLPK_integer *k,
+     __CLPK_doublecomplex *a, __CLPK_integer *lda,
+     __CLPK_doublecomplex *tau, __CLPK_doublecomplex *work,
+     __CLPK_integer *lwork, __CLPK_integer *info);
+  int F77NAME(dgetrf)
+    (__CLPK_integer *m, __CLPK_integer *n, __CLPK_doublereal *a,
+     __CLPK_integer *lda, __CLPK_integer *ipiv, __CLPK_integer *info);
+  int F77NAME(zgetrf)
+    (__CLPK_integer *m, __CLPK_integer *n, __CLPK_doublecomplex *a,
+     __CLPK_integer *lda, __CLPK_integer *ipiv, __CLPK_integer *info);
+  int F77NAME(dgetrs)
+    (char *trans, __CLPK_integer *n, __CLPK_integer *nrhs,
+     __CLPK_doublereal *a, __CLPK_integer *lda, __CLPK_integer *ipiv,
+     __CLPK_doublereal *b, __CLPK_integer *ldb, __CLPK_integer *info);
+  int F77NAME(zgetrs)
+    (char *trans, __CLPK_integer *n, __CLPK_integer *nrhs,
+     __CLPK_doublecomplex *a, __CLPK_integer *lda, __CLPK_integer *ipiv,
+     __CLPK_doublecomplex *b, __CLPK_integer *ldb, __CLPK_integer *info);
+  int F77NAME(dgecon)
+    (char *norm, __CLPK_integer *n, __CLPK_doublereal *a,
+     __CLPK_integer *lda, __CLPK_doublereal *anorm,
+     __CLPK_doublereal *rcond, __CLPK_doublereal *work,
+     __CLPK_integer *iwork, __CLPK_integer *info);
+  int F77NAME(zgecon)
+    (char *norm, __CLPK_integer *n, __CLPK_doublecomplex *a,
+     __CLPK_integer *lda, __CLPK_doublereal *anorm,
+     __CLPK_doublereal *rcond, __CLPK_doublecomplex *work,
+     __CLPK_doublereal *rwork, __CLPK_integer *info);
+  int F77NAME(dpotrf)
+    (char *uplo, __CLPK_integer *n, __CLPK_doublereal *a,
+     __CLPK_integer *lda, __CLPK_integer *info);
+  int F77NAME(zpotrf)
+    (char *uplo, __CLPK_integer *n, __CLPK_doublecomplex *a,
+     __CLPK_integer *lda, __CLPK_integer *info);
+  int F77NAME(dpotrs)
+    (char *uplo, __CLPK_integer *n, __CLPK_integer *nrhs,
+     __CLPK_doublereal *a, __CLPK_integer *lda, __CLPK_doublereal *b,
+     __CLPK_integer *ldb, __CLPK_integer *info);
+  int F77NAME(zpotrs)
+    (char *uplo, __CLPK_integer *n, __CLPK_integer *nrhs,
+     __CLPK_doublecomplex *a, __CLPK_integer *lda, __CLPK_doublecomplex *b,
+     __CLPK_integer *ldb, __CLPK_integer *info);
+  int F77NAME(dpocon)
+    (char *uplo, __CLPK_integer *n, __CLPK_doublereal *a,
+     __CLPK_integer *lda, __CLPK_doublereal *anorm,
+     __CLPK_doublereal *rcond, __CLPK_doublereal *work,
+     __CLPK_integer *iwork, __CLPK_integer *info);
+  int F77NAME(zpocon)
+    (char *uplo, __CLPK_integer *n, __CLPK_doublecomplex *a,
+     __CLPK_integer *lda, __CLPK_doublereal *anorm,
+     __CLPK_doublereal *rcond, __CLPK_doublecomplex *work,
+     __CLPK_doublereal *rwork, __CLPK_integer *info);
+  int F77NAME(dsytrf)
+    (char *uplo, __CLPK_integer *n, __CLPK_doublereal *a,
+     __CLPK_integer *lda, __CLPK_integer *ipiv, __CLPK_doublereal *work,
+     __CLPK_integer *lwork, __CLPK_integer *info);
+  int F77NAME(zhetrf)
+    (char *uplo, __CLPK_integer *n, __CLPK_doublecomplex *a,
+     __CLPK_integer *lda, __CLPK_integer *ipiv, __CLPK_doublecomplex *work,
+     __CLPK_integer *lwork, __CLPK_integer *info);
+  int F77NAME(dsytrs)
+    (char *uplo, __CLPK_integer *n, __CLPK_integer *nrhs,
+     __CLPK_doublereal *a, __CLPK_integer *lda, __CLPK_integer *ipiv,
+     __CLPK_doublereal *b, __CLPK_integer *ldb, __CLPK_integer *info);
+  int F77NAME(zhetrs)
+    (char *uplo, __CLPK_integer *n, __CLPK_integer *nrhs,
+     __CLPK_doublecomplex *a, __CLPK_integer *lda, __CLPK_integer *ipiv,
+     __CLPK_doublecomplex *b, __CLPK_integer *ldb, __CLPK_integer *info);
+  int F77NAME(dsycon)
+    (char *uplo, __CLPK_integer *n, __CLPK_doublereal *a,
+     __CLPK_integer *lda, __CLPK_integer *ipiv, __CLPK_doublereal *anorm,
+     __CLPK_doublereal *rcond, __CLPK_doublereal *work,
+     __CLPK_integer *iwork, __CLPK_integer *info);
+  int F77NAME(zhecon)
+    (char *uplo, __CLPK_integer *n, __CLPK_doublecomplex *a,
+     __CLPK_integer *lda, __CLPK_integer *ipiv, __CLPK_doublereal *anorm,
+     __CLPK_doublereal *rcond, __CLPK_doublecomplex *work,
+     __CLPK_integer *info);
+  int F77NAME(sgetrf)
+    (__CLPK_integer *m, __CLPK_integer *n, float *a, __CLPK_integer *lda,
+     __CLPK_integer *ipiv, __CLPK_integer *info);
+  int F77NAME(cgetrf)
+    (__CLPK_integer *m, __CLPK_integer *n, cfloat *a, __CLPK_integer *lda,
+     __CLPK_integer *ipiv, __CLPK_integer *info);
+  int F77NAME(sgetrs)
+    (char *trans, __CLPK_integer *n, __CLPK_integer *nrhs, float *a,
+     __CLPK_integer *lda, __CLPK_integer *ipiv, float *b,
+     __CLPK_integer *ldb, __CLPK_integer *info);
+  int F77NAME(cgetrs)
+    (char *trans, __CLPK_integer *n, __CLPK_integer *nrhs, cfloat *a,
+     __CLPK_integer *lda, __CLPK_integer *ipiv, cfloat *b,
+     __CLPK_integer *ldb, __CLPK_integer *info);
 }
 #endif
 
@@ -0,0 +1,99 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#ifndef TENSOR_PROFILE_HAMILTONIANS_H
+#define TENSOR_PROFILE_HAMILTONIANS_H
+
+#include <tensor/tensor.h>
+#include <tensor/sparse.h>
+#include <tensor/rand.h>
+
+namespace profile {
+
+  using namespace tensor;
+
+  /* Operator 'op' acting on 'k' consecutive sites, starting at site 'i',
+     of a chain of 'L' spins 1/2. */
+  inline const RSparse
+  spin_operator(const RSparse &op, int i, int k, int L)
+  {
+    return kron(RSparse::eye(1 << i), kron(op, RSparse::eye(1 << (L - i - k))));
+  }
+
+  /* Heisenberg chain of 'L' spins 1/2 with open boundary conditions and a
+     random field along Z, which removes most degeneracies. */
+  inline const RSparse
+  heisenberg_chain(int L, double field = 0.1)
+  {
+    RTensor sz = RTensor::zeros(2, 2), sp = RTensor::zeros(2, 2);
+    sz.at(0,0) = 0.5;
+    sz.at(1,1) = -0.5;
+    sp.at(0,1) = 1.0;
+    RSparse Sz(sz), Sp(sp), Sm(adjoint(sp));
+    RSparse bond = kron(Sz, Sz) + 0.5 * (kron(Sp, Sm) + kron(Sm, Sp));
+    RSparse H(1 << L, 1 << L);
+    for (int i = 0; i < L; i++) {
+      H = H + (field * tensor::rand<double>()) * spin_operator(Sz, i, 1, L);
+      if (i + 1 < L)
+        H = H + spin_operator(bond, i, 2, L);
+    }
+    return H;
+  }
+
+  /* Particle on a square lattice of 'L' x 'L' sites with open boundaries,
+     hopping, a random potential between 0 and 'disorder' and a drift
+     'drift' along X, which makes the matrix non-Hermitian. */
+  inline const RSparse
+  lattice_hamiltonian(int L, double disorder, double drift = 0.0)
+  {
+    RTensor t = RTensor::zeros(L, L);
+    for (int i = 0; i < L; i++) {
+      t.at(i, i) = 2.0;
+      if (i + 1 < L) {
+        t.at(i, i+1) = -1.0 + drift;
+        t.at(i+1, i) = -1.0 - drift;
+      }
+    }
+    int n = L * L;
+    Indices sites(n);
+    RTensor potential(igen << n);
+    for (int i = 0; i < n; i++) {
+      sites.at(i) = i;
+      potential.at(i) = disorder * tensor::rand<double>();
+    }
+    RSparse T(t), I = RSparse::eye(L);
+    return kron(T, I) + kron(I, T) + RSparse(sites, sites, potential, n, n);
+  }
+
+  /* Linear map that counts how many times it is applied. */
+  template<class Matrix, class Tensor>
+  struct CountingMap {
+    const Matrix &matrix;
+    mutable int count;
+    CountingMap(const Matrix &m) : matrix(m), count(0) {}
+    const Tensor operator()(const Tensor &v) const {
+      /* Block solvers apply the matrix to several vectors at once. */
+      count += (v.rank() == 2)? v.columns() : 1;
+      return mmult(matrix, v);
+    }
+  };
+
+}
+
+#endif // TENSOR_PROFILE_HAMILTONIANS_H
@@ -0,0 +1,89 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <vector>
+#include <tensor/tensor.h>
+#include <tensor/linalg.h>
+#include "profile.h"
+
+using namespace tensor;
+using namespace linalg;
+using namespace profile;
+
+/* 'count' random matrices of sizes 1 to 'size', as the sectors of a
+   block sparse tensor. */
+std::vector<RTensor> random_sectors(size_t count, size_t size)
+{
+  std::vector<RTensor> A;
+  for (size_t i = 0; i < count; i++) {
+    size_t n = 1 + (i * 7) % size;
+    RTensor M = RTensor::random(n, n);
+    A.push_back(M + transpose(M));
+  }
+  return A;
+}
+
+void prof_batch(const char *name, int method, bool batched)
+{
+  PROF_BEGIN_SET(name) {
+    for (size_t size = 8; size <= 128; size *= 2) {
+      std::vector<RTensor> A = random_sectors(1000, size), U(1), VT(1);
+      if (method == 0) {
+        if (batched) {
+          PROF_ENTRY(size, svd_batch(A, &U, &VT, SVD_ECONOMIC), 3);
+        } else {
+          PROF_ENTRY(size, for (size_t k = 0; k < A.size(); k++)
+                       svd(A[k], &U[0], &VT[0], SVD_ECONOMIC), 3);
+        }
+      } else if (method == 1) {
+        if (batched) {
+          PROF_ENTRY(size, eig_sym_batch(A, &U), 3);
+        } else {
+          PROF_ENTRY(size, for (size_t k = 0; k < A.size(); k++)
+                       eig_sym(A[k], &U[0]), 3);
+        }
+      } else {
+        if (batched) {
+          PROF_ENTRY(size, solve_batch(A, A), 3);
+        } else {
+          PROF_ENTRY(size, for (size_t k = 0; k < A.size(); k++)
+                       solve(A[k], A[k]), 3);
+        }
+      }
+    }
+  } PROF_END_SET;
+}
+
+int main()
+{
+  PROF_BEGIN_GROUP("SVD of 1000 matrices") {
+    prof_batch("svd", 0, false);
+    prof_batch("svd_batch", 0, true);
+  } PROF_END_GROUP;
+
+  PROF_BEGIN_GROUP("eig_sym of 1000 matrices") {
+    prof_batch("eig_sym", 1, false);
+    prof_batch("eig_sym_batch", 1, true);
+  } PROF_END_GROUP;
+
+  PROF_BEGIN_GROUP("solve with 1000 matrices") {
+    prof_batch("solve", 2, false);
+    prof_batch("solve_batch", 2, true);
+  } PROF_END_GROUP;
+}
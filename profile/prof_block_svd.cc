@@ -0,0 +1,68 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <tensor/tensor.h>
+#include <tensor/sparse.h>
+#include <tensor/rand.h>
+#include <tensor/linalg.h>
+#include "profile.h"
+
+using namespace tensor;
+using namespace linalg;
+using namespace profile;
+
+/* Block diagonal matrix with 'nblocks' random blocks of size 'size', with
+   the rows and columns interleaved, as produced by the quantum numbers of
+   an MPS bond. */
+RTensor block_matrix(size_t nblocks, size_t size)
+{
+  size_t n = nblocks * size;
+  RTensor A = RTensor::zeros(n, n);
+  for (size_t b = 0; b < nblocks; b++)
+    for (size_t i = 0; i < size; i++)
+      for (size_t j = 0; j < size; j++)
+        A.at(b + nblocks * i, b + nblocks * j) = rand<double>();
+  return A;
+}
+
+void prof_block_svd(const char *name, int method)
+{
+  PROF_BEGIN_SET(name) {
+    for (size_t nblocks = 2; nblocks <= 32; nblocks *= 2) {
+      RTensor A = block_matrix(nblocks, 40), U, VT;
+      RSparse S(A);
+      if (method == 0) {
+        PROF_ENTRY(nblocks, svd(A, &U, &VT, SVD_ECONOMIC), 3);
+      } else if (method == 1) {
+        PROF_ENTRY(nblocks, block_svd(A, &U, &VT, SVD_ECONOMIC), 3);
+      } else {
+        PROF_ENTRY(nblocks, block_svd(S, &U, &VT, SVD_ECONOMIC), 3);
+      }
+    }
+  } PROF_END_SET;
+}
+
+int main()
+{
+  PROF_BEGIN_GROUP("SVD of block diagonal matrices, blocks of size 40") {
+    prof_block_svd("svd", 0);
+    prof_block_svd("block_svd", 1);
+    prof_block_svd("block_svd sparse", 2);
+  } PROF_END_GROUP;
+}
@@ -0,0 +1,63 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <tensor/tensor.h>
+#include <tensor/linalg.h>
+#include "profile.h"
+
+using namespace tensor;
+using namespace linalg;
+using namespace profile;
+
+/* Full diagonalization of a random symmetric matrix, with eigenvectors,
+   using the given LAPACK driver. */
+void prof_eig_sym(const char *name, EigSymAlgorithm algorithm)
+{
+  eig_sym_algorithm = algorithm;
+  PROF_BEGIN_SET(name) {
+    for (size_t n = 250; n <= 2000; n *= 2) {
+      RTensor A = RTensor::random(n, n), V;
+      A = A + transpose(A);
+      PROF_ENTRY(n, eig_sym(A, &V), 1);
+    }
+  } PROF_END_SET;
+  eig_sym_algorithm = EIG_SYM_SYEVD;
+}
+
+/* Only the 'neig' lowest eigenpairs. */
+void prof_eig_sym_subset(const char *name, size_t neig)
+{
+  PROF_BEGIN_SET(name) {
+    for (size_t n = 250; n <= 2000; n *= 2) {
+      RTensor A = RTensor::random(n, n), V;
+      A = A + transpose(A);
+      PROF_ENTRY(n, eig_sym(A, &V, 0, neig - 1), 1);
+    }
+  } PROF_END_SET;
+}
+
+int main()
+{
+  PROF_BEGIN_GROUP("Symmetric eigenvalue problem") {
+    prof_eig_sym("syev", EIG_SYM_SYEV);
+    prof_eig_sym("syevd", EIG_SYM_SYEVD);
+    prof_eig_sym("syevr", EIG_SYM_SYEVR);
+    prof_eig_sym_subset("syevr, 10 lowest", 10);
+  } PROF_END_GROUP;
+}
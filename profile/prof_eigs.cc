@@ -0,0 +1,189 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <tensor/tensor.h>
+#include <tensor/sparse.h>
+#include <tensor/linalg.h>
+#include <tensor/arpack.h>
+#include "profile.h"
+#include "hamiltonians.h"
+
+using namespace tensor;
+using namespace linalg;
+using namespace profile;
+
+/* Time to convergence, number of matrix-vector products and an estimate of
+   the memory used by the Krylov basis and the workspaces of each solver. */
+void prof_eigs_sym(const char *name, int backend, int neig,
+                   int min_sites = 8, int max_sites = 16)
+{
+  PROF_BEGIN_SET(name) {
+    int old_backend = set_eigs_sym_backend(backend);
+    for (int L = min_sites; L <= max_sites; L += 2) {
+      RSparse H = heisenberg_chain(L);
+      size_t n = H.rows();
+      CountingMap<RSparse,RTensor> op(H);
+      RTensor vectors;
+      double time;
+      tic();
+      eigs_sym(op, n, SmallestAlgebraic, neig, &vectors);
+      time = toc();
+      size_t ncv = std::min<size_t>(std::max<size_t>(2 * neig + 1, 20), n);
+      size_t memory = (backend == EigsArpack)?
+        (n * (ncv + 4) + ncv * (ncv + 8)) :
+        (n * (ncv + 1) + std::min<size_t>(n, 1024) * ncv + ncv * ncv);
+      std::cout << "   <entry id='" << n << "' time='" << time
+                << "' matvecs='" << op.count
+                << "' memory='" << memory * sizeof(double) << "'/>\n";
+    }
+    set_eigs_sym_backend(old_backend);
+  } PROF_END_SET;
+}
+
+/* LOBPCG applies the matrix to blocks of vectors. It keeps X, W, P and their
+   images, plus the Rayleigh-Ritz matrix of size 3*neig. */
+void prof_lobpcg(const char *name, int neig, int min_sites = 8,
+                 int max_sites = 16)
+{
+  PROF_BEGIN_SET(name) {
+    for (int L = min_sites; L <= max_sites; L += 2) {
+      RSparse H = heisenberg_chain(L);
+      size_t n = H.rows();
+      CountingMap<RSparse,RTensor> op(H);
+      RTensor vectors;
+      double time;
+      tic();
+      lobpcg(op, n, SmallestAlgebraic, neig, &vectors);
+      time = toc();
+      size_t memory = 7 * n * neig + 18 * neig * neig;
+      std::cout << "   <entry id='" << n << "' time='" << time
+                << "' matvecs='" << op.count
+                << "' memory='" << memory * sizeof(double) << "'/>\n";
+    }
+  } PROF_END_SET;
+}
+
+/* Davidson with the diagonal of the Hamiltonian as preconditioner. It keeps
+   the basis and its image, plus the projected matrix. */
+void prof_davidson(const char *name, int neig, int min_sites = 8,
+                   int max_sites = 16)
+{
+  PROF_BEGIN_SET(name) {
+    for (int L = min_sites; L <= max_sites; L += 2) {
+      RSparse H = heisenberg_chain(L);
+      size_t n = H.rows();
+      size_t matvecs = 0;
+      RTensor vectors;
+      double time;
+      tic();
+      davidson(H, neig, &vectors, NULL, 0, 0, &matvecs);
+      time = toc();
+      size_t m = std::min<size_t>(std::max<size_t>(20, 4 * neig), n);
+      size_t memory = 2 * n * m + m * m + 3 * n * neig;
+      std::cout << "   <entry id='" << n << "' time='" << time
+                << "' matvecs='" << matvecs
+                << "' memory='" << memory * sizeof(double) << "'/>\n";
+    }
+  } PROF_END_SET;
+}
+
+/* Power method with deflation. The shift, which must lie above the middle
+   of the spectrum, turns the lowest states into those with the largest
+   absolute value; the closer it is to the middle, the faster the
+   convergence. */
+void prof_eig_power(const char *name, int neig, double shift_per_site,
+                    int min_sites = 8, int max_sites = 12)
+{
+  PROF_BEGIN_SET(name) {
+    for (int L = min_sites; L <= max_sites; L += 2) {
+      RSparse H = heisenberg_chain(L);
+      size_t n = H.rows();
+      int matvecs = 0;
+      RTensor vectors;
+      double time;
+      tic();
+      eig_power_right(H, neig, &vectors, shift_per_site * L, 100000, 1e-10,
+                      &matvecs);
+      time = toc();
+      size_t memory = n * (neig + 2) + neig * neig;
+      std::cout << "   <entry id='" << n << "' time='" << time
+                << "' matvecs='" << matvecs
+                << "' memory='" << memory * sizeof(double) << "'/>\n";
+    }
+  } PROF_END_SET;
+}
+
+/* Ground states of 20 Heisenberg chains that differ by a small field on
+   the first spin, as in a sweep or a parameter scan: eigs() allocates the
+   ARPACK workspaces and starts from a random vector every time, while
+   EigsSolver keeps them and starts from the previous ground state. */
+void prof_eigs_sequence(const char *name, bool reuse, int min_sites = 8,
+                        int max_sites = 14)
+{
+  PROF_BEGIN_SET(name) {
+    for (int L = min_sites; L <= max_sites; L += 2) {
+      RTensor sz = RTensor::zeros(2, 2);
+      sz.at(0,0) = 0.5;
+      sz.at(1,1) = -0.5;
+      RSparse H0 = heisenberg_chain(L), Sz0 = spin_operator(RSparse(sz), 0, 1, L);
+      size_t n = H0.rows();
+      EigsSolver<RTensor> solver(n, SmallestAlgebraic, 1);
+      int matvecs = 0;
+      double time;
+      tic();
+      for (int k = 0; k < 20; k++) {
+        RSparse H = H0 + (1e-3 * k) * Sz0;
+        CountingMap<RSparse,RTensor> op(H);
+        RTensor vector;
+        if (reuse) {
+          solver.solve(tensor::FunctionMap<CountingMap<RSparse,RTensor>,RTensor>(op));
+        } else {
+          eigs(op, n, SmallestAlgebraic, 1, &vector);
+        }
+        matvecs += op.count;
+      }
+      time = toc();
+      std::cout << "   <entry id='" << n << "' time='" << time
+                << "' matvecs='" << matvecs << "'/>\n";
+    }
+  } PROF_END_SET;
+}
+
+int main()
+{
+  PROF_BEGIN_GROUP("eigs_sym Heisenberg ground state") {
+    prof_eigs_sym("arpack", EigsArpack, 1);
+    prof_eigs_sym("lanczos", EigsLanczos, 1);
+    prof_davidson("davidson", 1);
+    prof_eig_power("eig_power shift=L/2", 1, 0.5);
+    prof_eig_power("eig_power shift=L/8", 1, 0.125);
+  } PROF_END_GROUP;
+
+  PROF_BEGIN_GROUP("eigs_sym Heisenberg 8 lowest states") {
+    prof_eigs_sym("arpack", EigsArpack, 8);
+    prof_eigs_sym("lanczos", EigsLanczos, 8);
+    prof_lobpcg("lobpcg", 8);
+    prof_davidson("davidson", 8);
+  } PROF_END_GROUP;
+
+  PROF_BEGIN_GROUP("eigs Heisenberg ground state, 20 nearby fields") {
+    prof_eigs_sequence("eigs", false);
+    prof_eigs_sequence("EigsSolver", true);
+  } PROF_END_GROUP;
+}
@@ -0,0 +1,108 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <cmath>
+#include <tensor/rand.h>
+#include <tensor/tensor.h>
+#include <tensor/linalg.h>
+#include "profile.h"
+
+using namespace tensor;
+using namespace linalg;
+using namespace profile;
+
+/* Random orthogonal matrix from the eigenvectors of a symmetric one. */
+static RTensor random_orthogonal(size_t n)
+{
+  RTensor A = RTensor::random(n, n);
+  RTensor Q;
+  eig_sym(A + transpose(A), &Q);
+  return Q;
+}
+
+/* Matrix Q T Q^T with T block diagonal, made of 2x2 triangular blocks
+   [a c; 0 -a] with a in [0,norm). When 'c' is large the matrix is strongly
+   nonnormal and ||A|| overestimates the scaling that is needed. The exact
+   exponential is built from the exponentials of the blocks. Without
+   'rotate', Q is the identity and the matrix stays triangular. */
+static RTensor test_matrix(size_t n, double norm, double c, bool rotate,
+                           RTensor *exact)
+{
+  RTensor T = RTensor::zeros(n, n), E = RTensor::zeros(n, n);
+  for (size_t i = 0; i + 1 < n; i += 2) {
+    double a = norm * (0.5 + 0.5 * rand<double>());
+    T.at(i, i) = a;
+    T.at(i + 1, i + 1) = -a;
+    T.at(i, i + 1) = c;
+    E.at(i, i) = exp(a);
+    E.at(i + 1, i + 1) = exp(-a);
+    E.at(i, i + 1) = c * sinh(a) / a;
+  }
+  if (!rotate) {
+    *exact = E;
+    return T;
+  }
+  RTensor Q = random_orthogonal(n);
+  *exact = mmult(Q, mmult(E, transpose(Q)));
+  return mmult(Q, mmult(T, transpose(Q)));
+}
+
+/* Time the exponential and express it in units of one matrix product,
+   which is the dominant cost of both algorithms. 'order' = 0 selects the
+   adaptive algorithm, a nonzero value the fixed order approximant. */
+void prof_expm(const char *name, unsigned int order, size_t n, double c,
+               bool rotate)
+{
+  PROF_BEGIN_SET(name) {
+    RTensor B = RTensor::random(n, n);
+    tic();
+    for (int i = 0; i < 10; i++)
+      B = mmult(B, B) / norm2(B);
+    double gemm_time = toc() / 10;
+    for (double norm = 0.01; norm <= 100; norm *= 10) {
+      RTensor exact, A = test_matrix(n, norm, c, rotate, &exact);
+      RTensor E;
+      tic();
+      for (int i = 0; i < 5; i++)
+        E = expm(A, order);
+      double elapsed = toc() / 5;
+      std::cout << "   <entry id='" << norm << "' time='" << elapsed
+                << "' gemms='" << elapsed / gemm_time
+                << "' error='" << norm2(E - exact) / norm2(exact) << "'/>\n";
+    }
+  } PROF_END_SET;
+}
+
+int main()
+{
+  PROF_BEGIN_GROUP("Normal matrix, n = 400") {
+    prof_expm("Pade 7", 7, 400, 0.0, true);
+    prof_expm("Higham", 0, 400, 0.0, true);
+  } PROF_END_GROUP;
+
+  PROF_BEGIN_GROUP("Nonnormal matrix, n = 400") {
+    prof_expm("Pade 7", 7, 400, 100.0, true);
+    prof_expm("Higham", 0, 400, 100.0, true);
+  } PROF_END_GROUP;
+
+  PROF_BEGIN_GROUP("Nonnormal triangular matrix, n = 400") {
+    prof_expm("Pade 7", 7, 400, 100.0, false);
+    prof_expm("Higham", 0, 400, 100.0, false);
+  } PROF_END_GROUP;
+}
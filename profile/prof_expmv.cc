@@ -0,0 +1,66 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <tensor/tensor.h>
+#include <tensor/sparse.h>
+#include <tensor/linalg.h>
+#include "profile.h"
+#include "hamiltonians.h"
+
+using namespace tensor;
+using namespace linalg;
+using namespace profile;
+
+/* Evolution of a localized wavepacket, exp(-i H t) psi, on a disordered
+   lattice, either with expmv() or by exponentiating the whole matrix. */
+void prof_propagation(const char *name, bool krylov, int min_size,
+                      int max_size, double time)
+{
+  PROF_BEGIN_SET(name) {
+    for (int L = min_size; L <= max_size; L *= 2) {
+      RSparse H = lattice_hamiltonian(L, 1.0);
+      size_t n = H.rows();
+      CTensor psi = CTensor::zeros(igen << n);
+      psi.at(n / 2 + L / 2) = 1.0;
+      cdouble t = to_complex(0.0, -time);
+      double elapsed;
+      tic();
+      if (krylov)
+        psi = expmv(H, t, psi);
+      else
+        psi = mmult(expm(t * CTensor(full(H))), psi);
+      elapsed = toc();
+      std::cout << "   <entry id='" << n << "' time='" << elapsed
+                << "' norm='" << norm2(psi) << "'/>\n";
+    }
+  } PROF_END_SET;
+}
+
+int main()
+{
+  PROF_BEGIN_GROUP("Lattice wavepacket, t = 1") {
+    prof_propagation("expm", false, 8, 32, 1.0);
+    prof_propagation("expmv", true, 8, 256, 1.0);
+  } PROF_END_GROUP;
+
+  PROF_BEGIN_GROUP("Lattice wavepacket, t = 10") {
+    prof_propagation("expm", false, 8, 32, 10.0);
+    prof_propagation("expmv", true, 8, 256, 10.0);
+  } PROF_END_GROUP;
+}
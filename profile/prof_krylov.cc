@@ -0,0 +1,82 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <tensor/tensor.h>
+#include <tensor/sparse.h>
+#include <tensor/linalg.h>
+#include "profile.h"
+#include "hamiltonians.h"
+
+using namespace tensor;
+using namespace linalg;
+using namespace profile;
+
+enum { NoPreconditioner, Jacobi, ILU0 };
+enum { PCG, BiCGSTAB, GMRES };
+
+/* Time and iterations needed to solve (H + shift) x = b on a disordered
+   lattice, with and without preconditioning. */
+void prof_krylov(const char *name, int solver, int preconditioner,
+                 double drift, int min_size = 16, int max_size = 128)
+{
+  PROF_BEGIN_SET(name) {
+    for (int L = min_size; L <= max_size; L *= 2) {
+      RSparse H = lattice_hamiltonian(L, 100.0, drift);
+      RTensor b = RTensor::random(igen << H.rows());
+      JacobiPreconditioner<double> jacobi(H);
+      ILU0Preconditioner<double> ilu(H);
+      const Map<RTensor> *M = 0;
+      if (preconditioner == Jacobi) M = &jacobi;
+      if (preconditioner == ILU0) M = &ilu;
+      RTensor history;
+      double time;
+      tic();
+      switch (solver) {
+      case PCG: pcg(H, b, M, 0, 0, 1e-8, &history); break;
+      case BiCGSTAB: bicgstab(H, b, M, 0, 0, 1e-8, &history); break;
+      default: gmres(H, b, M, 0, 0, 1e-8, &history); break;
+      }
+      time = toc();
+      std::cout << "   <entry id='" << H.rows() << "' time='" << time
+                << "' iterations='" << history.size() - 1
+                << "' residual='" << history[history.size() - 1] << "'/>\n";
+    }
+  } PROF_END_SET;
+}
+
+int main()
+{
+  PROF_BEGIN_GROUP("Hermitian lattice, PCG") {
+    prof_krylov("none", PCG, NoPreconditioner, 0.0);
+    prof_krylov("jacobi", PCG, Jacobi, 0.0);
+    prof_krylov("ilu0", PCG, ILU0, 0.0);
+  } PROF_END_GROUP;
+
+  PROF_BEGIN_GROUP("Lattice with drift, BiCGSTAB") {
+    prof_krylov("none", BiCGSTAB, NoPreconditioner, 0.5);
+    prof_krylov("jacobi", BiCGSTAB, Jacobi, 0.5);
+    prof_krylov("ilu0", BiCGSTAB, ILU0, 0.5);
+  } PROF_END_GROUP;
+
+  PROF_BEGIN_GROUP("Lattice with drift, GMRES(30)") {
+    prof_krylov("none", GMRES, NoPreconditioner, 0.5);
+    prof_krylov("jacobi", GMRES, Jacobi, 0.5);
+    prof_krylov("ilu0", GMRES, ILU0, 0.5);
+  } PROF_END_GROUP;
+}
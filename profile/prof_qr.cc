@@ -0,0 +1,58 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <tensor/tensor.h>
+#include <tensor/linalg.h>
+#include "profile.h"
+
+using namespace tensor;
+using namespace linalg;
+using namespace profile;
+
+/* Orthonormal basis for the columns of a random 2n x n matrix, as in the
+   canonicalization of an MPS tensor with physical dimension 2 and bond
+   dimension n: the Q factor of qr(), of qr_pivoted() or the U of svd(). */
+void prof_orthogonalize(const char *name, int method)
+{
+  PROF_BEGIN_SET(name) {
+    for (size_t n = 50; n <= 800; n *= 2) {
+      RTensor A = RTensor::random(2 * n, n), Q, R, VT;
+      if (method == 0) {
+        PROF_ENTRY(n, svd(A, &Q, &VT, SVD_ECONOMIC), 3);
+      } else if (method == 1) {
+        PROF_ENTRY(n, qr(A, &Q, &R, true), 3);
+      } else if (method == 2) {
+        PROF_ENTRY(n, qr_pivoted(A, &Q, &R, true), 3);
+      } else {
+        RTensor At = transpose(A);
+        PROF_ENTRY(n, lq(At, &R, &Q, true), 3);
+      }
+    }
+  } PROF_END_SET;
+}
+
+int main()
+{
+  PROF_BEGIN_GROUP("Orthonormal basis of a 2n x n matrix") {
+    prof_orthogonalize("svd", 0);
+    prof_orthogonalize("qr", 1);
+    prof_orthogonalize("qr_pivoted", 2);
+    prof_orthogonalize("lq", 3);
+  } PROF_END_GROUP;
+}
@@ -0,0 +1,82 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <cmath>
+#include <tensor/tensor.h>
+#include <tensor/linalg.h>
+#include "profile.h"
+
+using namespace tensor;
+using namespace linalg;
+using namespace profile;
+
+/* Tall m x n matrix with singular values exp(-i/decay), as those of a
+   bond between two halves of a weakly entangled state. */
+static RTensor test_matrix(size_t m, size_t n, double decay, RTensor *s)
+{
+  size_t k = std::min(m, n);
+  *s = RTensor(igen << k);
+  for (size_t i = 0; i < k; i++)
+    s->at(i) = exp(-(double)i / decay);
+  RTensor U, V;
+  svd(RTensor::random(m, k), &U, 0, SVD_ECONOMIC);
+  svd(RTensor::random(k, n), 0, &V, SVD_ECONOMIC);
+  return mmult(U, mmult(diag(*s), V));
+}
+
+/* Time to obtain the 'rank' largest singular triplets, and relative error
+   of the corresponding low rank approximation compared to the optimal one.
+   A negative 'power_iters' selects the truncated svd(). */
+void prof_rsvd(const char *name, size_t m, size_t n, size_t rank,
+               int power_iters, double decay)
+{
+  PROF_BEGIN_SET(name) {
+    RTensor s, A = test_matrix(m, n, decay, &s);
+    double optimal = norm2(s(range(rank, s.size() - 1)));
+    for (int repeat = 0; repeat < 3; repeat++) {
+      RTensor U, VT, s2;
+      tic();
+      if (power_iters < 0)
+        s2 = svd(A, rank, 0.0, &U, &VT);
+      else
+        s2 = rsvd(A, rank, 10, power_iters, &U, &VT);
+      double elapsed = toc();
+      double error = norm2(A - mmult(U, mmult(diag(s2), VT)));
+      std::cout << "   <entry id='" << rank << "' time='" << elapsed
+                << "' error='" << error / optimal - 1 << "'/>\n";
+    }
+  } PROF_END_SET;
+}
+
+int main()
+{
+  PROF_BEGIN_GROUP("4000 x 400 matrix, rank 20, decay 5") {
+    prof_rsvd("svd", 4000, 400, 20, -1, 5.0);
+    prof_rsvd("rsvd q=0", 4000, 400, 20, 0, 5.0);
+    prof_rsvd("rsvd q=1", 4000, 400, 20, 1, 5.0);
+    prof_rsvd("rsvd q=2", 4000, 400, 20, 2, 5.0);
+  } PROF_END_GROUP;
+
+  PROF_BEGIN_GROUP("4000 x 400 matrix, rank 20, decay 50") {
+    prof_rsvd("svd", 4000, 400, 20, -1, 50.0);
+    prof_rsvd("rsvd q=0", 4000, 400, 20, 0, 50.0);
+    prof_rsvd("rsvd q=1", 4000, 400, 20, 1, 50.0);
+    prof_rsvd("rsvd q=2", 4000, 400, 20, 2, 50.0);
+  } PROF_END_GROUP;
+}
@@ -0,0 +1,110 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <tensor/tensor.h>
+#include <tensor/linalg.h>
+#include "profile.h"
+
+using namespace tensor;
+using namespace linalg;
+using namespace profile;
+
+/* Ten solutions with the same symmetric positive definite n x n matrix
+   and different vectors, as in the steps of an implicit time integrator:
+   solve() factors the matrix every time, while the LU and Cholesky
+   objects factor it once. */
+void prof_repeated_solve(const char *name, int method)
+{
+  PROF_BEGIN_SET(name) {
+    for (size_t n = 100; n <= 1600; n *= 2) {
+      RTensor M = RTensor::random(n, n);
+      RTensor A = mmult(M, transpose(M)) + RTensor::eye(n, n);
+      RTensor b = RTensor::random(n), x;
+      if (method == 0) {
+        PROF_ENTRY(n, for (int k = 0; k < 10; k++) x = solve(A, b), 3);
+      } else if (method == 1) {
+        PROF_ENTRY(n, { LU<RTensor> F(A);
+            for (int k = 0; k < 10; k++) x = F.solve(b); }, 3);
+      } else if (method == 2) {
+        PROF_ENTRY(n, { Cholesky<RTensor> F(A);
+            for (int k = 0; k < 10; k++) x = F.solve(b); }, 3);
+      } else {
+        PROF_ENTRY(n, for (int k = 0; k < 10; k++)
+                     x = solve(A, b, SOLVE_AUTO), 3);
+      }
+    }
+  } PROF_END_SET;
+}
+
+/* One solution with a random, well conditioned n x n matrix, in double
+   precision or with a single precision factorization and refinement. */
+void prof_refined_solve(const char *name, bool refined)
+{
+  PROF_BEGIN_SET(name) {
+    for (size_t n = 200; n <= 3200; n *= 2) {
+      RTensor A = RTensor::random(n, n) + (double)n * RTensor::eye(n, n);
+      RTensor b = RTensor::random(n), x;
+      if (refined) {
+        PROF_ENTRY(n, x = solve_refined(A, b), 3);
+      } else {
+        PROF_ENTRY(n, x = solve(A, b), 3);
+      }
+    }
+  } PROF_END_SET;
+}
+
+/* Ten least squares solutions with an n x n matrix of rank n/2, where
+   half of the singular values are discarded: solve_with_svd() computes
+   the SVD every time, while PseudoInverse computes it once. */
+void prof_pseudo_inverse(const char *name, bool reuse)
+{
+  PROF_BEGIN_SET(name) {
+    for (size_t n = 100; n <= 800; n *= 2) {
+      RTensor A = mmult(RTensor::random(n, n / 2), RTensor::random(n / 2, n));
+      RTensor b = RTensor::random(n), x;
+      if (reuse) {
+        PROF_ENTRY(n, { PseudoInverse<RTensor> P(A, 1e-10);
+            for (int k = 0; k < 10; k++) x = P.solve(b); }, 3);
+      } else {
+        PROF_ENTRY(n, for (int k = 0; k < 10; k++)
+                     x = solve_with_svd(A, b, 1e-10), 3);
+      }
+    }
+  } PROF_END_SET;
+}
+
+int main()
+{
+  PROF_BEGIN_GROUP("Ten solves with a positive definite matrix") {
+    prof_repeated_solve("solve", 0);
+    prof_repeated_solve("LU", 1);
+    prof_repeated_solve("Cholesky", 2);
+    prof_repeated_solve("solve SOLVE_AUTO", 3);
+  } PROF_END_GROUP;
+
+  PROF_BEGIN_GROUP("Mixed precision solve") {
+    prof_refined_solve("solve", false);
+    prof_refined_solve("solve_refined", true);
+  } PROF_END_GROUP;
+
+  PROF_BEGIN_GROUP("Ten solves with a rank deficient matrix") {
+    prof_pseudo_inverse("solve_with_svd", false);
+    prof_pseudo_inverse("PseudoInverse", true);
+  } PROF_END_GROUP;
+}
@@ -0,0 +1,58 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <tensor/tensor.h>
+#include <tensor/linalg.h>
+#include "profile.h"
+
+using namespace tensor;
+using namespace linalg;
+using namespace profile;
+
+/* Economic decomposition of random square matrices, with the singular
+   vectors, as in the truncation step of an MPS sweep. A nonzero 'rank'
+   uses the truncated svd() and keeps only that many triplets. */
+void prof_svd(const char *name, SVDAlgorithm algorithm, size_t rank)
+{
+  svd_algorithm = algorithm;
+  PROF_BEGIN_SET(name) {
+    for (size_t n = 50; n <= 800; n *= 2) {
+      RTensor A = RTensor::random(n, n), U, VT;
+      if (rank) {
+        PROF_ENTRY(n, svd(A, rank, 0.0, &U, &VT), 3);
+      } else {
+        PROF_ENTRY(n, svd(A, &U, &VT, SVD_ECONOMIC), 3);
+      }
+    }
+  } PROF_END_SET;
+  svd_algorithm = SVD_GESDD;
+}
+
+int main()
+{
+  PROF_BEGIN_GROUP("Full economic SVD") {
+    prof_svd("gesvd", SVD_GESVD, 0);
+    prof_svd("gesdd", SVD_GESDD, 0);
+  } PROF_END_GROUP;
+
+  PROF_BEGIN_GROUP("Truncated SVD, 20 singular values") {
+    prof_svd("gesdd", SVD_GESDD, 20);
+    prof_svd("gesvdx", SVD_GESVDX, 20);
+  } PROF_END_GROUP;
+}
@@ -1,47 +0,0 @@
-/* ../arpack-ng/icnteq.f -- translated by f2c (version 0.1).
-   You must link the resulting object file with libf2c:
-	on Microsoft Windows system, link with libf2c.lib;
-	on Linux or Unix systems, link with .../path/to/libf2c.a -lm
-	or, if you install libf2c.a in a standard place, with -lf2c -lm
-	-- in that order, at the end of the command line, as in
-		cc *.o -lf2c -lm
-	Source for libf2c is in /netlib/f2c/libf2c.zip, e.g.,
-
-		http://www.netlib.org/f2c/libf2c.zip
-*/
-
-#include <stdlib.h> /* For exit() */
-#include <f2c.h>
-
-
-/* ----------------------------------------------------------------------- */
-
-/*     Count the number of elements equal to a specified integer value. */
-
-integer icnteq_(integer *n, integer *array, integer *value)
-{
-    /* System generated locals */
-    integer ret_val, i__1;
-
-    /* Local variables */
-    static integer i__, k;
-
-
-
-    /* Parameter adjustments */
-    --array;
-
-    /* Function Body */
-    k = 0;
-    i__1 = *n;
-    for (i__ = 1; i__ <= i__1; ++i__) {
-	if (array[i__] == *value) {
-	    ++k;
-	}
-/* L10: */
-    }
-    ret_val = k;
-
-    return ret_val;
-} /* icnteq_ */
-
@@ -16,4 +16,53 @@ struct {
             titref, trvec;
 } timing_;
 
+/* State of the reverse communication routines, see arpackf.h. They start
+   from zero, which marks the random number generator of dgetv0 and
+   zgetv0 as not seeded. */
+struct {
+    integer bounds, ierr, ih, iq, ishift, iupd, iw, ldh, ldq, msglvl, mxiter,
+            mode, nb, nev0, next, np, ritz;
+} dsaups_ = {};
+
+struct {
+    doublereal rnorm, eps23;
+    integer iter, kplusp, msglvl, nconv, nev0, np0;
+    logical cnorm, getv0, initv, update, ushift;
+} dsau2s_ = {};
+
+struct {
+    doublereal rnorm1, safmin, wnorm;
+    integer ierr, ipj, irj, ivj, iter, itry, j, msglvl;
+    logical orth1, orth2, rstart, step3, step4;
+} dsaits_ = {};
+
+struct {
+    doublereal rnorm0;
+    integer iseed[4], iter, msglvl;
+    logical first, seeded, orth;
+} dgetvs_ = {};
+
+struct {
+    integer bounds, ih, iq, ishift, iupd, iw, ldh, ldq, levec, mode, msglvl,
+            mxiter, nb, nev0, next, np, ritz;
+} znaups_ = {};
+
+struct {
+    doublereal rnorm, eps23;
+    integer iter, kplusp, msglvl, nconv, nevbef, nev0, np0;
+    logical cnorm, getv0, initv, update, ushift;
+} znau2s_ = {};
+
+struct {
+    doublereal ovfl, betaj, rnorm1, smlnum, ulp, unfl, wnorm;
+    integer ierr, ipj, irj, ivj, iter, itry, j, msglvl;
+    logical orth1, orth2, rstart, step3, step4;
+} znaits_ = {};
+
+struct {
+    doublereal rnorm0;
+    integer iseed[4], iter, msglvl;
+    logical first, seeded, orth;
+} zgetvs_ = {};
+
 }
@@ -246,9 +246,16 @@ c
      &           infol, jj
       Double precision
      &           rnorm1, wnorm, safmin, temp1
-      save       orth1, orth2, rstart, step3, step4,
+c
+c     %-----------------------------------------------%
+c     | State kept between calls. It lives in a named |
+c     | common block instead of SAVE variables, so    |
+c     | that a computation can be checkpointed.       |
+c     %-----------------------------------------------%
+c
+      common /dsaits/ rnorm1, safmin, wnorm,
      &           ierr, ipj, irj, ivj, iter, itry, j, msglvl,
-     &           rnorm1, safmin, wnorm
+     &           orth1, orth2, rstart, step3, step4
 c
 c     %-----------------------%
 c     | Local Array Arguments | 
@@ -226,9 +226,16 @@ c
      &           np0, nptemp, nevd2, nevm2, kp(3) 
       Double precision
      &           rnorm, temp, eps23
-      save       cnorm, getv0, initv, update, ushift,
+c
+c     %-----------------------------------------------%
+c     | State kept between calls. It lives in a named |
+c     | common block instead of SAVE variables, so    |
+c     | that a computation can be checkpointed.       |
+c     %-----------------------------------------------%
+c
+      common /dsau2s/ rnorm, eps23,
      &           iter, kplusp, msglvl, nconv, nev0, np0,
-     &           rnorm, eps23
+     &           cnorm, getv0, initv, update, ushift
 c
 c     %----------------------%
 c     | External Subroutines |
@@ -448,7 +448,14 @@ c
       integer    bounds, ierr, ih, iq, ishift, iupd, iw,
      &           ldh, ldq, msglvl, mxiter, mode, nb,
      &           nev0, next, np, ritz, j
-      save       bounds, ierr, ih, iq, ishift, iupd, iw,
+c
+c     %-----------------------------------------------%
+c     | State kept between calls. It lives in a named |
+c     | common block instead of SAVE variables, so    |
+c     | that a computation can be checkpointed.       |
+c     %-----------------------------------------------%
+c
+      common /dsaups/ bounds, ierr, ih, iq, ishift, iupd, iw,
      &           ldh, ldq, msglvl, mxiter, mode, nb,
      &           nev0, next, np, ritz
 c
@@ -156,13 +156,20 @@ c     %------------------------%
 c     | Local Scalars & Arrays |
 c     %------------------------%
 c
-      logical    first, inits, orth
+      logical    first, seeded, orth
       integer    idist, iseed(4), iter, msglvl, jj
       Double precision
      &           rnorm0
       Complex*16
      &           cnorm
-      save       first, iseed, inits, iter, msglvl, orth, rnorm0
+c
+c     %-----------------------------------------------%
+c     | State kept between calls. It lives in a named |
+c     | common block instead of SAVE variables, so    |
+c     | that a computation can be checkpointed.       |
+c     %-----------------------------------------------%
+c
+      common /zgetvs/ rnorm0, iseed, iter, msglvl, first, seeded, orth
 c
 c     %----------------------%
 c     | External Subroutines |
@@ -180,12 +187,6 @@ c
      &           zdotc
       external   zdotc, dznrm2, dlapy2
 c
-c     %-----------------%
-c     | Data Statements |
-c     %-----------------%
-c
-      data       inits /.true./
-c
 c     %-----------------------%
 c     | Executable Statements |
 c     %-----------------------%
@@ -196,12 +197,12 @@ c     | Initialize the seed of the LAPACK |
 c     | random number generator           |
 c     %-----------------------------------%
 c
-      if (inits) then
+      if (.not. seeded) then
           iseed(1) = 1
           iseed(2) = 3
           iseed(3) = 5
           iseed(4) = 7
-          inits = .false.
+          seeded = .true.
       end if
 c
       if (ido .eq.  0) then
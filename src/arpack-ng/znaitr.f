@@ -264,9 +264,16 @@ c
       Complex*16
      &           cnorm
 c
-      save       first, orth1, orth2, rstart, step3, step4,
-     &           ierr, ipj, irj, ivj, iter, itry, j, msglvl, ovfl,
-     &           betaj, rnorm1, smlnum, ulp, unfl, wnorm
+c     %-----------------------------------------------%
+c     | State kept between calls. It lives in a named |
+c     | common block instead of SAVE variables, so    |
+c     | that a computation can be checkpointed.       |
+c     %-----------------------------------------------%
+c
+      save       first
+      common /znaits/ ovfl, betaj, rnorm1, smlnum, ulp, unfl, wnorm,
+     &           ierr, ipj, irj, ivj, iter, itry, j, msglvl,
+     &           orth1, orth2, rstart, step3, step4
 c
 c     %----------------------%
 c     | External Subroutines |
@@ -224,9 +224,15 @@ c
      &           rnorm , eps23, rtemp
       character  wprime*2
 c
-      save       cnorm,  getv0, initv , update, ushift,
-     &           rnorm,  iter , kplusp, msglvl, nconv ,
-     &           nevbef, nev0 , np0   , eps23
+c     %-----------------------------------------------%
+c     | State kept between calls. It lives in a named |
+c     | common block instead of SAVE variables, so    |
+c     | that a computation can be checkpointed.       |
+c     %-----------------------------------------------%
+c
+      common /znau2s/ rnorm, eps23,
+     &           iter , kplusp, msglvl, nconv , nevbef, nev0 , np0,
+     &           cnorm,  getv0, initv , update, ushift
 c
 c
 c     %-----------------------%
@@ -18,6 +18,7 @@
 */
 
 #include <tensor/arpack_d.h>
+#include <tensor/sdf.h>
 #include "saupp.h"
 #include "seupp.h"
 
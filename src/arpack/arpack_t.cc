@@ -22,7 +22,14 @@
 using namespace tensor;
 using namespace linalg;
 
-ARPACK::ARPACK(size_t _n, enum EigType _t, size_t _nev)
+/* Conservative estimate of the number of iterations, by Matlab */
+static blas::integer
+default_maxit(blas::integer n, blas::integer ncv)
+{
+  return std::max<blas::integer>(300,(int)(ceil(2.0*n/std::max<blas::integer>(ncv,1))));
+}
+
+ARPACK::ARPACK(size_t _n, enum EigType _t, size_t _nev, size_t _ncv)
 {
 #ifdef COMPLEX
   static const char *whichs[6] = {"LM", "SM", "LR", "SR", "LI", "SI"};
@@ -69,30 +76,20 @@ ARPACK::ARPACK(size_t _n, enum EigType _t, size_t _nev)
     abort();
   }
 
-  // Tell the library we are just beginning
-  ido = 0;
-
-  // By default, random vector
-  info = 0;
+  // Initial residual vector, random by default (see restart())
   resid = new ELT_T[n];
 
   // Reserve space for the lanczos basis in which the eigenvectors are
-  // approximated.
-  ncv = std::min<blas::integer>(std::max<blas::integer>(2 * nev, 20), n);
+  // approximated. A size chosen by the user is bounded by the limits
+  // NEV + 2 <= NCV <= N of the nonsymmetric driver.
+  if (_ncv) {
+    ncv = std::min<blas::integer>(std::max<blas::integer>(_ncv, nev + 2), n);
+  } else {
+    ncv = std::min<blas::integer>(std::max<blas::integer>(2 * nev, 20), n);
+  }
   V = new ELT_T[n * ncv];
 
-  // Conservative estimate by Matlab
-
-  maxit = std::max<blas::integer>(300,(int)(ceil(2.0*n/std::max<blas::integer>(ncv,1))));
-
-  // Parameters for the algorithm: the (-1) in the index is to make it
-  // look like FORTRAN.
-  for (size_t i = 1; i < 12; i++)
-    iparam[i-1] = 0;
-  iparam[1-1] = 1;		// Shift produced by user
-  iparam[3-1] = maxit;	// Maximum number of iterations
-  iparam[4-1] = 1;		// Block size to be used in the recurrence
-  iparam[7-1] = 1;		// Standard eigenvalue problem
+  maxit = default_maxit(n, ncv);
 
   // Standard eigenvalue problem, A * x = lambda * x
   bmat = 'I';
@@ -108,6 +105,27 @@ ARPACK::ARPACK(size_t _n, enum EigType _t, size_t _nev)
   workl = new ELT_T[lworkl];
   workv = new ELT_T[lworkv];
   rwork = new double[ncv];
+
+  restart();
+}
+
+/* Prepare the object for a new problem of the same size, keeping the
+   workspaces, the tolerance and the maximum number of iterations. A start
+   vector has to be set again after this. */
+void ARPACK::restart() {
+  // Tell the library we are just beginning, with a random vector
+  ido = 0;
+  info = 0;
+  nconv = 0;
+
+  // Parameters for the algorithm: the (-1) in the index is to make it
+  // look like FORTRAN. ARPACK overwrites some of them on output.
+  for (size_t i = 1; i < 12; i++)
+    iparam[i-1] = 0;
+  iparam[1-1] = 1;		// Shift produced by user
+  iparam[3-1] = maxit;	// Maximum number of iterations
+  iparam[4-1] = 1;		// Block size to be used in the recurrence
+  iparam[7-1] = 1;		// Standard eigenvalue problem
   for (size_t i = 0; i < 15; i++)
     ipntr[i] = 0;
 
@@ -268,7 +286,8 @@ void ARPACK::set_maxiter(size_t new_maxiter) {
     std::cerr << "ARPACK:: Cannot change number of iterations while running\n";
     abort();
   }
-  maxit = new_maxiter;
+  // Zero restores the default
+  maxit = new_maxiter? (blas::integer)new_maxiter : default_maxit(n, ncv);
   iparam[2] = maxit;
 }
 
@@ -305,6 +324,183 @@ void ARPACK::set_y(const Tensor<ELT_T> &y)
   memcpy(get_y_vector(), y.begin(), sizeof(Tensor<ELT_T>::elt_t)*n);
 }
 
+/* The state of ARPACK's reverse communication routines between calls, in
+   the common blocks declared in arpackf.h. It is global, so it belongs to
+   the last object that called update(). */
+struct arpack_common {
+  double *reals;
+  size_t nreals;
+  blas::integer *integers;
+  size_t nintegers;
+};
+
+#ifdef COMPLEX
+static const arpack_common arpack_state[] = {
+  {NULL, 0, &F77_FUNC(znaups,ZNAUPS).bounds, 17},
+  {&F77_FUNC(znau2s,ZNAU2S).rnorm, 2, &F77_FUNC(znau2s,ZNAU2S).iter, 12},
+  {&F77_FUNC(znaits,ZNAITS).ovfl, 7, &F77_FUNC(znaits,ZNAITS).ierr, 13},
+  {&F77_FUNC(zgetvs,ZGETVS).rnorm0, 1, &F77_FUNC(zgetvs,ZGETVS).iseed[0], 9},
+  {NULL, 0, &F77_FUNC(timing,TIMING).nopx, 5}
+};
+#else
+static const arpack_common arpack_state[] = {
+  {NULL, 0, &F77_FUNC(dsaups,DSAUPS).bounds, 17},
+  {&F77_FUNC(dsau2s,DSAU2S).rnorm, 2, &F77_FUNC(dsau2s,DSAU2S).iter, 11},
+  {&F77_FUNC(dsaits,DSAITS).rnorm1, 3, &F77_FUNC(dsaits,DSAITS).ierr, 13},
+  {&F77_FUNC(dgetvs,DGETVS).rnorm0, 1, &F77_FUNC(dgetvs,DGETVS).iseed[0], 9},
+  {NULL, 0, &F77_FUNC(timing,TIMING).nopx, 5}
+};
+#endif
+static const size_t arpack_state_size =
+  sizeof(arpack_state) / sizeof(arpack_state[0]);
+
+static void
+arpack_state_sizes(size_t *nreals, size_t *nintegers)
+{
+  *nreals = *nintegers = 0;
+  for (size_t i = 0; i < arpack_state_size; i++) {
+    *nreals += arpack_state[i].nreals;
+    *nintegers += arpack_state[i].nintegers;
+  }
+}
+
+static RTensor
+integers_to_tensor(const blas::integer *p, size_t size)
+{
+  RTensor output(igen << size);
+  std::copy(p, p + size, output.begin());
+  return output;
+}
+
+static void
+tensor_to_integers(const RTensor &t, blas::integer *p, size_t size,
+                   const char *name)
+{
+  if (t.size() != (tensor::index)size) {
+    std::cerr << "ARPACK:: Checkpoint record " << name << " has "
+              << t.size() << " elements instead of " << size << std::endl;
+    abort();
+  }
+  for (size_t i = 0; i < size; i++)
+    p[i] = (blas::integer)t[i];
+}
+
+template<class elt_t>
+static void
+tensor_to_array(const Tensor<elt_t> &t, elt_t *p, size_t size,
+                const char *name)
+{
+  if (t.size() != (tensor::index)size) {
+    std::cerr << "ARPACK:: Checkpoint record " << name << " has "
+              << t.size() << " elements instead of " << size << std::endl;
+    abort();
+  }
+  std::copy(t.begin_const(), t.end_const(), p);
+}
+
+/* The checkpoint is a copy of the workspaces of this object together with
+   the state of the Fortran routines, so that update() continues exactly
+   where it stopped. */
+void ARPACK::save_checkpoint(sdf::OutDataFile &file) const {
+  if (status < Initialized || status > Finished) {
+    std::cerr << "ARPACK:: Cannot save a checkpoint of a failed computation\n";
+    abort();
+  }
+  size_t nreals, nintegers;
+  arpack_state_sizes(&nreals, &nintegers);
+  RTensor reals(igen << nreals), integers(igen << nintegers);
+  RTensor::iterator r = reals.begin(), k = integers.begin();
+  for (size_t i = 0; i < arpack_state_size; i++) {
+    r = std::copy(arpack_state[i].reals,
+                  arpack_state[i].reals + arpack_state[i].nreals, r);
+    k = std::copy(arpack_state[i].integers,
+                  arpack_state[i].integers + arpack_state[i].nintegers, k);
+  }
+  file.dump((size_t)n, "arpack_n");
+  file.dump((size_t)nev, "arpack_nev");
+  file.dump((size_t)ncv, "arpack_ncv");
+  file.dump((int)which_eig, "arpack_which");
+  file.dump(tol, "arpack_tol");
+  file.dump((size_t)maxit, "arpack_maxit");
+  file.dump((int)status, "arpack_status");
+  file.dump((int)ido, "arpack_ido");
+  file.dump((int)info, "arpack_info");
+  file.dump(integers_to_tensor(iparam, 12), "arpack_iparam");
+  file.dump(integers_to_tensor(ipntr, 15), "arpack_ipntr");
+  file.dump(Vector<ELT_T>(n, resid), "arpack_resid");
+  file.dump(Vector<ELT_T>(n * ncv, V), "arpack_v");
+  file.dump(Vector<ELT_T>(n * 3, workd), "arpack_workd");
+  file.dump(Vector<ELT_T>(lworkl, workl), "arpack_workl");
+  file.dump(Vector<double>(ncv, rwork), "arpack_rwork");
+  file.dump(reals, "arpack_common_reals");
+  file.dump(integers, "arpack_common_integers");
+}
+
+void ARPACK::load_checkpoint(sdf::InDataFile &file) {
+  if (status >= Running) {
+    std::cerr << "ARPACK:: Cannot load a checkpoint while running\n";
+    abort();
+  }
+  size_t other_n, other_nev, other_ncv, other_maxit;
+  int other_which, other_status, other_ido, other_info;
+  file.load(&other_n, "arpack_n");
+  file.load(&other_nev, "arpack_nev");
+  file.load(&other_ncv, "arpack_ncv");
+  file.load(&other_which, "arpack_which");
+  if (other_n != (size_t)n || other_nev != (size_t)nev ||
+      other_ncv != (size_t)ncv || other_which != (int)which_eig) {
+    std::cerr << "ARPACK:: Checkpoint for a problem with N=" << other_n
+              << ", NEV=" << other_nev << ", NCV=" << other_ncv
+              << ", WHICH=" << other_which
+              << " does not match N=" << n << ", NEV=" << nev
+              << ", NCV=" << ncv << ", WHICH=" << (int)which_eig << std::endl;
+    abort();
+  }
+  file.load(&tol, "arpack_tol");
+  file.load(&other_maxit, "arpack_maxit");
+  file.load(&other_status, "arpack_status");
+  file.load(&other_ido, "arpack_ido");
+  file.load(&other_info, "arpack_info");
+  maxit = other_maxit;
+  status = (Status)other_status;
+  ido = other_ido;
+  info = other_info;
+
+  RTensor integers, reals;
+  Tensor<ELT_T> data;
+  file.load(&integers, "arpack_iparam");
+  tensor_to_integers(integers, iparam, 12, "arpack_iparam");
+  file.load(&integers, "arpack_ipntr");
+  tensor_to_integers(integers, ipntr, 15, "arpack_ipntr");
+  file.load(&data, "arpack_resid");
+  tensor_to_array(data, resid, n, "arpack_resid");
+  file.load(&data, "arpack_v");
+  tensor_to_array(data, V, n * ncv, "arpack_v");
+  file.load(&data, "arpack_workd");
+  tensor_to_array(data, workd, n * 3, "arpack_workd");
+  file.load(&data, "arpack_workl");
+  tensor_to_array(data, workl, lworkl, "arpack_workl");
+  file.load(&reals, "arpack_rwork");
+  tensor_to_array(reals, rwork, ncv, "arpack_rwork");
+
+  size_t nreals, nintegers;
+  arpack_state_sizes(&nreals, &nintegers);
+  file.load(&reals, "arpack_common_reals");
+  file.load(&integers, "arpack_common_integers");
+  if (reals.size() != (tensor::index)nreals ||
+      integers.size() != (tensor::index)nintegers) {
+    std::cerr << "ARPACK:: Checkpoint does not match this ARPACK library\n";
+    abort();
+  }
+  RTensor::const_iterator r = reals.begin_const(), k = integers.begin_const();
+  for (size_t i = 0; i < arpack_state_size; i++) {
+    std::copy(r, r + arpack_state[i].nreals, arpack_state[i].reals);
+    r += arpack_state[i].nreals;
+    for (size_t j = 0; j < arpack_state[i].nintegers; j++)
+      arpack_state[i].integers[j] = (blas::integer)*(k++);
+  }
+}
+
 Indices
 ARPACK::sort_values(const CTensor &values, EigType t)
 {
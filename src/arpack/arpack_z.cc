@@ -18,6 +18,7 @@
 */
 
 #include <tensor/arpack_z.h>
+#include <tensor/sdf.h>
 #include "caupp.h"
 #include "ceupp.h"
 
@@ -56,6 +56,66 @@ extern "C"
     blas::integer mcaupd, mcaup2, mcaitr, mceigt, mcapps, mcgets, mceupd;
   } F77_FUNC(debug,DEBUG);
 
+  extern struct {
+    blas::integer nopx, nbx, nrorth, nitref, nrstrt;
+    float tsaupd, tsaup2, tsaitr, tseigt, tsgets, tsapps, tsconv;
+    float tnaupd, tnaup2, tnaitr, tneigh, tngets, tnapps, tnconv;
+    float tcaupd, tcaup2, tcaitr, tceigh, tcgets, tcapps, tcconv;
+    float tmvopx, tmvbx, tgetv0, titref, trvec;
+  } F77_FUNC(timing,TIMING);
+
+  /*
+   * State of the reverse communication routines between calls, which our
+   * copy of ARPACK keeps in common blocks instead of SAVE variables. Each
+   * block lists its double precision variables first, then its integers
+   * and logicals.
+   */
+  extern struct {
+    blas::integer bounds, ierr, ih, iq, ishift, iupd, iw, ldh, ldq;
+    blas::integer msglvl, mxiter, mode, nb, nev0, next, np, ritz;
+  } F77_FUNC(dsaups,DSAUPS);
+
+  extern struct {
+    double rnorm, eps23;
+    blas::integer iter, kplusp, msglvl, nconv, nev0, np0;
+    logical cnorm, getv0, initv, update, ushift;
+  } F77_FUNC(dsau2s,DSAU2S);
+
+  extern struct {
+    double rnorm1, safmin, wnorm;
+    blas::integer ierr, ipj, irj, ivj, iter, itry, j, msglvl;
+    logical orth1, orth2, rstart, step3, step4;
+  } F77_FUNC(dsaits,DSAITS);
+
+  extern struct {
+    double rnorm0;
+    blas::integer iseed[4], iter, msglvl;
+    logical first, seeded, orth;
+  } F77_FUNC(dgetvs,DGETVS);
+
+  extern struct {
+    blas::integer bounds, ih, iq, ishift, iupd, iw, ldh, ldq, levec;
+    blas::integer mode, msglvl, mxiter, nb, nev0, next, np, ritz;
+  } F77_FUNC(znaups,ZNAUPS);
+
+  extern struct {
+    double rnorm, eps23;
+    blas::integer iter, kplusp, msglvl, nconv, nevbef, nev0, np0;
+    logical cnorm, getv0, initv, update, ushift;
+  } F77_FUNC(znau2s,ZNAU2S);
+
+  extern struct {
+    double ovfl, betaj, rnorm1, smlnum, ulp, unfl, wnorm;
+    blas::integer ierr, ipj, irj, ivj, iter, itry, j, msglvl;
+    logical orth1, orth2, rstart, step3, step4;
+  } F77_FUNC(znaits,ZNAITS);
+
+  extern struct {
+    double rnorm0;
+    blas::integer iseed[4], iter, msglvl;
+    logical first, seeded, orth;
+  } F77_FUNC(zgetvs,ZGETVS);
+
 
   // double precision symmetric routines.
 
@@ -68,7 +68,7 @@ namespace linalg {
       data.set_start_vector(eigenvectors->begin_const());
 
     while (data.update() < RArpack::Finished) {
-      data.set_y((*A)(data.get_x()));
+      A->apply(n, data.get_x_vector(), data.get_y_vector());
     }
     if (data.get_status() == RArpack::Finished) {
       if (converged)
@@ -0,0 +1,184 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#ifndef TENSOR_ARPACK_EIGS_SOLVER_HPP
+#define TENSOR_ARPACK_EIGS_SOLVER_HPP
+
+#include <tensor/linalg.h>
+#include <tensor/arpack.h>
+#include <tensor/sdf.h>
+
+namespace linalg {
+
+  using namespace tensor;
+
+  template<class Tensor>
+  EigsSolver<Tensor>::EigsSolver(size_t n, int eig_type, size_t neig,
+                                 size_t ncv) :
+    n_(n), neig_(neig), ncv_(ncv), maxit_(0), matvecs_(0),
+    eig_type_(eig_type), tol_(0.0), warm_(true), arpack_(NULL), previous_(),
+    checkpoint_(), checkpoint_every_(0)
+  {
+    if (neig > n || neig == 0) {
+      std::cerr << "In EigsSolver(): Can only compute up to " << n
+                << " eigenvalues\nin a matrix that has " << n << " times "
+                << n << " elements.";
+      abort();
+    }
+  }
+
+  template<class Tensor>
+  EigsSolver<Tensor>::~EigsSolver()
+  {
+    delete arpack_;
+  }
+
+  template<class Tensor>
+  void
+  EigsSolver<Tensor>::set_ncv(size_t ncv)
+  {
+    if (ncv != ncv_) {
+      ncv_ = ncv;
+      delete arpack_;
+      arpack_ = NULL;
+    }
+  }
+
+  template<class Tensor>
+  void
+  EigsSolver<Tensor>::set_tolerance(double tol)
+  {
+    tol_ = tol;
+  }
+
+  template<class Tensor>
+  void
+  EigsSolver<Tensor>::set_maxiter(size_t maxiter)
+  {
+    maxit_ = maxiter;
+  }
+
+  template<class Tensor>
+  void
+  EigsSolver<Tensor>::set_checkpoint(const std::string &filename,
+                                     size_t matvecs)
+  {
+    checkpoint_ = filename;
+    checkpoint_every_ = filename.size()? matvecs : 0;
+  }
+
+  template<class Tensor>
+  const Tensor
+  EigsSolver<Tensor>::solve(const Tensor &A, Tensor *vectors, bool *converged)
+  {
+    if ((A.rank() != 2) || (A.rows() != n_) || (A.columns() != n_)) {
+      std::cerr << "In EigsSolver::solve(): the matrix does not have the size "
+                << n_ << " x " << n_ << " of the solver.";
+      abort();
+    }
+    return solve(MatrixMap<Tensor>(A), vectors, converged);
+  }
+
+  template<class Tensor>
+  const Tensor
+  EigsSolver<Tensor>::solve(const Sparse<elt_t> &A, Tensor *vectors,
+                            bool *converged)
+  {
+    if ((A.rows() != n_) || (A.columns() != n_)) {
+      std::cerr << "In EigsSolver::solve(): the matrix does not have the size "
+                << n_ << " x " << n_ << " of the solver.";
+      abort();
+    }
+    return solve(MatrixMap<Sparse<elt_t> >(A), vectors, converged);
+  }
+
+  template<class Tensor>
+  const Tensor
+  EigsSolver<Tensor>::solve(const Map<Tensor> &A, Tensor *vectors,
+                            bool *converged)
+  {
+    matvecs_ = 0;
+    if (n_ <= 4) {
+      // Same dense fallback as do_eigs(), which ARPACK needs for these sizes
+      return do_eigs(&A, n_, eig_type_, neig_, vectors, converged);
+    }
+    if (arpack_) {
+      arpack_->restart();
+    } else {
+      arpack_ = new Arpack<Tensor>(n_, (EigType)eig_type_, neig_, ncv_);
+    }
+    arpack_->set_tolerance(tol_);
+    arpack_->set_maxiter(maxit_);
+    //
+    // The start vector is the one provided by the user or, otherwise, the
+    // sum of the previous Ritz vectors, which has support on all of them.
+    //
+    if (vectors && vectors->size() >= n_) {
+      arpack_->set_start_vector(vectors->begin_const());
+    } else if (warm_ && previous_.size()) {
+      Tensor v = Tensor::zeros(igen << n_);
+      elt_t *pv = v.begin();
+      const elt_t *pp = previous_.begin_const();
+      for (tensor::index j = 0; j < neig_; j++)
+        for (tensor::index i = 0; i < n_; i++)
+          pv[i] += *(pp++);
+      arpack_->set_start_vector(pv);
+    }
+    //
+    // An existing checkpoint takes precedence over all of the above.
+    //
+    if (checkpoint_.size() && sdf::file_exists(checkpoint_)) {
+      sdf::InDataFile file(checkpoint_);
+      arpack_->load_checkpoint(file);
+    }
+    while (arpack_->update() < Arpack<Tensor>::Finished) {
+      A.apply(n_, arpack_->get_x_vector(), arpack_->get_y_vector());
+      matvecs_++;
+      if (checkpoint_every_ && (matvecs_ % checkpoint_every_ == 0)) {
+        sdf::OutDataFile file(checkpoint_, sdf::DataFile::SDF_PARANOID);
+        arpack_->save_checkpoint(file);
+      }
+    }
+    if (arpack_->get_status() == Arpack<Tensor>::Finished) {
+      if (checkpoint_.size())
+        sdf::delete_file(checkpoint_);
+      if (converged)
+        *converged = true;
+      Tensor V;
+      Tensor values = arpack_->get_data((vectors || warm_)? &V : NULL);
+      if (warm_)
+        previous_ = V;
+      if (vectors)
+        *vectors = V;
+      return values;
+    } else {
+      std::cerr << "eigs: " << arpack_->error_message() << '\n';
+      previous_ = Tensor();
+      if (converged) {
+        *converged = false;
+        return Tensor::zeros(igen << neig_);
+      } else {
+        abort();
+      }
+    }
+  }
+
+} // namespace linalg
+
+#endif // TENSOR_ARPACK_EIGS_SOLVER_HPP
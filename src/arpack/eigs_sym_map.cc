@@ -0,0 +1,65 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+//----------------------------------------------------------------------
+// SELECTION OF THE SOLVER FOR SYMMETRIC EIGENVALUE PROBLEMS
+//
+
+#include <tensor/linalg.h>
+
+namespace linalg {
+
+  static int eigs_sym_backend = EigsArpack;
+
+  /**Select the algorithm used by eigs_sym() on sparse matrices and linear
+     maps. It returns the previous choice. */
+  int
+  set_eigs_sym_backend(int backend)
+  {
+    if (backend != EigsArpack && backend != EigsLanczos) {
+      std::cerr << "In set_eigs_sym_backend(), unknown backend " << backend
+                << std::endl;
+      abort();
+    }
+    int output = eigs_sym_backend;
+    eigs_sym_backend = backend;
+    return output;
+  }
+
+  RTensor
+  do_eigs_sym(const Map<RTensor> *A, size_t dims, int eig_type, size_t neig,
+              RTensor *vectors, bool *converged)
+  {
+    if (eigs_sym_backend == EigsLanczos)
+      return do_eigs_lanczos(A, dims, eig_type, neig, vectors, converged);
+    return do_eigs(A, dims, eig_type, neig, vectors, converged);
+  }
+
+  /* The complex ARPACK driver is the nonsymmetric one: the eigenvalues of a
+     hermitian map are real, and we drop the imaginary parts. */
+  RTensor
+  do_eigs_sym(const Map<CTensor> *A, size_t dims, int eig_type, size_t neig,
+              CTensor *vectors, bool *converged)
+  {
+    if (eigs_sym_backend == EigsLanczos)
+      return do_eigs_lanczos(A, dims, eig_type, neig, vectors, converged);
+    return tensor::real(do_eigs(A, dims, eig_type, neig, vectors, converged));
+  }
+
+} // namespace linalg
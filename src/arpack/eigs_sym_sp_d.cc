@@ -17,48 +17,33 @@
     51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
 */
 
-#include <tensor/linalg.h>
-#include <tensor/arpack.h>
-
-RTensor
-eigs_sym(const RSparse &A, RArpack::EigType t, size_t neig, RTensor *eigenvectors,
-	 const RTensor::elt_t *initial_guess)
-{
-    size_t n = A.columns();
-#ifdef COMPLEX
-    size_t ndouble = 2*n;
-#else
-    size_t ndouble = n;
-#endif
-
-    if (n <= 10) {
-	return eigs_sym(full(A), t, neig, eigenvectors, initial_guess);
-    }
+//----------------------------------------------------------------------
+// ARPACK DRIVER FOR SYMMETRIC REAL SPARSE EIGENVALUE PROBLEMS
+//
 
-    if (A.rows() != n) {
-	std::cerr << "In eigs(): Can only compute eigenvalues of square matrices.";
-	myabort();
-    }
-
-    RArpack data(ndouble, t, neig);
-
-    if (initial_guess)
-	data.set_start_vector((const double *)initial_guess);
+#include <tensor/linalg.h>
 
-    size_t bytes = ndouble * sizeof(double);
-    while (data.update() < RArpack::Finished) {
-	RTensor x(n, (RTensor::elt_t *)data.get_x_vector());
-	RTensor y = mmult(A, x);
-	memcpy(data.get_y_vector(), (const double *)x.pointer(), bytes);
-    }
-    if (data.get_status() == RArpack::Finished) {
-	if (eigenvectors) {
-	    *eigenvectors = RTensor(n, neig);
-	}
-	return data.get_data((double *)eigenvectors->pointer());
-    } else {
-	std::cerr << data.error_message() << '\n';
-	myabort();
-    }
-    return RTensor();
-}
+namespace linalg {
+
+  /**Find out a few eigenvalues and eigenvectors of a symmetric real sparse
+     matrix. With the ARPACK backend this is equivalent to eigs(), because
+     RArpack is already based on the symmetric Lanczos driver. */
+  RTensor
+  eigs_sym(const RSparse &A, int eig_type, size_t neig, RTensor *eigenvectors,
+           bool *converged)
+  {
+    return do_eigs_sym(new tensor::MatrixMap<RSparse>(A), A.columns(), eig_type, neig,
+                   eigenvectors, converged);
+  }
+
+  /**Find out a few eigenvalues and eigenvectors of a symmetric real sparse
+     matrix that only stores its upper triangle. */
+  RTensor
+  eigs_sym(const RSymSparse &A, int eig_type, size_t neig, RTensor *eigenvectors,
+           bool *converged)
+  {
+    return do_eigs_sym(new tensor::MatrixMap<RSymSparse>(A), A.columns(), eig_type, neig,
+                   eigenvectors, converged);
+  }
+
+} // namespace linalg
@@ -17,48 +17,32 @@
     51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
 */
 
-#include <tensor/linalg.h>
-#include <tensor/arpack.h>
-
-RTensor
-eigs_sym(const CSparse &A, RArpack::EigType t, size_t neig, CTensor *eigenvectors,
-	 const CTensor::elt_t *initial_guess)
-{
-    size_t n = A.columns();
-#ifdef COMPLEX
-    size_t ndouble = 2*n;
-#else
-    size_t ndouble = n;
-#endif
-
-    if (n <= 10) {
-	return eigs_sym(full(A), t, neig, eigenvectors, initial_guess);
-    }
+//----------------------------------------------------------------------
+// ARPACK DRIVER FOR HERMITIAN COMPLEX SPARSE EIGENVALUE PROBLEMS
+//
 
-    if (A.rows() != n) {
-	std::cerr << "In eigs(): Can only compute eigenvalues of square matrices.";
-	myabort();
-    }
-
-    RArpack data(ndouble, t, neig);
-
-    if (initial_guess)
-	data.set_start_vector((const double *)initial_guess);
+#include <tensor/linalg.h>
 
-    size_t bytes = ndouble * sizeof(double);
-    while (data.update() < RArpack::Finished) {
-	CTensor x(n, (CTensor::elt_t *)data.get_x_vector());
-	CTensor y = mmult(A, x);
-	memcpy(data.get_y_vector(), (const double *)x.pointer(), bytes);
-    }
-    if (data.get_status() == RArpack::Finished) {
-	if (eigenvectors) {
-	    *eigenvectors = CTensor(n, neig);
-	}
-	return data.get_data((double *)eigenvectors->pointer());
-    } else {
-	std::cerr << data.error_message() << '\n';
-	myabort();
-    }
-    return RTensor();
-}
+namespace linalg {
+
+  /**Find out a few eigenvalues and eigenvectors of a hermitian complex sparse
+     matrix. */
+  RTensor
+  eigs_sym(const CSparse &A, int eig_type, size_t neig, CTensor *eigenvectors,
+           bool *converged)
+  {
+    return do_eigs_sym(new tensor::MatrixMap<CSparse>(A), A.columns(),
+                       eig_type, neig, eigenvectors, converged);
+  }
+
+  /**Find out a few eigenvalues and eigenvectors of a hermitian complex sparse
+     matrix that only stores its upper triangle. */
+  RTensor
+  eigs_sym(const CSymSparse &A, int eig_type, size_t neig, CTensor *eigenvectors,
+           bool *converged)
+  {
+    return do_eigs_sym(new tensor::MatrixMap<CSymSparse>(A), A.columns(),
+                       eig_type, neig, eigenvectors, converged);
+  }
+
+} // namespace linalg
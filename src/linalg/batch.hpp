@@ -0,0 +1,189 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <vector>
+#include <algorithm>
+#include <tensor/tensor.h>
+#include <tensor/linalg.h>
+#include "svd.hpp"
+#include "eig_sym.hpp"
+#include "factorizations.hpp"
+
+namespace linalg {
+
+  /* Cost estimate of one problem and its position in the batch. */
+  struct BatchProblem {
+    double cost;
+    tensor::index position;
+  };
+
+  static inline bool
+  batch_larger(const BatchProblem &a, const BatchProblem &b)
+  {
+    return a.cost > b.cost;
+  }
+
+  /* Order in which the problems of a batch are processed: largest first,
+   * according to the cost of a dense factorization, m n min(m,n), so that
+   * with dynamic scheduling the threads end with the smallest problems and
+   * finish at about the same time. */
+  template<class Tensor>
+  static std::vector<tensor::index>
+  batch_order(const std::vector<Tensor> &A)
+  {
+    std::vector<BatchProblem> problems(A.size());
+    for (size_t i = 0; i < A.size(); i++) {
+      double m = A[i].rows(), n = A[i].columns();
+      problems[i].cost = m * n * std::min(m, n);
+      problems[i].position = i;
+    }
+    std::stable_sort(problems.begin(), problems.end(), batch_larger);
+    std::vector<tensor::index> output(A.size());
+    for (size_t i = 0; i < A.size(); i++)
+      output[i] = problems[i].position;
+    return output;
+  }
+
+  /* Private copies of the input matrices, which LAPACK overwrites. Tensor
+   * reference counts are not thread safe, so tensors that may share their
+   * data are only copied, or released, outside parallel regions. */
+  template<class Tensor>
+  static std::vector<Tensor>
+  batch_copy(const std::vector<Tensor> &A)
+  {
+    std::vector<Tensor> output(A);
+    for (size_t i = 0; i < output.size(); i++)
+      output[i].begin();
+    return output;
+  }
+
+  template<class Tensor>
+  static void
+  batch_prepare_output(std::vector<Tensor> *output, size_t size)
+  {
+    if (output) {
+      output->clear();
+      output->resize(size);
+    }
+  }
+
+  template<class Tensor>
+  static std::vector<RTensor>
+  do_svd_batch(const std::vector<Tensor> &A, std::vector<Tensor> *U,
+               std::vector<Tensor> *VT, bool economic)
+  {
+    tensor::index N = A.size();
+    std::vector<tensor::index> order = batch_order(A);
+    std::vector<Tensor> work = batch_copy(A);
+    std::vector<RTensor> s(N);
+    batch_prepare_output(U, N);
+    batch_prepare_output(VT, N);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+      LapackBuffers buffers;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+      for (tensor::index k = 0; k < N; k++) {
+        tensor::index i = order[k];
+        s[i] = svd_driver(work[i], U? &(*U)[i] : 0, VT? &(*VT)[i] : 0,
+                          economic, 0, svd_algorithm, &buffers);
+      }
+    }
+    return s;
+  }
+
+  template<class Tensor>
+  static std::vector<RTensor>
+  do_eig_sym_batch(const std::vector<Tensor> &A, std::vector<Tensor> *V)
+  {
+    tensor::index N = A.size();
+    std::vector<tensor::index> order = batch_order(A);
+    std::vector<Tensor> work = batch_copy(A);
+    std::vector<RTensor> w(N);
+    batch_prepare_output(V, N);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+      LapackBuffers buffers;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+      for (tensor::index k = 0; k < N; k++) {
+        tensor::index i = order[k];
+        w[i] = eig_sym_driver(work[i], V? &(*V)[i] : 0, eig_sym_algorithm,
+                              'A', 0.0, 0.0, 0, 0, &buffers);
+      }
+    }
+    return w;
+  }
+
+  template<class Tensor>
+  static std::vector<Tensor>
+  do_solve_batch(const std::vector<Tensor> &A, const std::vector<Tensor> &B)
+  {
+    tensor::index N = A.size();
+    if ((tensor::index)B.size() != N) {
+      std::cerr << "In solve_batch(A, B), there are " << N << " matrices but "
+                << B.size() << " right hand sides." << std::endl;
+      abort();
+    }
+    for (tensor::index i = 0; i < N; i++) {
+      integer n = factor_check_square(A[i], "solve_batch");
+      if (B[i].rank() == 0 || (integer)B[i].dimension(0) != n) {
+        std::cerr << "In solve_batch(A, B), the right hand side " << i
+                  << " has dimensions " << B[i].dimensions()
+                  << ", which do not match a matrix with " << n << " rows."
+                  << std::endl;
+        abort();
+      }
+    }
+    std::vector<tensor::index> order = batch_order(A);
+    std::vector<Tensor> work = batch_copy(A);
+    std::vector<Tensor> X = batch_copy(B);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+      LapackBuffers buffers;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+      for (tensor::index k = 0; k < N; k++) {
+        tensor::index i = order[k];
+        integer n = work[i].rows();
+        integer nrhs = X[i].size() / n;
+        integer *ipiv = lapack_iwork(&buffers, n), info;
+        factor_getrf(n, tensor_pointer(work[i]), ipiv, &info);
+        if (info) {
+          std::cerr << "In solve_batch(A, B), matrix " << i
+                    << " is singular." << std::endl;
+          abort();
+        }
+        factor_getrs(n, nrhs, tensor_pointer(work[i]), ipiv,
+                     tensor_pointer(X[i]), &info);
+      }
+    }
+    return X;
+  }
+
+} // namespace linalg
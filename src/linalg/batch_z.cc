@@ -0,0 +1,67 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include "batch.hpp"
+
+namespace linalg {
+
+  /**Singular value decompositions of a batch of complex matrices.
+
+     Computes svd(A[i], &(*U)[i], &(*VT)[i], economic) for every matrix in
+     \c A, and returns the vectors of singular values. The matrices are
+     distributed over the OpenMP threads, largest first, and each thread
+     reuses its LAPACK work arrays for all the matrices it processes. This
+     is much faster than a loop of svd() calls over many small matrices.
+
+     \ingroup Linalg
+  */
+  std::vector<RTensor>
+  svd_batch(const std::vector<CTensor> &A, std::vector<CTensor> *U,
+            std::vector<CTensor> *VT, bool economic)
+  {
+    return do_svd_batch(A, U, VT, economic);
+  }
+
+  /**Eigenvalue decompositions of a batch of Hermitian matrices.
+
+     Computes eig_sym(A[i], &(*V)[i]) for every matrix in \c A, with the
+     same distribution over threads as svd_batch().
+
+     \ingroup Linalg
+  */
+  std::vector<RTensor>
+  eig_sym_batch(const std::vector<CTensor> &A, std::vector<CTensor> *V)
+  {
+    return do_eig_sym_batch(A, V);
+  }
+
+  /**Solutions of a batch of complex linear systems of equations.
+
+     Computes solve(A[i], B[i]) for every pair of matrices, with the same
+     distribution over threads as svd_batch().
+
+     \ingroup Linalg
+  */
+  std::vector<CTensor>
+  solve_batch(const std::vector<CTensor> &A, const std::vector<CTensor> &B)
+  {
+    return do_solve_batch(A, B);
+  }
+
+} // namespace linalg
@@ -17,7 +17,10 @@
     51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
 */
 
+#include <vector>
+#include <algorithm>
 #include <tensor/tensor.h>
+#include <tensor/sparse.h>
 #include <tensor/io.h>
 #include <tensor/linalg.h>
 #include "find_blocks.hpp"
@@ -26,81 +29,221 @@ namespace linalg {
 
   using tensor::index;
 
-  template<class Tensor>
+  /* A singular value of one block, with its position in that block. */
+  struct BlockSvdValue {
+    double s;
+    index block, j;
+  };
+
+  static inline bool
+  block_svd_greater(const BlockSvdValue &a, const BlockSvdValue &b)
+  {
+    return a.s > b.s;
+  }
+
+  template<typename elt_t>
+  static inline const tensor::Tensor<elt_t> &
+  block_svd_full(const tensor::Tensor<elt_t> &A)
+  {
+    return A;
+  }
+
+  template<typename elt_t>
+  static inline const tensor::Tensor<elt_t>
+  block_svd_full(const Sparse<elt_t> &A)
+  {
+    return full(A);
+  }
+
+  /* Copy block 'b' of a dense matrix into 'm', an array of size
+   * rows.size() x cols.size() in column-major order. The block and
+   * position of each column are only needed by the sparse version. */
+  template<typename elt_t>
+  static void
+  block_svd_extract(const tensor::Tensor<elt_t> &A, index,
+                    const Indices &rows, const Indices &cols,
+                    const std::vector<index> &,
+                    const std::vector<index> &, elt_t *m)
+  {
+    const elt_t *a = A.begin_const();
+    index lda = A.rows();
+    index r = rows.size(), c = cols.size();
+    const index *prow = rows.begin_const(), *pcol = cols.begin_const();
+    for (index j = 0; j < c; j++) {
+      const elt_t *aj = a + lda * pcol[j];
+      for (index i = 0; i < r; i++)
+        *(m++) = aj[prow[i]];
+    }
+  }
+
+  /* Same for a sparse matrix: only the stored elements of the block rows
+   * are visited and scattered to their positions in the block. */
+  template<typename elt_t>
+  static void
+  block_svd_extract(const Sparse<elt_t> &A, index b,
+                    const Indices &rows, const Indices &cols,
+                    const std::vector<index> &col_block,
+                    const std::vector<index> &col_pos, elt_t *m)
+  {
+    const index *row_start = A.priv_row_start().begin_const();
+    const index *column = A.priv_column().begin_const();
+    const elt_t *data = A.priv_data().begin_const();
+    index r = rows.size();
+    const index *prow = rows.begin_const();
+    std::fill(m, m + r * cols.size(), number_zero<elt_t>());
+    for (index i = 0; i < r; i++) {
+      index row = prow[i];
+      for (index k = row_start[row]; k < row_start[row + 1]; k++) {
+        index c = column[k];
+        if (col_block[c] == b)
+          m[i + r * col_pos[c]] = data[k];
+      }
+    }
+  }
+
+  /* Singular value decomposition of a matrix that, after reordering rows
+   * and columns, is block diagonal. The blocks are decomposed independently
+   * and in parallel, and their singular vectors are written directly to
+   * their final positions in U and VT, sorted by decreasing singular value.
+   * Singular vectors of empty rows and columns, and those of the blocks
+   * that are not paired with a singular value, complete U and VT to
+   * unitary matrices. */
+  template<class Tensor, class Matrix>
   RTensor
-  do_block_svd(const Tensor &A, Tensor *pU, Tensor *pVT, bool economic)
+  do_block_svd(const Matrix &A, Tensor *pU, Tensor *pVT, bool economic)
   {
+    typedef typename Tensor::elt_t elt_t;
     index rows = A.rows();
     index cols = A.columns();
-    if (rows != cols && !economic)
-      return svd(A, pU, pVT, economic);
     index minrc = std::min(rows, cols);
 
     index nblocks;
     Indices *block_rows, *block_cols;
-    if (!find_blocks<Tensor>(A, &nblocks, &block_rows, &block_cols)) {
-      return svd(A, pU, pVT, economic);
+    if (!find_blocks(A, &nblocks, &block_rows, &block_cols)) {
+      return svd(block_svd_full(A), pU, pVT, economic);
+    }
+
+    const index none = ~(index)0;
+    std::vector<index> col_block(cols, none), col_pos(cols, 0);
+    std::vector<bool> used_row(rows, false);
+    index K = 0;
+    for (index b = 0; b < nblocks; b++) {
+      for (index j = 0; j < block_cols[b].size(); j++) {
+        index c = block_cols[b][j];
+        col_block[c] = b;
+        col_pos[c] = j;
+      }
+      for (index i = 0; i < block_rows[b].size(); i++)
+        used_row[block_rows[b][i]] = true;
+      K += std::min(block_rows[b].size(), block_cols[b].size());
+    }
+
+    // Number of columns of U and rows of VT. If there are fewer singular
+    // values than that, we need the full decomposition of each block to
+    // complete the bases.
+    index ucols = economic? minrc : rows;
+    index vrows = economic? minrc : cols;
+    bool full_blocks = (pU && ucols > K) || (pVT && vrows > K);
+
+    std::vector<RTensor> sb(nblocks);
+    std::vector<Tensor> Ub(nblocks), Vb(nblocks);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (index b = 0; b < nblocks; b++) {
+      index r = block_rows[b].size();
+      index c = block_cols[b].size();
+      Tensor m(r, c);
+      block_svd_extract(A, b, block_rows[b], block_cols[b],
+                        col_block, col_pos, m.begin());
+      if (r * c == 1) {
+        double aux = abs(m[0]);
+        sb[b] = RTensor(igen << 1);
+        sb[b].at(0) = aux;
+        if (pU) Ub[b] = Tensor::ones(1, 1);
+        if (pVT) Vb[b] = m / aux;
+      } else {
+        sb[b] = svd(m, pU? &Ub[b] : 0, pVT? &Vb[b] : 0, !full_blocks);
+      }
     }
 
-    if ((nblocks == 1) &&
-	(block_rows[0].size() >= rows/2) &&
-	(block_cols[0].size() >= cols/2)) {
-      RTensor s = svd(A, pU, pVT, economic);
-      delete[] block_rows;
-      delete[] block_cols;
-      return s;
+    std::vector<BlockSvdValue> values;
+    values.reserve(K);
+    for (index b = 0; b < nblocks; b++) {
+      for (index j = 0; j < sb[b].size(); j++) {
+        BlockSvdValue v = { sb[b][j], b, j };
+        values.push_back(v);
+      }
     }
+    std::stable_sort(values.begin(), values.end(), block_svd_greater);
 
-    RTensor s(minrc);
+    RTensor s(igen << minrc);
     s.fill_with_zeros();
+    double *ps = s.begin();
+    // Destination column of U and row of VT for each singular vector of
+    // each block, or 'none' if it is not needed.
+    std::vector<std::vector<index> > udest(nblocks), vdest(nblocks);
+    for (index b = 0; b < nblocks; b++) {
+      if (pU) udest[b].assign(Ub[b].columns(), none);
+      if (pVT) vdest[b].assign(Vb[b].rows(), none);
+    }
+    for (index p = 0; p < K; p++) {
+      const BlockSvdValue &v = values[p];
+      ps[p] = v.s;
+      if (pU) udest[v.block][v.j] = p;
+      if (pVT) vdest[v.block][v.j] = p;
+    }
+    index unext = K, vnext = K;
+    for (index b = 0; b < nblocks; b++) {
+      for (index j = sb[b].size(); pU && j < Ub[b].columns(); j++)
+        if (unext < ucols) udest[b][j] = unext++;
+      for (index j = sb[b].size(); pVT && j < Vb[b].rows(); j++)
+        if (vnext < vrows) vdest[b][j] = vnext++;
+    }
+
+    elt_t *pu = 0, *pvt = 0;
     if (pU) {
-      *pU = Tensor::zeros(rows, economic? minrc : rows);
+      *pU = Tensor::zeros(rows, ucols);
+      pu = pU->begin();
+      for (index i = 0; i < rows && unext < ucols; i++)
+        if (!used_row[i]) pu[i + rows * (unext++)] = number_one<elt_t>();
     }
     if (pVT) {
-      *pVT = Tensor::zeros(economic? minrc : cols, cols);
+      *pVT = Tensor::zeros(vrows, cols);
+      pvt = pVT->begin();
+      for (index i = 0; i < cols && vnext < vrows; i++)
+        if (col_block[i] == none) pvt[(vnext++) + vrows * i] = number_one<elt_t>();
     }
-
-    RTensor stemp;
-    Tensor Utemp, Vtemp;
-    Tensor *pUtemp = pU? &Utemp : 0;
-    Tensor *pVtemp = pVT? &Vtemp : 0;
-    for (index b = 0, sndx = 0; b < nblocks; b++) {
-      Tensor m = A(range(block_rows[b]), range(block_cols[b]));
-      index n = m.size();
-      if (m.size() > 1) {
-	stemp = svd(m, pUtemp, pVtemp, economic);
-        index slast = sndx + stemp.size() - 1;
-	s.at(range(sndx, slast)) = stemp;
-	if (pU) {
-          (*pU).at(range(block_rows[b]), range(sndx, slast)) = Utemp;
-	}
-	if (pVT) {
-          (*pVT).at(range(sndx, slast), range(block_cols[b])) = Vtemp;
-	}
-        sndx = slast + 1;
-      } else {
-	index row = block_rows[b][0];
-	index col = block_cols[b][0];
-	double aux = abs(m[0]);
-	s.at(sndx) = aux;
-	if (pU) {
-	  (*pU).at(row,sndx) = 1.0;
-	}
-	if (pVT) {
-	  (*pVT).at(sndx,col) = m[0]/aux;
-	}
-	++sndx;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (index b = 0; b < nblocks; b++) {
+      if (pu) {
+        index r = block_rows[b].size();
+        const index *prow = block_rows[b].begin_const();
+        const elt_t *u = Ub[b].begin_const();
+        for (index j = 0; j < (index)udest[b].size(); j++, u += r) {
+          index p = udest[b][j];
+          if (p != none)
+            for (index i = 0; i < r; i++)
+              pu[prow[i] + rows * p] = u[i];
+        }
+      }
+      if (pvt) {
+        index c = block_cols[b].size();
+        index ldv = Vb[b].rows();
+        const index *pcol = block_cols[b].begin_const();
+        const elt_t *v = Vb[b].begin_const();
+        for (index j = 0; j < ldv; j++) {
+          index p = vdest[b][j];
+          if (p != none)
+            for (index i = 0; i < c; i++)
+              pvt[p + vrows * pcol[i]] = v[j + ldv * i];
+        }
       }
     }
     delete[] block_rows;
     delete[] block_cols;
-
-    Indices ndx = sort_indices(s, true);
-    s = s(range(ndx));
-    if (pU)
-      *pU = (*pU)(range(), range(ndx));
-    if (pVT)
-      *pVT = (*pVT)(range(ndx), range());
     return s;
   }
 
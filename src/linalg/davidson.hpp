@@ -0,0 +1,250 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <cfloat>
+#include <cmath>
+#include <algorithm>
+#include <tensor/tensor.h>
+#include <tensor/sparse.h>
+#include <tensor/linalg.h>
+#include "eigs_lanczos.hpp"
+
+namespace linalg {
+
+  using namespace tensor;
+
+  /* Diagonal of a sparse matrix, which we use as preconditioner. */
+  template<typename elt_t>
+  static RTensor
+  davidson_diagonal(const Sparse<elt_t> &A)
+  {
+    tensor::index n = A.rows();
+    if (n != A.columns()) {
+      std::cerr << "In davidson(), the matrix is not square but has "
+                << A.rows() << " rows and " << A.columns() << " columns.\n";
+      abort();
+    }
+    const tensor::index *row_start = A.priv_row_start().begin_const();
+    const tensor::index *column = A.priv_column().begin_const();
+    const elt_t *data = A.priv_data().begin_const();
+    RTensor output = RTensor::zeros(igen << n);
+    for (tensor::index r = 0; r < n; r++) {
+      for (tensor::index j = row_start[r]; j < row_start[r+1]; j++) {
+        if (column[j] == r) {
+          output.at(r) = real(data[j]);
+          break;
+        }
+      }
+    }
+    return output;
+  }
+
+  /* Orthogonalize 'w' against the first 'k' columns of 'V' and, if it is
+   * not linearly dependent on them, append it as column 'k' of the basis
+   * together with its image under 'A' and the new column of the projected
+   * matrix 'H' (of leading dimension 'm'). Returns true if the vector was
+   * added. */
+  template<typename elt_t>
+  static bool
+  davidson_extend(const Map<Tensor<elt_t> > *A, tensor::index n, tensor::index k,
+                  tensor::index m, elt_t *V, elt_t *AV, elt_t *H, elt_t *w,
+                  size_t *matvecs)
+  {
+    const elt_t one = number_one<elt_t>(), zero = number_zero<elt_t>();
+    double norm = lanczos_norm(n, w);
+    if (norm == 0)
+      return false;
+    double new_norm = lanczos_orthogonalize(n, k, V, w, H + k * m, norm);
+    if (new_norm <= 1e-8 * norm)
+      return false;
+    elt_t *v = V + k * n, *Av = AV + k * n;
+    for (tensor::index i = 0; i < n; i++)
+      v[i] = w[i] / new_norm;
+    A->apply(n, v, Av);
+    ++*matvecs;
+    elt_t *h = H + k * m;
+    blas::gemv('C', n, k + 1, one, V, n, Av, 1, zero, h, 1);
+    h[k] = real(h[k]);
+    for (tensor::index i = 0; i < k; i++)
+      H[i * m + k] = ::tensor::conj(h[i]);
+    return true;
+  }
+
+  /* Davidson method with diagonal preconditioning (E. R. Davidson,
+   * J. Comput. Phys. 17, 87 (1975)), in its block form for several of the
+   * lowest eigenvalues. The basis V grows with one correction vector
+   * (theta - D)^{-1} (r - e x) per unconverged Ritz pair, where D is the
+   * diagonal of the operator and 'e' makes the correction orthogonal to the
+   * Ritz vector x (J. Olsen et al, Chem. Phys. Lett. 169, 463 (1990)); without
+   * it the correction is almost parallel to x when D is a good approximation
+   * of the operator. When the basis would exceed 'max_subspace' columns
+   * it is contracted to the best Ritz vectors (thick restart); since we
+   * also keep their images AV, restarting costs no matrix-vector
+   * products. */
+  template<typename elt_t>
+  RTensor
+  davidson_loop(const Map<Tensor<elt_t> > *A, const RTensor &diagonal, size_t nev,
+                Tensor<elt_t> *vectors, bool *converged, double tol,
+                size_t max_subspace, size_t *matvecs)
+  {
+    const elt_t one = number_one<elt_t>(), zero = number_zero<elt_t>();
+    tensor::index n = diagonal.size(), k = nev;
+    if (k > n || k == 0) {
+      std::cerr << "In davidson(): Can only compute up to " << n
+                << " eigenvalues\nin a matrix that has " << n << " times "
+                << n << " elements.";
+      abort();
+    }
+    if (tol <= 0)
+      tol = 1e-10;
+    tensor::index m = max_subspace? max_subspace : std::max<tensor::index>(20, 4 * k);
+    m = std::min<tensor::index>(n, std::max<tensor::index>(m, 2 * k));
+    tensor::index l = std::max<tensor::index>(k, std::min<tensor::index>(m / 2, m - k));
+    tensor::index maxit = std::max<tensor::index>(500, n);
+    size_t count = 0;
+
+    Tensor<elt_t> basis(n, m), images(n, m), projected(m, m), w(n);
+    elt_t *V = basis.begin(), *AV = images.begin(), *H = projected.begin();
+    tensor::index nb = 0;
+
+    /* Starting vectors: those given by the user, completed with the unit
+     * vectors of the smallest diagonal elements, slightly perturbed so as
+     * not to be trapped in a symmetry sector. */
+    if (vectors && vectors->size() && vectors->size() % n == 0) {
+      tensor::index c = std::min<tensor::index>(vectors->size() / n, k);
+      for (tensor::index i = 0; i < c; i++) {
+        std::copy(vectors->begin_const() + i * n,
+                  vectors->begin_const() + (i + 1) * n, w.begin());
+        if (davidson_extend(A, n, nb, m, V, AV, H, w.begin(), &count))
+          nb++;
+      }
+    }
+    Indices order = sort_indices(diagonal);
+    for (tensor::index i = 0; nb < k && i < n; i++) {
+      Tensor<elt_t> r = Tensor<elt_t>::random(n);
+      for (tensor::index j = 0; j < n; j++)
+        w.at(j) = 1e-3 * (r[j] - 0.5 * one);
+      w.at(order[i]) += one;
+      if (davidson_extend(A, n, nb, m, V, AV, H, w.begin(), &count))
+        nb++;
+    }
+
+    Tensor<elt_t> X(n, k), AX(n, k), S;
+    RTensor theta;
+    bool done = false;
+    for (tensor::index iter = 0; iter <= maxit; iter++) {
+      /* Rayleigh-Ritz step */
+      Tensor<elt_t> Hb(nb, nb);
+      for (tensor::index j = 0; j < nb; j++)
+        std::copy(H + j * m, H + j * m + nb, Hb.begin() + j * nb);
+      RTensor values = eig_sym(Hb, &S);
+      theta = values(range(0, k - 1));
+      blas::gemm('N', 'N', n, k, nb, one, V, n, S.begin_const(), nb,
+                 zero, X.begin(), n);
+      blas::gemm('N', 'N', n, k, nb, one, AV, n, S.begin_const(), nb,
+                 zero, AX.begin(), n);
+
+      /* Residuals of the wanted Ritz pairs */
+      Indices active(k);
+      tensor::index nactive = 0;
+      for (tensor::index c = 0; c < k; c++) {
+        elt_t *r = AX.begin() + c * n;
+        const elt_t *x = X.begin_const() + c * n;
+        double norm = 0;
+        for (tensor::index i = 0; i < n; i++)
+          norm += abs2(r[i] - theta[c] * x[i]);
+        if (sqrt(norm) > tol * std::max(1.0, std::abs(theta[c])))
+          active.at(nactive++) = c;
+      }
+      if (nactive == 0) {
+        done = true;
+        break;
+      }
+      if (iter == maxit)
+        break;
+
+      /* Thick restart, keeping the 'l' best Ritz vectors */
+      if (nb + nactive > m) {
+        Tensor<elt_t> newV(n, l), newAV(n, l);
+        blas::gemm('N', 'N', n, l, nb, one, V, n, S.begin_const(), nb,
+                   zero, newV.begin(), n);
+        blas::gemm('N', 'N', n, l, nb, one, AV, n, S.begin_const(), nb,
+                   zero, newAV.begin(), n);
+        std::copy(newV.begin_const(), newV.end_const(), V);
+        std::copy(newAV.begin_const(), newAV.end_const(), AV);
+        projected.fill_with_zeros();
+        for (tensor::index i = 0; i < l; i++)
+          H[i * m + i] = values[i];
+        nb = l;
+      }
+
+      /* Preconditioned corrections */
+      tensor::index added = 0;
+      for (tensor::index a = 0; a < nactive && nb < m; a++) {
+        tensor::index c = active[a];
+        const elt_t *r = AX.begin_const() + c * n;
+        const elt_t *x = X.begin_const() + c * n;
+        double guard = 1e-8 * std::max(1.0, std::abs(theta[c]));
+        elt_t xu = zero, xy = zero;
+        for (tensor::index i = 0; i < n; i++) {
+          double denominator = theta[c] - diagonal[i];
+          if (std::abs(denominator) < guard)
+            denominator = (denominator < 0)? -guard : guard;
+          elt_t residual = r[i] - theta[c] * x[i];
+          xu += ::tensor::conj(x[i]) * residual / denominator;
+          xy += ::tensor::conj(x[i]) * x[i] / denominator;
+          w.at(i) = residual;
+        }
+        elt_t shift = (abs(xy) > 0)? xu / xy : zero;
+        for (tensor::index i = 0; i < n; i++) {
+          double denominator = theta[c] - diagonal[i];
+          if (std::abs(denominator) < guard)
+            denominator = (denominator < 0)? -guard : guard;
+          w.at(i) = (w[i] - shift * x[i]) / denominator;
+        }
+        if (davidson_extend(A, n, nb, m, V, AV, H, w.begin(), &count)) {
+          nb++;
+          added++;
+        }
+      }
+      if (added == 0) {
+        /* The corrections lie in the basis: try a random direction. */
+        Tensor<elt_t> r = Tensor<elt_t>::random(n);
+        for (tensor::index i = 0; i < n; i++)
+          w.at(i) = r[i] - 0.5 * one;
+        if (nb == m || !davidson_extend(A, n, nb, m, V, AV, H, w.begin(), &count))
+          break;
+        nb++;
+      }
+    }
+    if (!done) {
+      std::cerr << "davidson: Maximum number of iterations reached.\n";
+      if (!converged)
+        abort();
+    }
+    if (converged)
+      *converged = done;
+    if (matvecs)
+      *matvecs = count;
+    if (vectors)
+      *vectors = X;
+    return theta;
+  }
+
+} // namespace linalg
@@ -0,0 +1,47 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include "davidson.hpp"
+
+namespace linalg {
+
+  /**Find out the lowest eigenvalues and eigenvectors of a symmetric
+     (Hermitian) linear map with the Davidson method.*/
+  RTensor
+  davidson(const Map<RTensor> *A, const RTensor &diagonal, size_t neig,
+           RTensor *vectors, bool *converged, double tol, size_t max_subspace,
+           size_t *matvecs)
+  {
+    return davidson_loop(A, diagonal, neig, vectors, converged, tol,
+                         max_subspace, matvecs);
+  }
+
+  /**Find out the lowest eigenvalues and eigenvectors of a symmetric
+     (Hermitian) sparse matrix with the Davidson method, preconditioned
+     with the diagonal of the matrix.*/
+  RTensor
+  davidson(const RSparse &A, size_t neig, RTensor *vectors, bool *converged,
+           double tol, size_t max_subspace, size_t *matvecs)
+  {
+    tensor::MatrixMap<RSparse> op(A);
+    return davidson_loop<RTensor::elt_t>(&op, davidson_diagonal(A), neig, vectors,
+                                    converged, tol, max_subspace, matvecs);
+  }
+
+} // namespace linalg
@@ -17,6 +17,8 @@
     51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
 */
 
+#include <cmath>
+#include <algorithm>
 #include <tensor/tensor.h>
 #include <tensor/tensor_lapack.h>
 #include <tensor/linalg.h>
@@ -26,45 +28,272 @@ namespace linalg {
 
   using namespace tensor;
 
+  /* Iterations without improving the residual or changing the eigenvalue
+   * after which we give up. This happens when there are several eigenvalues
+   * with the same absolute value and the vector keeps rotating among their
+   * eigenstates. */
+  static const size_t POWER_MAX_STALLED = 10;
+
+  /* w -= shift * v, followed by the projection of 'w' out of the 'nq'
+   * orthonormal columns of 'Q'. The projections are stored in 'c'. */
+  template<typename elt_t>
+  static void
+  power_shift_and_project(tensor::index n, elt_t shift, const elt_t *v,
+                          elt_t *w, const elt_t *Q, tensor::index nq, elt_t *c)
+  {
+    if (shift != number_zero<elt_t>()) {
+      for (tensor::index i = 0; i < n; i++)
+        w[i] -= shift * v[i];
+    }
+    for (tensor::index j = 0; j < nq; j++) {
+      const elt_t *q = Q + j * n;
+      elt_t cj = number_zero<elt_t>();
+      for (tensor::index i = 0; i < n; i++)
+        cj += ::tensor::conj(q[i]) * w[i];
+      for (tensor::index i = 0; i < n; i++)
+        w[i] -= cj * q[i];
+      c[j] = cj;
+    }
+  }
+
+  /* Rayleigh quotient <v|w> and norm of 'w', in one pass. */
+  template<typename elt_t>
+  static elt_t
+  power_rayleigh(tensor::index n, const elt_t *v, const elt_t *w, double *norm)
+  {
+    elt_t eig = number_zero<elt_t>();
+    double w2 = 0;
+    for (tensor::index i = 0; i < n; i++) {
+      eig += ::tensor::conj(v[i]) * w[i];
+      w2 += abs2(w[i]);
+    }
+    *norm = sqrt(w2);
+    return eig;
+  }
+
+  /* Largest element of the residual w - eig * v, while 'v' is replaced
+   * with the normalized 'w', in one pass. */
+  template<typename elt_t>
+  static double
+  power_update(tensor::index n, elt_t eig, double norm, elt_t *v, const elt_t *w)
+  {
+    double err = 0, inv_norm = 1.0 / norm;
+    for (tensor::index i = 0; i < n; i++) {
+      err = std::max(err, abs2(w[i] - eig * v[i]));
+      v[i] = w[i] * inv_norm;
+    }
+    return sqrt(err);
+  }
+
+  /* Power iteration with the map A - shift, restricted to the orthogonal
+   * complement of the 'nq' columns of 'Q'. 'v' is the normalized initial
+   * vector, which is replaced with the converged one, and 'w' a work vector
+   * of the same size. On output, 'c' contains the projections of A*v onto
+   * the columns of 'Q', for the final 'v'. Returns the eigenvalue of
+   * A - shift and sets '*iterations' to the number of applications of A. */
+  template<typename elt_t>
+  static elt_t
+  power_iterate(const Map<Tensor<elt_t> > *A, Tensor<elt_t> &v, Tensor<elt_t> &w,
+                const elt_t *Q, tensor::index nq, elt_t *c, elt_t shift,
+                size_t iter, double tol, size_t *iterations)
+  {
+    tensor::index n = v.size();
+    elt_t eig = number_zero<elt_t>(), old_eig = eig;
+    double best = -1;
+    size_t i = 0, stalled = 0;
+    while (i < iter) {
+      A->apply_into(v, w);
+      i++;
+      elt_t *pw = w.begin(), *pv = v.begin();
+      power_shift_and_project(n, shift, pv, pw, Q, nq, c);
+      double norm;
+      eig = power_rayleigh(n, pv, pw, &norm);
+      if (norm == 0) {
+        // 'v' is in the kernel of the map: it is an eigenvector of A -
+        // shift with eigenvalue zero.
+        break;
+      }
+      double err = power_update(n, eig, norm, pv, pw);
+      // The projections were computed for the previous vector, which is
+      // related to the new one by the phase eig / norm.
+      for (tensor::index j = 0; j < nq; j++)
+        c[j] *= eig / norm;
+      // Stop if the vector is sufficiently close to an eigenstate
+      if (err < tol * norm)
+        break;
+      // Or if neither the residual nor the eigenvalue evolve. The residual
+      // alone is not enough, because it may grow for a while when 'A' is
+      // not normal.
+      if (best < 0 || err < best) {
+        best = err;
+        stalled = 0;
+      } else if (std::abs(eig - old_eig) > tol * norm) {
+        stalled = 0;
+      } else if (++stalled >= POWER_MAX_STALLED) {
+        break;
+      }
+      old_eig = eig;
+    }
+    *iterations = i;
+    return eig;
+  }
+
+  /* A normalized random vector, or the given one if it has 'dims'
+   * elements, orthogonal to the 'nq' columns of Q. */
+  template<typename elt_t>
+  static void
+  power_start(Tensor<elt_t> &v, size_t dims, const elt_t *Q, tensor::index nq)
+  {
+    tensor::index n = dims;
+    if (v.size() != n) {
+      v = 0.5 - Tensor<elt_t>::random(n);
+    }
+    elt_t *pv = v.begin();
+    for (int attempt = 0; attempt < 3; attempt++) {
+      for (tensor::index j = 0; j < nq; j++) {
+        const elt_t *q = Q + j * n;
+        elt_t cj = number_zero<elt_t>();
+        for (tensor::index i = 0; i < n; i++)
+          cj += ::tensor::conj(q[i]) * pv[i];
+        for (tensor::index i = 0; i < n; i++)
+          pv[i] -= cj * q[i];
+      }
+      double norm = norm2(v);
+      if (norm > 1e-8) {
+        v /= norm;
+        return;
+      }
+      // The initial vector was in the span of Q
+      v = 0.5 - Tensor<elt_t>::random(n);
+      pv = v.begin();
+    }
+  }
+
   template<typename elt_t>
   elt_t eig_power_loop(const Map<Tensor<elt_t> > *A, size_t dims, Tensor<elt_t> *vector,
-                       size_t iter, double tol)
+                       size_t iter, double tol, int *iterations)
   {
     if (tol <= 0) {
       tol = 1e-11;
     }
     assert(vector);
-    Tensor<elt_t> &v = *vector;
-    if (v.size() != dims) {
-      v = 0.5 - Tensor<elt_t>::random(dims);
-    }
     if (iter == 0) {
-      iter = std::max<size_t>(20, v.size());
+      iter = std::max<size_t>(20, dims);
     }
-    v /= norm2(v);
-    elt_t eig, old_eig;
     //
     // We apply repeatedly the map 'A' onto the same random initial
     // vector, until (A^n)*v converges to the eigenstate with the largest
-    // eigenvalue (in absolute value) that has some support on 'v'.
-    // Sometimes degeneracy will slow convergence. In this case we stop
-    // when the algorithm slows downs too much.
+    // eigenvalue (in absolute value) that has some support on 'v'. The
+    // vector is updated in place, and we stop when the residual is below
+    // the tolerance or stops decreasing, as happens when there are
+    // several eigenvalues with the same absolute value.
     //
-    for (size_t i = 0; i <= iter; i++) {
-      Tensor<elt_t> v_new = (*A)(v);
-      eig = scprod(v, v_new);
-      double err = norm0(v_new - eig * v);
-      v = (v_new /= norm2(v_new));
-      // Stop if the vector is sufficiently close to an eigenstate
-      if (err < tol * std::abs(eig))
-        break;
-      // Or if the eigenvalues stopped evolving
-      if (i && (std::abs(eig - old_eig) < tol * std::abs(eig)))
-        break;
-      old_eig = eig;
-    }
+    Tensor<elt_t> &v = *vector;
+    power_start<elt_t>(v, dims, 0, 0);
+    Tensor<elt_t> w(v.dimensions());
+    size_t steps;
+    elt_t eig = power_iterate<elt_t>(A, v, w, 0, 0, 0, number_zero<elt_t>(),
+                                     iter + 1, tol, &steps);
+    if (iterations)
+      *iterations = steps;
     delete A;
     return eig;
   }
 
+  /* Eigenvectors of the upper triangular matrix T, stored by columns with
+   * leading dimension 'k', by back substitution. They are the coordinates
+   * of the eigenvectors of A in the basis of Schur vectors Q. */
+  template<typename elt_t>
+  static const Tensor<elt_t>
+  power_triangular_eigenvectors(const Tensor<elt_t> &T)
+  {
+    tensor::index k = T.rows();
+    Tensor<elt_t> Y = Tensor<elt_t>::zeros(k, k);
+    for (tensor::index j = 0; j < k; j++) {
+      elt_t lambda = T(j, j);
+      double scale = std::max(std::abs(lambda), 1e-300);
+      Y.at(j, j) = number_one<elt_t>();
+      for (tensor::index i = j; i-- > 0; ) {
+        elt_t s = number_zero<elt_t>();
+        for (tensor::index l = i + 1; l <= j; l++)
+          s += T(i, l) * Y(l, j);
+        elt_t d = lambda - T(i, i);
+        // With degenerate eigenvalues, the Schur vector itself is taken as
+        // the eigenvector (exact for normal matrices; defective ones do not
+        // have independent eigenvectors).
+        Y.at(i, j) = (std::abs(d) < 1e-12 * scale)? number_zero<elt_t>() : s / d;
+      }
+    }
+    return Y;
+  }
+
+  template<typename elt_t>
+  const Tensor<elt_t>
+  eig_power_deflated_loop(const Map<Tensor<elt_t> > *A, size_t dims, int neig,
+                          Tensor<elt_t> *vectors, elt_t shift, size_t iter,
+                          double tol, int *iterations)
+  {
+    if (neig <= 0 || (size_t)neig > dims) {
+      std::cerr << "In eig_power_right()/eig_power_left(), the number of "
+                << "eigenvalues " << neig << " is not between 1 and the "
+                << "matrix size " << dims << std::endl;
+      abort();
+    }
+    if (tol <= 0) {
+      tol = 1e-11;
+    }
+    if (iter == 0) {
+      iter = std::max<size_t>(20, dims);
+    }
+    //
+    // Each eigenvector is computed with the power method restricted to the
+    // orthogonal complement of those already found (Hotelling deflation).
+    // For Hermitian matrices these are the eigenvectors; otherwise they
+    // are Schur vectors, A Q = Q T with T upper triangular, and the
+    // eigenvectors of A are recovered from those of T.
+    //
+    tensor::index n = dims, k = neig;
+    bool warm = vectors && vectors->rank() == 2 &&
+      vectors->rows() == n && vectors->columns() == k;
+    Tensor<elt_t> Q(n, k), T = Tensor<elt_t>::zeros(k, k), v, w(n);
+    size_t total = 0;
+    for (tensor::index j = 0; j < k; j++) {
+      if (warm) {
+        v = Tensor<elt_t>(n);
+        std::copy(vectors->begin_const() + j * n,
+                  vectors->begin_const() + (j + 1) * n, v.begin());
+      } else {
+        v = Tensor<elt_t>();
+      }
+      const elt_t *q = Q.begin_const();
+      power_start<elt_t>(v, dims, q, j);
+      size_t steps;
+      elt_t *c = T.begin() + j * k;
+      elt_t eig = power_iterate<elt_t>(A, v, w, q, j, c, shift, iter + 1, tol,
+                                       &steps);
+      T.at(j, j) = eig + shift;
+      std::copy(v.begin_const(), v.end_const(), Q.begin() + j * n);
+      total += steps;
+    }
+    delete A;
+    if (iterations)
+      *iterations = total;
+    Tensor<elt_t> output(k);
+    for (tensor::index j = 0; j < k; j++)
+      output.at(j) = T(j, j);
+    if (vectors) {
+      Tensor<elt_t> V = mmult(Q, power_triangular_eigenvectors(T));
+      for (tensor::index j = 0; j < k; j++) {
+        double norm = 0;
+        for (tensor::index i = 0; i < n; i++)
+          norm += abs2(V(i, j));
+        norm = 1.0 / sqrt(norm);
+        for (tensor::index i = 0; i < n; i++)
+          V.at(i, j) *= norm;
+      }
+      *vectors = V;
+    }
+    return output;
+  }
+
 } // namespace linalg
@@ -24,9 +24,17 @@ namespace linalg {
 
   double
   do_eig_power(const Map<RTensor> *A, size_t dims, RTensor *vector,
-               size_t iter, double tol)
+               size_t iter, double tol, int *iterations)
   {
-    return eig_power_loop(A, dims, vector, iter, tol);
+    return eig_power_loop(A, dims, vector, iter, tol, iterations);
+  }
+
+  const RTensor
+  do_eig_power(const Map<RTensor> *A, size_t dims, int neig, RTensor *vectors,
+               double shift, size_t iter, double tol, int *iterations)
+  {
+    return eig_power_deflated_loop(A, dims, neig, vectors, shift, iter, tol,
+                                   iterations);
   }
 
 } // namespace linalg
@@ -24,9 +24,17 @@ namespace linalg {
 
   tensor::cdouble
   do_eig_power(const Map<CTensor> *A, size_t dims, CTensor *vector,
-               size_t iter, double tol)
+               size_t iter, double tol, int *iterations)
   {
-    return eig_power_loop(A, dims, vector, iter, tol);
+    return eig_power_loop(A, dims, vector, iter, tol, iterations);
+  }
+
+  const CTensor
+  do_eig_power(const Map<CTensor> *A, size_t dims, int neig, CTensor *vectors,
+               tensor::cdouble shift, size_t iter, double tol, int *iterations)
+  {
+    return eig_power_deflated_loop(A, dims, neig, vectors, shift, iter, tol,
+                                   iterations);
   }
 
 } // namespace linalg
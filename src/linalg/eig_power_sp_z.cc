@@ -29,11 +29,12 @@ namespace linalg {
      \ingroup Linalg
   */
   tensor::cdouble
-  eig_power_right(const CSparse &O, CTensor *vector, size_t iter, double tol)
+  eig_power_right(const CSparse &O, CTensor *vector, size_t iter, double tol,
+                  int *iterations)
   {
     assert(O.rows() == O.columns());
     return do_eig_power(new tensor::MatrixMap<CSparse>(O), O.columns(),
-                        vector, iter, tol);
+                        vector, iter, tol, iterations);
   }
 
   /**Left eigenvalue and eigenvector with the largest absolute
@@ -44,11 +45,46 @@ namespace linalg {
      \ingroup Linalg
   */
   tensor::cdouble
-  eig_power_left(const CSparse &O, CTensor *vector, size_t iter, double tol)
+  eig_power_left(const CSparse &O, CTensor *vector, size_t iter, double tol,
+                 int *iterations)
   {
     assert(O.rows() == O.columns());
     return do_eig_power(new tensor::MatrixMap<CSparse>(O, true), O.columns(),
-                        vector, iter, tol);
+                        vector, iter, tol, iterations);
+  }
+
+  /**Right eigenvalues and eigenvectors with the 'neig' largest values
+     of |lambda - shift|, computed using the power method with
+     deflation. The eigenvectors are stored as columns of 'vectors'; if
+     they have the right size on input, they are used as initial guesses.
+     'iter' is the maximum number of iterations per eigenvector and
+     'iterations', if not null, is set to the total number of applications
+     of the matrix.
+
+     \ingroup Linalg
+  */
+  const CTensor
+  eig_power_right(const CSparse &O, int neig, CTensor *vectors,
+                  tensor::cdouble shift, size_t iter, double tol, int *iterations)
+  {
+    assert(O.rows() == O.columns());
+    return do_eig_power(new tensor::MatrixMap<CSparse>(O), O.columns(), neig,
+                        vectors, shift, iter, tol, iterations);
+  }
+
+  /**Left eigenvalues and eigenvectors with the 'neig' largest values
+     of |lambda - shift|, computed using the power method with
+     deflation. See eig_power_right().
+
+     \ingroup Linalg
+  */
+  const CTensor
+  eig_power_left(const CSparse &O, int neig, CTensor *vectors,
+                 tensor::cdouble shift, size_t iter, double tol, int *iterations)
+  {
+    assert(O.rows() == O.columns());
+    return do_eig_power(new tensor::MatrixMap<CSparse>(O, true), O.columns(),
+                        neig, vectors, shift, iter, tol, iterations);
   }
 
 } // namespace linalg
@@ -0,0 +1,248 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <algorithm>
+#include <tensor/tensor.h>
+#include <tensor/tensor_lapack.h>
+#include <tensor/linalg.h>
+#include "lapack_workspace.hpp"
+
+namespace linalg {
+
+  using namespace lapack;
+  using tensor::Tensor;
+  using tensor::range;
+
+  /* Calls to the LAPACK drivers, overloaded on the element type. 'rwork'
+   * and 'lrwork' are ignored by the real versions. */
+
+  static inline void
+  eig_sym_syev(char jobz, integer n, double *a, double *w, double *work,
+               integer lwork, double *, integer *info)
+  {
+    char uplo = 'U';
+    F77NAME(dsyev)(&jobz, &uplo, &n, a, &n, w, work, &lwork, info);
+  }
+
+  static inline void
+  eig_sym_syev(char jobz, integer n, cdouble *a, double *w, cdouble *work,
+               integer lwork, double *rwork, integer *info)
+  {
+    char uplo = 'U';
+    F77NAME(zheev)(&jobz, &uplo, &n, a, &n, w, work, &lwork, rwork, info);
+  }
+
+  static inline void
+  eig_sym_syevd(char jobz, integer n, double *a, double *w, double *work,
+                integer lwork, double *, integer, integer *iwork,
+                integer liwork, integer *info)
+  {
+    char uplo = 'U';
+    F77NAME(dsyevd)(&jobz, &uplo, &n, a, &n, w, work, &lwork, iwork, &liwork,
+                    info);
+  }
+
+  static inline void
+  eig_sym_syevd(char jobz, integer n, cdouble *a, double *w, cdouble *work,
+                integer lwork, double *rwork, integer lrwork, integer *iwork,
+                integer liwork, integer *info)
+  {
+    char uplo = 'U';
+    F77NAME(zheevd)(&jobz, &uplo, &n, a, &n, w, work, &lwork, rwork, &lrwork,
+                    iwork, &liwork, info);
+  }
+
+  static inline void
+  eig_sym_syevr(char jobz, char range, integer n, double *a, double vl,
+                double vu, integer il, integer iu, integer *m, double *w,
+                double *z, integer *isuppz, double *work, integer lwork,
+                double *, integer, integer *iwork, integer liwork,
+                integer *info)
+  {
+    char uplo = 'U';
+    double abstol = 0;
+    F77NAME(dsyevr)(&jobz, &range, &uplo, &n, a, &n, &vl, &vu, &il, &iu,
+                    &abstol, m, w, z, &n, isuppz, work, &lwork, iwork,
+                    &liwork, info);
+  }
+
+  static inline void
+  eig_sym_syevr(char jobz, char range, integer n, cdouble *a, double vl,
+                double vu, integer il, integer iu, integer *m, double *w,
+                cdouble *z, integer *isuppz, cdouble *work, integer lwork,
+                double *rwork, integer lrwork, integer *iwork, integer liwork,
+                integer *info)
+  {
+    char uplo = 'U';
+    double abstol = 0;
+    F77NAME(zheevr)(&jobz, &range, &uplo, &n, a, &n, &vl, &vu, &il, &iu,
+                    &abstol, m, w, z, &n, isuppz, work, &lwork, rwork,
+                    &lrwork, iwork, &liwork, info);
+  }
+
+#ifdef TENSOR_USE_ACML
+  static inline void
+  acml_syev(char jobz, integer n, double *a, double *w, integer *info)
+  {
+    dsyev(jobz, 'U', n, a, n, w, info);
+  }
+
+  static inline void
+  acml_syev(char jobz, integer n, cdouble *a, double *w, integer *info)
+  {
+    zheev(jobz, 'U', n, a, n, w, info);
+  }
+#endif
+
+  /* Eigenvalues, in increasing order, and optionally eigenvectors of the
+   * upper triangle of a symmetric (Hermitian) matrix, with one of three
+   * LAPACK drivers:
+   *  - syev, QR iteration on the tridiagonal form.
+   *  - syevd, divide and conquer, much faster when eigenvectors are
+   *    requested. If it fails to converge, we retry with syev.
+   *  - syevr, relatively robust representations (MRRR), which can compute
+   *    only the eigenvalues in positions 'il' to 'iu' (range 'I', 1-based)
+   *    or in the interval (vl, vu] (range 'V'). Selecting a subset always
+   *    uses this driver.
+   */
+  template<typename elt_t>
+  static RTensor
+  eig_sym_driver(const Tensor<elt_t> &A, Tensor<elt_t> *V,
+                 EigSymAlgorithm algorithm, char subset, double vl, double vu,
+                 integer il, integer iu, LapackBuffers *buffers = 0)
+  {
+    assert(A.rows() > 0);
+    assert(A.rank() == 2);
+    assert(A.rows() == A.columns());
+
+    integer n = A.rows();
+    if ((size_t)n != A.columns()) {
+      std::cerr << "Routine eig_sym() can only compute eigenvalues of square matrices, and you\n"
+                << "have passed a matrix that is " << A.rows() << " by " << A.columns();
+      abort();
+    }
+
+    typedef typename lapack_type<elt_t>::type lapack_t;
+    Tensor<elt_t> aux(A);
+    lapack_t *a = tensor_pointer(aux), *work, foo;
+    double *rwork, rfoo = 0;
+    integer *iwork, ifoo = 0, info;
+    char jobz = (V == 0)? 'N' : 'V';
+    RTensor output(n);
+    double *w = tensor_pointer(output);
+
+#ifdef TENSOR_USE_ACML
+    algorithm = EIG_SYM_SYEV;
+    if (subset != 'A') {
+      std::cerr << "In eig_sym(), subsets of eigenvalues are not supported "
+                << "with ACML\n";
+      abort();
+    }
+#endif
+    if (subset != 'A')
+      algorithm = EIG_SYM_SYEVR;
+
+    if (algorithm == EIG_SYM_SYEVR) {
+      LapackWorkspaceKey key('R', jobz, subset, n, n, 0);
+      LapackWorkspace sizes;
+      /* syevr does not touch 'z' when jobz = 'N', and otherwise needs room
+       * for every eigenvector that may be found. */
+      integer columns = (jobz == 'N')? 1 : (subset == 'I')? iu - il + 1 : n;
+      Tensor<elt_t> Z(n, columns);
+      integer m, *support = new integer[2 * n];
+      lapack_t *z = tensor_pointer(Z);
+      if (!lapack_cached_workspace(key, &sizes)) {
+        eig_sym_syevr(jobz, subset, n, a, vl, vu, il, iu, &m, w, z, support,
+                      &foo, -1, &rfoo, -1, &ifoo, -1, &info);
+        sizes.lwork = lapack_lwork(foo);
+        sizes.lrwork = (integer)rfoo;
+        sizes.liwork = ifoo;
+        lapack_store_workspace(key, sizes);
+      }
+      work = lapack_work<lapack_t>(buffers, sizes.lwork);
+      rwork = lapack_rwork(buffers, std::max(sizes.lrwork, (integer)1));
+      iwork = lapack_iwork(buffers, sizes.liwork);
+      eig_sym_syevr(jobz, subset, n, a, vl, vu, il, iu, &m, w, z, support,
+                    work, sizes.lwork, rwork, sizes.lrwork, iwork,
+                    sizes.liwork, &info);
+      lapack_release(buffers, work);
+      lapack_release(buffers, rwork);
+      lapack_release(buffers, iwork);
+      delete[] support;
+      if (info) {
+        std::cerr << "In eig_sym(), syevr failed (info = " << info << ")\n";
+        abort();
+      }
+      if (m == 0) {
+        if (V) *V = Tensor<elt_t>(n, 0);
+        return RTensor(tensor::igen << 0);
+      }
+      if (V)
+        *V = (m == columns)? Z : Tensor<elt_t>(Z(range(), range(0, m - 1)));
+      return (m == n)? output : RTensor(output(range(0, m - 1)));
+    }
+
+    if (algorithm == EIG_SYM_SYEVD) {
+      LapackWorkspaceKey key('E', jobz, 'A', n, n, 0);
+      LapackWorkspace sizes;
+      if (!lapack_cached_workspace(key, &sizes)) {
+        eig_sym_syevd(jobz, n, a, w, &foo, -1, &rfoo, -1, &ifoo, -1, &info);
+        sizes.lwork = lapack_lwork(foo);
+        sizes.lrwork = (integer)rfoo;
+        sizes.liwork = ifoo;
+        lapack_store_workspace(key, sizes);
+      }
+      work = lapack_work<lapack_t>(buffers, sizes.lwork);
+      rwork = lapack_rwork(buffers, std::max(sizes.lrwork, (integer)1));
+      iwork = lapack_iwork(buffers, sizes.liwork);
+      eig_sym_syevd(jobz, n, a, w, work, sizes.lwork, rwork, sizes.lrwork,
+                    iwork, sizes.liwork, &info);
+      lapack_release(buffers, work);
+      lapack_release(buffers, rwork);
+      lapack_release(buffers, iwork);
+      if (info == 0) {
+        if (V) *V = aux;
+        return output;
+      }
+      aux = A;
+      a = tensor_pointer(aux);
+    }
+
+#ifdef TENSOR_USE_ACML
+    acml_syev(jobz, n, a, w, &info);
+#else
+    LapackWorkspaceKey key('V', jobz, 'A', n, n, 0);
+    LapackWorkspace sizes;
+    if (!lapack_cached_workspace(key, &sizes)) {
+      eig_sym_syev(jobz, n, a, w, &foo, -1, &rfoo, &info);
+      sizes.lwork = lapack_lwork(foo);
+      lapack_store_workspace(key, sizes);
+    }
+    work = lapack_work<lapack_t>(buffers, sizes.lwork);
+    rwork = lapack_rwork(buffers, lapack_rwork_size<elt_t>(3 * n));
+    eig_sym_syev(jobz, n, a, w, work, sizes.lwork, rwork, &info);
+    lapack_release(buffers, work);
+    lapack_release(buffers, rwork);
+#endif
+
+    if (V) *V = aux;
+    return output;
+  }
+
+} // namespace linalg
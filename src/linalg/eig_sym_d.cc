@@ -17,13 +17,19 @@
     51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
 */
 
-#include <tensor/tensor.h>
-#include <tensor/tensor_lapack.h>
-#include <tensor/linalg.h>
+#include "eig_sym.hpp"
 
 namespace linalg {
 
-  using namespace lapack;
+  /**LAPACK driver used by eig_sym() when all eigenvalues are computed. The
+     default, EIG_SYM_SYEVD, is the divide-and-conquer algorithm, much faster
+     than the QR iteration of EIG_SYM_SYEV when the eigenvectors are needed.
+     EIG_SYM_SYEVR selects the MRRR algorithm, which is always used when only
+     a subset of the eigenvalues is requested.
+
+     \ingroup Linalg
+  */
+  EigSymAlgorithm eig_sym_algorithm = EIG_SYM_SYEVD;
 
   /**Eigenvalue decomposition of a real matrix.
      Given a square matrix A, we find a diagonal matrix D and a set of vectors R
@@ -36,47 +42,49 @@ namespace linalg {
 
      By default, only the diagonal elements of D are computed. However, also the
      matrix V can be computed if a pointer to the associated variable is
-     supplied.
+     supplied. The LAPACK routine is selected with \ref eig_sym_algorithm.
 
      \ingroup Linalg
   */
   RTensor
   eig_sym(const RTensor &A, RTensor *V)
   {
-    assert(A.rows() > 0);
-    assert(A.rank() == 2);
-    assert(A.rows() == A.columns());
-
-    blas::integer n = A.rows();
-    if ((size_t)n != A.columns()) {
-      std::cerr << "Routine eig_sym() can only compute eigenvalues of square matrices, and you\n"
-                << "have passed a matrix that is " << A.rows() << " by " << A.columns();
+    return eig_sym_driver(A, V, eig_sym_algorithm, 'A', 0.0, 0.0, 0, 0);
+  }
+
+  /**Selected eigenvalues of a symmetric real matrix.
+     This computes the eigenvalues that occupy positions \a first to \a last
+     (both included, starting from 0) when sorted in increasing order and,
+     if \a V is not null, the corresponding eigenvectors as columns of \a V.
+     Only the requested eigenpairs are computed, with LAPACK's MRRR driver.
+
+     \ingroup Linalg
+  */
+  RTensor
+  eig_sym(const RTensor &A, RTensor *V, tensor::index first, tensor::index last)
+  {
+    if (first > last || last >= A.rows()) {
+      std::cerr << "In eig_sym(A, V, first, last), the eigenvalue positions "
+                << first << " and " << last << " are not a valid range for a "
+                << A.rows() << "x" << A.columns() << " matrix\n";
       abort();
     }
+    return eig_sym_driver(A, V, eig_sym_algorithm, 'I', 0.0, 0.0,
+                          first + 1, last + 1);
+  }
+
+  /**Eigenvalues of a symmetric real matrix in an interval.
+     This computes the eigenvalues in the half-open interval
+     (\a lower, \a upper], in increasing order, and optionally their
+     eigenvectors. The output may be empty.
 
-    RTensor aux(A);
-    double *a = tensor_pointer(aux);
-    blas::integer lda = n, info[1];
-    char jobz[2] = { (V == 0)? 'N' : 'V', 0 };
-    char uplo[2] = { 'U', 0 };
-    RTensor output(n);
-    double *w = tensor_pointer(output);
-
-#ifdef TENSOR_USE_ACML
-    dsyev(*jobz, *uplo, n, a, lda, w, info);
-#else
-    blas::integer lwork = -1;
-    double work0[1];
-    F77NAME(dsyev)(jobz, uplo, &n, a, &lda, w, work0, &lwork, info);
-    lwork = (int)work0[0];
-
-    RTensor work(lwork);
-    F77NAME(dsyev)(jobz, uplo, &n, a, &lda, w, tensor_pointer(work),
-                   &lwork, info);
-#endif
-
-    if (V) *V = aux;
-    return output;
+     \ingroup Linalg
+  */
+  RTensor
+  eig_sym_interval(const RTensor &A, RTensor *V, double lower, double upper)
+  {
+    assert(lower < upper);
+    return eig_sym_driver(A, V, eig_sym_algorithm, 'V', lower, upper, 0, 0);
   }
 
 } // namespace linalg
@@ -17,14 +17,10 @@
     51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
 */
 
-#include <tensor/tensor.h>
-#include <tensor/tensor_lapack.h>
-#include <tensor/linalg.h>
+#include "eig_sym.hpp"
 
 namespace linalg {
 
-  using namespace lapack;
-
   /**Eigenvalue decomposition of a complex matrix.
      Given a square matrix A, we find a diagonal matrix D and a set of vectors R
      or L such that
@@ -36,51 +32,49 @@ namespace linalg {
 
      By default, only the diagonal elements of D are computed. However, also the
      matrix V can be computed if a pointer to the associated variable is
-     supplied.
+     supplied. The LAPACK routine is selected with \ref eig_sym_algorithm.
 
      \ingroup Linalg
   */
   RTensor
   eig_sym(const CTensor &A, CTensor *V)
   {
-    assert(A.rows() > 0);
-    assert(A.rank() == 2);
-    assert(A.rows() == A.columns());
+    return eig_sym_driver(A, V, eig_sym_algorithm, 'A', 0.0, 0.0, 0, 0);
+  }
 
-    //if (accurate_svd)
-    //  return block_eig_sym(A, V);
-    blas::integer n = A.rows();
-    if ((size_t)n != A.columns()) {
-      std::cerr << "Routine eig() can only compute eigenvalues of square matrices, and you\n"
-                << "have passed a matrix that is " << A.rows() << " by " << A.columns();
+  /**Selected eigenvalues of a Hermitian complex matrix.
+     This computes the eigenvalues that occupy positions \a first to \a last
+     (both included, starting from 0) when sorted in increasing order and,
+     if \a V is not null, the corresponding eigenvectors as columns of \a V.
+     Only the requested eigenpairs are computed, with LAPACK's MRRR driver.
+
+     \ingroup Linalg
+  */
+  RTensor
+  eig_sym(const CTensor &A, CTensor *V, tensor::index first, tensor::index last)
+  {
+    if (first > last || last >= A.rows()) {
+      std::cerr << "In eig_sym(A, V, first, last), the eigenvalue positions "
+                << first << " and " << last << " are not a valid range for a "
+                << A.rows() << "x" << A.columns() << " matrix\n";
       abort();
     }
+    return eig_sym_driver(A, V, eig_sym_algorithm, 'I', 0.0, 0.0,
+                          first + 1, last + 1);
+  }
 
-    CTensor aux(A);
-    cdouble *a = tensor_pointer(aux);
-    blas::integer lda = n, info[1];
-    char jobz[2] = { (V == 0)? 'N' : 'V', 0 };
-    char uplo[2] = { 'U', 0 };
-    RTensor output(n);
-    double *w = tensor_pointer(output);
-    RTensor rwork(3*n);
-
-#ifdef TENSOR_USE_ACML
-    zheev(*jobz, *uplo, n, a, lda, w, info);
-#else
-    blas::integer lwork = -1;
-    CTensor work(1);
-    F77NAME(zheev)(jobz, uplo, &n, a, &lda, w, tensor_pointer(work),
-                   &lwork, tensor_pointer(rwork), info);
-    lwork = (int)tensor::real(work[0]);
-
-    work = CTensor(lwork);
-    F77NAME(zheev)(jobz, uplo, &n, a, &lda, w, tensor_pointer(work),
-                   &lwork, tensor_pointer(rwork), info);
-#endif
+  /**Eigenvalues of a Hermitian complex matrix in an interval.
+     This computes the eigenvalues in the half-open interval
+     (\a lower, \a upper], in increasing order, and optionally their
+     eigenvectors. The output may be empty.
 
-    if (V) *V = aux;
-    return output;
+     \ingroup Linalg
+  */
+  RTensor
+  eig_sym_interval(const CTensor &A, CTensor *V, double lower, double upper)
+  {
+    assert(lower < upper);
+    return eig_sym_driver(A, V, eig_sym_algorithm, 'V', lower, upper, 0, 0);
   }
 
 } // namespace linalg
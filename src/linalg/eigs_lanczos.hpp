@@ -0,0 +1,307 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <cfloat>
+#include <cmath>
+#include <algorithm>
+#include <tensor/tensor.h>
+#include <tensor/linalg.h>
+#include "../arpack/gemv.cc"
+#include "../tensor/gemm.cc"
+
+namespace linalg {
+
+  using namespace tensor;
+
+  /* Number of rows of the Lanczos basis that are updated at once when
+   * restarting, which bounds the size of the auxiliary buffer. */
+  static const tensor::index LANCZOS_ROW_BLOCK = 1024;
+
+  static void
+  lanczos_check_type(int eig_type)
+  {
+    if (eig_type != LargestMagnitude && eig_type != SmallestMagnitude &&
+        eig_type != LargestAlgebraic && eig_type != SmallestAlgebraic) {
+      std::cerr << "In eigs_lanczos(), invalid eigenvalue selector " << eig_type
+                << ". Only LargestMagnitude, SmallestMagnitude, LargestAlgebraic\n"
+                << "and SmallestAlgebraic make sense for Hermitian problems.\n";
+      abort();
+    }
+  }
+
+  /* Order of the Ritz values, with the wanted ones first. */
+  static const Indices
+  lanczos_order(const RTensor &values, int eig_type)
+  {
+    switch (eig_type) {
+    case LargestMagnitude:
+      return sort_indices(abs(values), true);
+    case SmallestMagnitude:
+      return sort_indices(abs(values));
+    case LargestAlgebraic:
+      return sort_indices(values, true);
+    default:
+      return sort_indices(values);
+    }
+  }
+
+  template<typename elt_t>
+  static double
+  lanczos_norm(tensor::index n, const elt_t *v)
+  {
+    double output = 0;
+    for (tensor::index i = 0; i < n; i++)
+      output += abs2(v[i]);
+    return sqrt(output);
+  }
+
+  /* Remove from 'w' its projection onto the first 'k' columns of 'V', with
+   * classical Gram-Schmidt and a second pass when the norm of 'w' drops by
+   * more than 1/sqrt(2) (Daniel, Gragg, Kaufman and Stewart). 'c' is a
+   * buffer of 'k' elements. Returns the new norm of 'w'. */
+  template<typename elt_t>
+  static double
+  lanczos_orthogonalize(tensor::index n, tensor::index k, const elt_t *V, elt_t *w, elt_t *c,
+                        double norm)
+  {
+    const elt_t one = number_one<elt_t>(), zero = number_zero<elt_t>();
+    if (k == 0)
+      return norm;
+    for (int pass = 0; pass < 2; pass++) {
+      blas::gemv('C', n, k, one, V, n, w, 1, zero, c, 1);
+      blas::gemv('N', n, k, -one, V, n, c, 1, one, w, 1);
+      double new_norm = lanczos_norm(n, w);
+      bool done = new_norm > 0.7071 * norm;
+      norm = new_norm;
+      if (done)
+        break;
+    }
+    return norm;
+  }
+
+  /* Extend the basis with a random vector orthogonal to the first 'k' columns
+   * of 'V' when the Krylov space becomes invariant. */
+  template<typename elt_t>
+  static void
+  lanczos_random_vector(tensor::index n, tensor::index k, const elt_t *V, elt_t *w, elt_t *c)
+  {
+    Tensor<elt_t> r = Tensor<elt_t>::random(n);
+    std::copy(r.begin_const(), r.end_const(), w);
+    for (tensor::index i = 0; i < n; i++)
+      w[i] -= 0.5 * number_one<elt_t>();
+    double norm = lanczos_orthogonalize(n, k, V, w, c, lanczos_norm(n, w));
+    for (tensor::index i = 0; i < n; i++)
+      w[i] /= norm;
+  }
+
+  /* Eigenvalues and eigenvectors of small problems, built column by column. */
+  template<typename elt_t>
+  static RTensor
+  lanczos_dense(const Map<Tensor<elt_t> > *A, tensor::index n, int eig_type,
+                tensor::index neig, Tensor<elt_t> *vectors)
+  {
+    Tensor<elt_t> M(n, n), e = Tensor<elt_t>::zeros(igen << n);
+    for (tensor::index i = 0; i < n; i++) {
+      e.at(i) = number_one<elt_t>();
+      A->apply(n, e.begin_const(), M.begin() + i * n);
+      e.at(i) = number_zero<elt_t>();
+    }
+    Tensor<elt_t> V;
+    RTensor values = eig_sym(M, vectors? &V : 0);
+    Indices ndx = lanczos_order(values, eig_type);
+    Indices ndx_out(neig);
+    std::copy(ndx.begin_const(), ndx.begin_const() + neig, ndx_out.begin());
+    if (vectors)
+      *vectors = V(range(), range(ndx_out));
+    return values(range(ndx_out));
+  }
+
+  /* Thick-restart Lanczos method (K. Wu and H. Simon, SIAM J. Matrix Anal.
+   * Appl. 22, 602 (2000)). The Krylov basis V has 'm' columns plus the
+   * residual vector. After each cycle we keep the best 'l' Ritz vectors,
+   * which are computed with matrix-matrix products over blocks of rows,
+   * and the projected matrix becomes an arrowhead matrix with the Ritz
+   * values in the diagonal. Orthogonality is maintained selectively: each new vector is
+   * projected onto the basis with one matrix-vector product, and the
+   * overlaps with older vectors are only removed when they exceed eps^(3/4),
+   * which keeps the Ritz vectors orthogonal to high accuracy while skipping
+   * the correction in the early steps of a cycle. */
+  template<typename elt_t>
+  RTensor
+  eigs_lanczos_loop(const Map<Tensor<elt_t> > *A, size_t dims, int eig_type,
+                    size_t nev, Tensor<elt_t> *vectors, bool *converged)
+  {
+    const elt_t one = number_one<elt_t>(), zero = number_zero<elt_t>();
+    const double eps = DBL_EPSILON;
+    const double eps23 = pow(eps, 2.0/3.0);
+    const double reorth_tol = pow(eps, 0.75);
+    tensor::index n = dims, neig = nev;
+
+    if (neig > n || neig == 0) {
+      std::cerr << "In eigs_lanczos(): Can only compute up to " << n
+                << " eigenvalues\nin a matrix that has " << n << " times "
+                << n << " elements.";
+      abort();
+    }
+    lanczos_check_type(eig_type);
+
+    tensor::index m = std::min<tensor::index>(std::max<tensor::index>(2 * neig + 1, 20), n);
+    if (n <= 4 || m <= neig) {
+      RTensor values = lanczos_dense(A, n, eig_type, neig, vectors);
+      delete A;
+      if (converged)
+        *converged = true;
+      return values;
+    }
+    tensor::index maxit = std::max<tensor::index>(300, (tensor::index)ceil(2.0 * n / m));
+
+    Tensor<elt_t> basis(n, m + 1), c(m + 1);
+    Tensor<elt_t> restart(std::min<tensor::index>(n, LANCZOS_ROW_BLOCK), m);
+    elt_t *V = basis.begin();
+    RTensor T(m, m), Y, theta;
+    RTensor alpha(m), beta(m);
+    Indices order;
+
+    /* Starting vector */
+    if (vectors && vectors->size() >= n) {
+      std::copy(vectors->begin_const(), vectors->begin_const() + n, V);
+      double norm = lanczos_norm(n, V);
+      if (norm > 0) {
+        for (tensor::index i = 0; i < n; i++) V[i] /= norm;
+      } else {
+        lanczos_random_vector(n, 0, V, V, c.begin());
+      }
+    } else {
+      lanczos_random_vector(n, 0, V, V, c.begin());
+    }
+
+    double anorm = 0;
+    tensor::index l = 0, nconv = 0, iter;
+    for (iter = 0; iter < maxit; iter++) {
+      T.fill_with_zeros();
+      for (tensor::index i = 0; i < l; i++) {
+        T.at(i,i) = alpha.at(i);
+        T.at(i,l) = T.at(l,i) = beta.at(i);
+      }
+      for (tensor::index j = l; j < m; j++) {
+        elt_t *vj = V + j * n, *w = vj + n;
+        A->apply(n, vj, w);
+        if (j > l) {
+          double bold = beta.at(j-1);
+          const elt_t *vold = vj - n;
+          for (tensor::index i = 0; i < n; i++) w[i] -= bold * vold[i];
+        }
+        /* Project onto the basis. At the start of a cycle this removes the
+         * coupling to the kept Ritz vectors. Later on, only the diagonal
+         * element is needed, and the remaining overlaps are only subtracted
+         * when orthogonality has been lost. */
+        double norm = lanczos_norm(n, w);
+        blas::gemv('C', n, j + 1, one, V, n, w, 1, zero, c.begin(), 1);
+        double a = real(c[j]), b;
+        double overlap = 0;
+        for (tensor::index k = 0; k < j; k++)
+          overlap = std::max(overlap, abs(c[k]));
+        if (j == l || overlap > reorth_tol * norm) {
+          blas::gemv('N', n, j + 1, -one, V, n, c.begin_const(), 1, one, w, 1);
+        } else {
+          for (tensor::index i = 0; i < n; i++) w[i] -= a * vj[i];
+        }
+        b = lanczos_norm(n, w);
+        if (b < 0.7071 * norm)
+          b = lanczos_orthogonalize(n, j + 1, V, w, c.begin(), b);
+        alpha.at(j) = a;
+        anorm = std::max(anorm, std::abs(a) + b + ((j > l)? beta.at(j-1) : 0.0));
+        /* Normalize, or restart the recurrence when the Krylov space is
+         * invariant. */
+        if (b <= eps * anorm) {
+          b = 0.0;
+          if (j + 1 < m) {
+            lanczos_random_vector(n, j + 1, V, w, c.begin());
+          }
+        } else {
+          for (tensor::index i = 0; i < n; i++) w[i] /= b;
+        }
+        beta.at(j) = b;
+        T.at(j,j) = a;
+        if (j + 1 < m) T.at(j,j+1) = T.at(j+1,j) = b;
+      }
+
+      /* Rayleigh-Ritz on the projected matrix */
+      theta = eig_sym(T, &Y);
+      order = lanczos_order(theta, eig_type);
+      double residual_norm = beta.at(m-1);
+      nconv = 0;
+      for (tensor::index i = 0; i < neig; i++) {
+        tensor::index k = order[i];
+        double value = std::abs(theta[k]);
+        if (std::abs(residual_norm * Y.at(m-1, k)) <= eps * std::max(eps23, value))
+          nconv++;
+      }
+      /* The Ritz vectors are built from V and Y after the loop, so the
+       * last cycle must not restart and overwrite V. */
+      if (nconv == neig || iter + 1 == maxit)
+        break;
+
+      /* Thick restart: keep the best Ritz vectors plus the residual. */
+      l = std::min<tensor::index>(neig + (m - neig) / 2, m - 1);
+      Tensor<elt_t> Yl(m, l);
+      for (tensor::index i = 0; i < l; i++) {
+        tensor::index k = order[i];
+        for (tensor::index r = 0; r < m; r++) Yl.at(r, i) = Y.at(r, k);
+        alpha.at(i) = theta[k];
+        beta.at(i) = residual_norm * Y.at(m-1, k);
+      }
+      /* Each block of rows of the new basis only depends on the same rows
+       * of the old one, which allows us to overwrite it in place. */
+      for (tensor::index r0 = 0; r0 < n; r0 += LANCZOS_ROW_BLOCK) {
+        tensor::index rows = std::min<tensor::index>(LANCZOS_ROW_BLOCK, n - r0);
+        blas::gemm('N', 'N', rows, l, m, one, V + r0, n, Yl.begin_const(), m,
+                   zero, restart.begin(), rows);
+        for (tensor::index i = 0; i < l; i++)
+          std::copy(restart.begin_const() + i * rows,
+                    restart.begin_const() + (i + 1) * rows, V + i * n + r0);
+      }
+      std::copy(V + m * n, V + (m + 1) * n, V + l * n);
+    }
+
+    delete A;
+    if (nconv < neig) {
+      std::cerr << "eigs_lanczos: Maximum number of iterations reached.\n";
+      if (!converged)
+        abort();
+    }
+    if (converged)
+      *converged = (nconv == neig);
+    RTensor values(neig);
+    Tensor<elt_t> Yk(m, neig);
+    for (tensor::index i = 0; i < neig; i++) {
+      tensor::index k = order[i];
+      values.at(i) = theta[k];
+      for (tensor::index r = 0; r < m; r++) Yk.at(r, i) = Y.at(r, k);
+    }
+    if (vectors) {
+      Tensor<elt_t> output(n, neig);
+      blas::gemm('N', 'N', n, neig, m, one, V, n, Yk.begin_const(), m,
+                 zero, output.begin(), n);
+      *vectors = output;
+    }
+    return values;
+  }
+
+} // namespace linalg
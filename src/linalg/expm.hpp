@@ -0,0 +1,389 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <cmath>
+#include <algorithm>
+#include <tensor/tensor.h>
+#include <tensor/linalg.h>
+#include "../arpack/gemv.cc"
+#include "../tensor/gemm.cc"
+
+namespace linalg {
+
+  using namespace tensor;
+
+#if defined(_MSC_VER) && (_MSC_VER < 1800)
+  static double log2(double n) { return log(n) / log((double)2.0); }
+  static double exp2(double n) { return exp(log((double)2.0) * n); }
+#endif
+
+  /* Largest 1-norms of 2^-s A for which the Pade approximant of degree
+   * 3, 5, 7, 9 and 13 is accurate to double precision (Higham, SIAM
+   * J. Matrix Anal. Appl. 26, 1179 (2005), Table 2.3). */
+  static const double expm_theta[5] = {
+    1.495585217958292e-2, 2.539398330063230e-1, 9.504178996162932e-1,
+    2.097847961257068e0, 5.371920351148152e0
+  };
+
+  /* Coefficients of the numerator of the [m/m] Pade approximants. The
+   * denominator uses the same numbers with alternating signs. */
+  static const double expm_b3[4] = { 120.0, 60.0, 12.0, 1.0 };
+  static const double expm_b5[6] = {
+    30240.0, 15120.0, 3360.0, 420.0, 30.0, 1.0
+  };
+  static const double expm_b7[8] = {
+    17297280.0, 8648640.0, 1995840.0, 277200.0, 25200.0, 1512.0, 56.0, 1.0
+  };
+  static const double expm_b9[10] = {
+    17643225600.0, 8821612800.0, 2075673600.0, 302702400.0, 30270240.0,
+    2162160.0, 110880.0, 3960.0, 90.0, 1.0
+  };
+  static const double expm_b13[14] = {
+    64764752532480000.0, 32382376266240000.0, 7771770303897600.0,
+    1187353796428800.0, 129060195264000.0, 10559470521600.0,
+    670442572800.0, 33522128640.0, 1323241920.0, 40840800.0, 960960.0,
+    16380.0, 182.0, 1.0
+  };
+
+  /* 1-norm (largest column sum) of a square matrix. */
+  template<typename elt_t>
+  static double
+  expm_norm1(const Tensor<elt_t> &A)
+  {
+    tensor::index n = A.rows();
+    const elt_t *p = A.begin();
+    double output = 0;
+    for (tensor::index j = 0; j < n; j++, p += n) {
+      double s = 0;
+      for (tensor::index i = 0; i < n; i++)
+        s += abs(p[i]);
+      output = std::max(output, s);
+    }
+    return output;
+  }
+
+  static inline double expm_sign(double x) { return (x < 0)? -1.0 : 1.0; }
+
+  static inline cdouble expm_sign(cdouble x) {
+    double a = abs(x);
+    return (a == 0)? number_one<cdouble>() : x / a;
+  }
+
+  /* Apply op(M)^p to the vector 'x', using 'y' as scratch space. The
+   * result is left in 'x'. */
+  template<typename elt_t>
+  static void
+  expm_power_apply(char op, tensor::index n, const elt_t *M, int p,
+                   elt_t *x, elt_t *y)
+  {
+    const elt_t one = number_one<elt_t>(), zero = number_zero<elt_t>();
+    for (int k = 0; k < p; k++) {
+      blas::gemv(op, n, n, one, M, n, x, 1, zero, y, 1);
+      std::copy(y, y + n, x);
+    }
+  }
+
+  /* Estimate ||M^p||_1 without forming the power, using Hager's
+   * algorithm as refined by Higham (ACM TOMS 14, 381 (1988)). Each step
+   * costs 2p matrix-vector products instead of the p-1 matrix products
+   * of computing the power explicitly. */
+  template<typename elt_t>
+  static double
+  expm_normest_power(const Tensor<elt_t> &M, int p)
+  {
+    tensor::index n = M.rows();
+    const elt_t *m = M.begin();
+    Tensor<elt_t> X(n), Y(n);
+    elt_t *x = X.begin(), *y = Y.begin();
+    std::fill(x, x + n, number_one<elt_t>() / (double)n);
+
+    double estimate = 0;
+    tensor::index last = n;
+    for (int iter = 0; iter < 5; iter++) {
+      expm_power_apply('N', n, m, p, x, y);
+      double new_estimate = 0;
+      for (tensor::index i = 0; i < n; i++)
+        new_estimate += abs(x[i]);
+      if (iter > 0 && new_estimate <= estimate)
+        break;
+      estimate = new_estimate;
+      for (tensor::index i = 0; i < n; i++)
+        x[i] = expm_sign(x[i]);
+      expm_power_apply('C', n, m, p, x, y);
+      tensor::index j = 0;
+      double zmax = 0;
+      elt_t zx = number_zero<elt_t>();
+      for (tensor::index i = 0; i < n; i++) {
+        double a = abs(x[i]);
+        if (a > zmax) {
+          zmax = a;
+          j = i;
+        }
+        zx += x[i];
+      }
+      /* Stop when no unit vector improves on the current one. */
+      zx = (iter == 0)? zx / (double)n : x[last];
+      if (zmax <= abs(zx))
+        break;
+      std::fill(x, x + n, number_zero<elt_t>());
+      x[last = j] = number_one<elt_t>();
+    }
+    /* Alternative vector that catches the cases in which the iteration
+     * gets trapped, as in LAPACK's xLACON. */
+    for (tensor::index i = 0; i < n; i++)
+      x[i] = ((i & 1)? -1.0 : 1.0) * (1.0 + (n > 1? (double)i / (n - 1) : 0.0));
+    expm_power_apply('N', n, m, p, x, y);
+    double alt = 0;
+    for (tensor::index i = 0; i < n; i++)
+      alt += abs(x[i]);
+    return std::max(estimate, 2 * alt / (3 * n));
+  }
+
+  /* Number of extra squarings needed to bring the backward error of the
+   * Pade approximant of degree 'm' for 'scale * A' to the unit roundoff
+   * (Al-Mohy and Higham, SIAM J. Matrix Anal. Appl. 31, 970 (2009)). This
+   * involves the exact 1-norm of |A|^(2m+1), which for a nonnegative
+   * matrix only requires vector products. */
+  template<typename elt_t>
+  static int
+  expm_ell(const Tensor<elt_t> &A, double scale, double norm1, int m)
+  {
+    tensor::index n = A.rows();
+    int p = 2 * m + 1;
+    RTensor V(n), W(n);
+    double *v = V.begin(), *w = W.begin();
+    std::fill(v, v + n, 1.0);
+    const elt_t *a = A.begin();
+    for (int k = 0; k < p; k++) {
+      /* w = v' * |scale * A| */
+      for (tensor::index j = 0; j < n; j++) {
+        const elt_t *column = a + j * n;
+        double s = 0;
+        for (tensor::index i = 0; i < n; i++)
+          s += v[i] * abs(column[i]);
+        w[j] = s * scale;
+      }
+      std::swap(v, w);
+    }
+    double abs_norm = *std::max_element(v, v + n);
+    if (abs_norm == 0)
+      return 0;
+    /* 1/|c_{2m+1}| = binomial(2m,m) * (2m+1)! */
+    double c_recip = 1;
+    for (int k = 1; k <= m; k++)
+      c_recip = c_recip * (m + k) / k;
+    for (int k = 2; k <= p; k++)
+      c_recip *= k;
+    double alpha = abs_norm / (scale * norm1 * c_recip);
+    int value = (int)ceil(log2(alpha / exp2(-53.0)) / (2 * m));
+    return std::max(value, 0);
+  }
+
+  /* Linear combination c[0] * 1 + c[1] * P[0] + ... + c[count] * P[count-1]
+   * of the identity and the matrices 'P', computed in a single pass
+   * instead of with a chain of temporaries. */
+  template<typename elt_t>
+  static const Tensor<elt_t>
+  expm_combine(const Tensor<elt_t> *P, const double *c, int count)
+  {
+    tensor::index n = P[0].rows();
+    Tensor<elt_t> output(n, n);
+    elt_t *out = output.begin();
+    const elt_t *p[6];
+    for (int k = 0; k < count; k++)
+      p[k] = P[k].begin();
+    for (tensor::index i = 0; i < n * n; i++) {
+      elt_t x = number_zero<elt_t>();
+      for (int k = 0; k < count; k++)
+        x += c[k + 1] * p[k][i];
+      out[i] = x;
+    }
+    for (tensor::index i = 0; i < n; i++)
+      out[i * (n + 1)] += c[0];
+    return output;
+  }
+
+  /* Solve (V - U) X = (V + U), the last step of every Pade approximant. */
+  template<typename elt_t>
+  static const Tensor<elt_t>
+  expm_pade_solve(const Tensor<elt_t> &U, const Tensor<elt_t> &V)
+  {
+    tensor::index n = U.rows();
+    Tensor<elt_t> P(n, n), Q(n, n);
+    const elt_t *u = U.begin(), *v = V.begin();
+    elt_t *p = P.begin(), *q = Q.begin();
+    for (tensor::index i = 0; i < n * n; i++) {
+      p[i] = v[i] - u[i];
+      q[i] = v[i] + u[i];
+    }
+    return solve(P, Q);
+  }
+
+  /* Pade approximant of degree 3, 5, 7 or 9, reusing the even powers
+   * A^2, A^4,... that were computed while choosing the degree. */
+  template<typename elt_t>
+  static const Tensor<elt_t>
+  expm_pade(const Tensor<elt_t> &A, const Tensor<elt_t> *powers, int m)
+  {
+    const double *b = (m == 3)? expm_b3 : (m == 5)? expm_b5 :
+      (m == 7)? expm_b7 : expm_b9;
+    double odd[5], even[5];
+    for (int k = 0; 2 * k <= m; k++) {
+      even[k] = b[2 * k];
+      odd[k] = b[2 * k + 1];
+    }
+    Tensor<elt_t> U = mmult(A, expm_combine(powers, odd, m / 2));
+    return expm_pade_solve(U, expm_combine(powers, even, m / 2));
+  }
+
+  /* Pade approximant of degree 13 for the matrix 2^-s A, built from the
+   * powers A^2, A^4 and A^6 of the unscaled matrix with three extra
+   * products. The scaling is absorbed into the coefficients. */
+  template<typename elt_t>
+  static const Tensor<elt_t>
+  expm_pade13(const Tensor<elt_t> &A, const Tensor<elt_t> *powers, int s)
+  {
+    const double *b = expm_b13;
+    double c[14];
+    c[0] = 1.0;
+    for (int k = 1; k < 14; k++)
+      c[k] = c[k - 1] * exp2(-s);
+    double odd_high[4] = { 0.0, b[9] * c[9], b[11] * c[11], b[13] * c[13] };
+    double odd_low[4] = { b[1] * c[1], b[3] * c[3], b[5] * c[5], b[7] * c[7] };
+    double even_high[4] = { 0.0, b[8] * c[8], b[10] * c[10], b[12] * c[12] };
+    double even_low[4] = { b[0], b[2] * c[2], b[4] * c[4], b[6] * c[6] };
+
+    tensor::index n = A.rows();
+    const elt_t one = number_one<elt_t>();
+    Tensor<elt_t> W = expm_combine(powers, odd_low, 3);
+    Tensor<elt_t> X = expm_combine(powers, odd_high, 3);
+    blas::gemm('N', 'N', n, n, n, one, powers[2].begin(), n, X.begin(), n,
+               one, W.begin(), n);
+    Tensor<elt_t> U = mmult(A, W);
+    Tensor<elt_t> V = expm_combine(powers, even_low, 3);
+    X = expm_combine(powers, even_high, 3);
+    blas::gemm('N', 'N', n, n, n, one, powers[2].begin(), n, X.begin(), n,
+               one, V.begin(), n);
+    return expm_pade_solve(U, V);
+  }
+
+  /* Square 'X' in place 's' times. Two buffers are used alternately, so
+   * that no memory is allocated beyond the first one. */
+  template<typename elt_t>
+  static const Tensor<elt_t>
+  expm_square(Tensor<elt_t> X, int s)
+  {
+    if (s <= 0)
+      return X;
+    const elt_t one = number_one<elt_t>(), zero = number_zero<elt_t>();
+    tensor::index n = X.rows();
+    Tensor<elt_t> Y(n, n);
+    elt_t *x = X.begin(), *y = Y.begin();
+    for (int k = 0; k < s; k++) {
+      blas::gemm('N', 'N', n, n, n, one, x, n, x, n, zero, y, n);
+      std::swap(x, y);
+    }
+    return (x == X.begin())? X : Y;
+  }
+
+  /* Scaling and squaring algorithm of Al-Mohy and Higham (2009). The
+   * degree of the Pade approximant and the number of squarings are chosen
+   * from the quantities ||A^k||^(1/k), which can be much smaller than
+   * ||A|| for nonnormal matrices and thus avoid overscaling. Whenever
+   * possible these norms are estimated from matrix-vector products, and
+   * the powers of A that are computed are shared by all the degrees. */
+  template<typename elt_t>
+  static const Tensor<elt_t>
+  expm_higham(const Tensor<elt_t> &A)
+  {
+    assert(A.rank() == 2);
+    assert(A.columns() == A.rows());
+    if (A.rows() == 0)
+      return A;
+
+    double norm1 = expm_norm1(A);
+    Tensor<elt_t> powers[4];
+    powers[0] = mmult(A, A);
+    double d4 = pow(expm_normest_power(powers[0], 2), 1.0/4);
+    double d6 = pow(expm_normest_power(powers[0], 3), 1.0/6);
+    double eta = std::max(d4, d6);
+    if (eta <= expm_theta[0] && expm_ell(A, 1.0, norm1, 3) == 0)
+      return expm_pade(A, powers, 3);
+
+    powers[1] = mmult(powers[0], powers[0]);
+    d4 = pow(expm_norm1(powers[1]), 1.0/4);
+    eta = std::max(d4, d6);
+    if (eta <= expm_theta[1] && expm_ell(A, 1.0, norm1, 5) == 0)
+      return expm_pade(A, powers, 5);
+
+    powers[2] = mmult(powers[1], powers[0]);
+    d6 = pow(expm_norm1(powers[2]), 1.0/6);
+    double d8 = pow(expm_normest_power(powers[1], 2), 1.0/8);
+    eta = std::max(d6, d8);
+    if (eta <= expm_theta[2] && expm_ell(A, 1.0, norm1, 7) == 0)
+      return expm_pade(A, powers, 7);
+    if (eta <= expm_theta[3] && expm_ell(A, 1.0, norm1, 9) == 0) {
+      powers[3] = mmult(powers[1], powers[1]);
+      return expm_pade(A, powers, 9);
+    }
+
+    double d10 = pow(expm_normest_power(powers[0], 5), 1.0/10);
+    eta = std::min(eta, std::max(d8, d10));
+    int s = std::max(0, (int)ceil(log2(eta / expm_theta[4])));
+    s += expm_ell(A, exp2(-s), norm1, 13);
+    return expm_square(expm_pade13(A, powers, s), s);
+  }
+
+  /* Pade approximant of fixed 'order' with the matrix scaled until its
+   * infinity norm is below 1/2. This was the only algorithm before the
+   * adaptive one above, and it is kept for code that relies on it. */
+  template<typename elt_t>
+  static const Tensor<elt_t>
+  expm_fixed(const Tensor<elt_t> &Aunorm, unsigned int order)
+  {
+    assert(Aunorm.rank() == 2);
+    assert(Aunorm.columns() == Aunorm.rows());
+
+    // Scale A until the norm is < 1/2
+    double val = log2(matrix_norminf(Aunorm));
+    int e = (int)floor(val);
+    int j = std::max((int)0, (int)(e+1));
+
+    // Pade approximation for exp(A)
+    double c = 1.0/2;
+    Tensor<elt_t> A = Aunorm / exp2(j);
+    Tensor<elt_t> N = Tensor<elt_t>::eye(A.rows()) + c * A;
+    Tensor<elt_t> D = Tensor<elt_t>::eye(A.rows()) - c * A;
+    Tensor<elt_t> X = A;
+
+    for (size_t k = 2; k <= order; k++) {
+      c = (c * (order-k+1)) / (k*(2*order-k+1));
+      X = mmult(A, X);
+      Tensor<elt_t> cX = c * X;
+      N = N + cX;
+      if ((k & 1) == 0) {
+        D = D + cX;
+      } else {
+        D = D - cX;
+      }
+    }
+    return expm_square(solve(D, N), j);
+  }
+
+} // namespace linalg
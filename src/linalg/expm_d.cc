@@ -17,66 +17,34 @@
     51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
 */
 
-#include <algorithm>
-#include <tensor/tensor.h>
-#include <tensor/linalg.h>
-#include <tensor/io.h>
+#include "expm.hpp"
 
 namespace linalg {
 
-#if defined(_MSC_VER) && (_MSC_VER < 1800)
-  static double log2(double n) { return log(n) / log((double)2.0); }
-  static double exp2(double n) { return exp(log((double)2.0) * n); }
-#endif
-
 /**Compute the exponential of a real matrix.
    This function computes the exponential of a matrix using a Pade
-   approximation of any given order.
+   approximation combined with scaling and squaring.
 
    This is potentially more accurate than using the eigenvalues of the matrix
    or a Taylor expansion of the exponential, and much faster, since it only
    involves products of matrices and solving one system of equations.
 
-   The current algorithm has been adapted from Scientific Python, the version
-   written by Travis Oliphant (2002). It is slightly more accurate than the
-   same Matlab version when computed with the default order of 7.
+   With the default \a order = 0, the degree of the approximant (3, 5, 7, 9
+   or 13) and the number of squarings are chosen following Al-Mohy and
+   Higham (2009), using estimates of the 1-norms of the powers of \a A. This
+   needs the smallest number of matrix products that achieves double
+   precision. A nonzero \a order selects the older algorithm, with a Pade
+   approximant of that order and the matrix scaled until its norm is below
+   1/2, adapted from Scientific Python (Travis Oliphant, 2002).
 
    \ingroup Linalg
 */
   const RTensor
-  expm(const RTensor &Aunorm, unsigned int order)
+  expm(const RTensor &A, unsigned int order)
   {
-    assert(Aunorm.rank() == 2);
-    assert(Aunorm.columns() == Aunorm.rows());
-
-    // Scale A until the norm is < 1/2
-    double val = log2(matrix_norminf(Aunorm));
-    int e = (int)floor(val);
-    size_t j = std::max((int)0, (int)(e+1));
-
-    // Pade approximation for exp(A)
-    double c = 1.0/2;
-    RTensor A = Aunorm / exp2(j);
-    RTensor N = RTensor::eye(A.rows()) + c * A;
-    RTensor D = RTensor::eye(A.rows()) - c * A;
-    RTensor X = A;
-
-    for (size_t k = 2; k <= order; k++) {
-      c = (c * (order-k+1)) / (k*(2*order-k+1));
-      X = mmult(A, X);
-      RTensor cX = c * X;
-      N = N + cX;
-      if ((k & 1) == 0) {
-        D = D + cX;
-      } else {
-        D = D - cX;
-      }
-    }
-    X = solve(D, N);
-    for (size_t k = 1; k <= j; k++) {
-      X = mmult(X, X);
-    }
-    return X;
-}
+    if (order == 0)
+      return expm_higham(A);
+    return expm_fixed(A, order);
+  }
 
-}
+} // namespace linalg
@@ -0,0 +1,211 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <cfloat>
+#include <cmath>
+#include <algorithm>
+#include <tensor/tensor.h>
+#include <tensor/linalg.h>
+#include "../arpack/gemv.cc"
+
+namespace linalg {
+
+  using namespace tensor;
+
+  /* Default dimension of the Krylov subspace. */
+  static const tensor::index EXPMV_KRYLOV_DIM = 30;
+  /* Maximum number of times that a step is rejected and shortened. */
+  static const int EXPMV_MAX_REJECTIONS = 10;
+
+  template<typename elt_t>
+  static double
+  expmv_norm(tensor::index n, const elt_t *v)
+  {
+    double output = 0;
+    for (tensor::index i = 0; i < n; i++)
+      output += abs2(v[i]);
+    return sqrt(output);
+  }
+
+  /* Round a step to two significant digits, so that the fractions of the
+   * time interval do not accumulate spurious digits. */
+  static double
+  expmv_round(double tau)
+  {
+    if (tau <= 0)
+      return tau;
+    double scale = pow(10.0, floor(log10(tau)) - 1);
+    return ceil(tau / scale) * scale;
+  }
+
+  /* Arnoldi process with the vector in the first column of 'V' (n x (m+1)),
+   * which must be normalized. Columns are orthogonalized with two passes of
+   * classical Gram-Schmidt, and the coefficients are stored in 'H', of
+   * leading dimension 'ldh'. Returns the dimension of the Krylov space,
+   * which is smaller than 'm' when it becomes invariant ("happy
+   * breakdown"). 'c' is a buffer of m+1 elements. */
+  template<typename elt_t>
+  static tensor::index
+  expmv_arnoldi(const Map<Tensor<elt_t> > *A, tensor::index n, tensor::index m,
+                elt_t *V, elt_t *H, tensor::index ldh, elt_t *c, bool *happy)
+  {
+    const elt_t one = number_one<elt_t>(), zero = number_zero<elt_t>();
+    double hscale = 0;
+    for (tensor::index j = 0; j < m; j++) {
+      elt_t *w = V + (j + 1) * n;
+      A->apply(n, V + j * n, w);
+      elt_t *h = H + j * ldh;
+      std::fill(h, h + j + 1, zero);
+      for (int pass = 0; pass < 2; pass++) {
+        blas::gemv('C', n, j + 1, one, V, n, w, 1, zero, c, 1);
+        blas::gemv('N', n, j + 1, -one, V, n, c, 1, one, w, 1);
+        for (tensor::index i = 0; i <= j; i++)
+          h[i] += c[i];
+      }
+      double norm = expmv_norm(n, w);
+      for (tensor::index i = 0; i <= j; i++)
+        hscale = std::max(hscale, abs(h[i]));
+      h[j + 1] = norm;
+      if (norm <= 1e-12 * std::max(1.0, hscale)) {
+        *happy = true;
+        return j + 1;
+      }
+      for (tensor::index i = 0; i < n; i++)
+        w[i] /= norm;
+    }
+    *happy = false;
+    return m;
+  }
+
+  /* Action of the exponential exp(t*A) on a vector, with the Krylov method
+   * and the adaptive time stepping of Expokit (R. B. Sidje, ACM Trans.
+   * Math. Softw. 24, 130 (1998)). The interval [0,t] is covered with steps
+   * tau*t; in each of them we build an Arnoldi basis of dimension 'm' and
+   * exponentiate the small Hessenberg matrix, augmented with two rows that
+   * provide the error estimate. Steps whose local error exceeds tau*tol are
+   * rejected and shortened; accepted steps suggest the length of the next
+   * one. */
+  template<typename elt_t>
+  const Tensor<elt_t>
+  expmv_loop(const Map<Tensor<elt_t> > *A, elt_t t, const Tensor<elt_t> &v,
+             double tol, int krylov_dim)
+  {
+    const elt_t zero = number_zero<elt_t>();
+    const double gamma = 0.9, delta = 1.2;
+    tensor::index n = v.size();
+    Tensor<elt_t> w(v.dimensions());
+    std::copy(v.begin_const(), v.end_const(), w.begin());
+    double beta0 = expmv_norm(n, w.begin_const());
+    if (n == 0 || beta0 == 0 || abs(t) == 0)
+      return w;
+    if (tol <= 0)
+      tol = 1e-10;
+    tensor::index m = (krylov_dim > 0)? krylov_dim : EXPMV_KRYLOV_DIM;
+    m = std::max<tensor::index>(1, std::min<tensor::index>(m, n));
+    double abs_tol = tol * beta0;
+
+    Tensor<elt_t> basis(n, m + 1), c(m + 1), Av(n);
+    Tensor<elt_t> H(m + 2, m + 2);
+    elt_t *V = basis.begin(), *pw = w.begin();
+    double s = 0, tau = 0;
+    bool first = true;
+    while (true) {
+      double beta = expmv_norm(n, pw);
+      for (tensor::index i = 0; i < n; i++)
+        V[i] = pw[i] / beta;
+      H.fill_with_zeros();
+      bool happy;
+      tensor::index k = expmv_arnoldi(A, n, m, V, H.begin(), m + 2,
+                                      c.begin(), &happy);
+      for (tensor::index j = 0; j < m + 2; j++)
+        for (tensor::index i = 0; i < m + 2; i++)
+          H.at(i, j) *= t;
+
+      Tensor<elt_t> F;
+      double err = 0, xm = 1.0 / m;
+      tensor::index mx;
+      if (happy) {
+        /* The Krylov space is invariant: the step is exact */
+        tau = 1 - s;
+        Tensor<elt_t> Hk(k, k);
+        for (tensor::index j = 0; j < k; j++)
+          for (tensor::index i = 0; i < k; i++)
+            Hk.at(i, j) = H(i, j);
+        F = expm(tau * Hk);
+        mx = k;
+      } else {
+        /* Norm of A v_{m+1}, for the error estimate */
+        A->apply(n, V + m * n, Av.begin());
+        double avnorm = abs(t) * expmv_norm(n, Av.begin_const());
+        H.at(m + 1, m) = number_one<elt_t>();
+        if (first) {
+          double hnorm = 0;
+          for (tensor::index j = 0; j < m; j++) {
+            double column = 0;
+            for (tensor::index i = 0; i <= m; i++)
+              column += abs(H(i, j));
+            hnorm = std::max(hnorm, column);
+          }
+          double fact = pow((m + 1) / exp(1.0), (double)(m + 1)) *
+            sqrt(8 * atan(1.0) * (m + 1));
+          tau = (hnorm > 0)?
+            expmv_round(pow((fact * abs_tol) / (4 * beta * hnorm), xm) / hnorm) : 1;
+          first = false;
+        }
+        tau = std::min(tau, 1 - s);
+        for (int rejections = 0; ; rejections++) {
+          F = expm(tau * H);
+          double err1 = beta * abs(F(m, 0));
+          double err2 = beta * abs(F(m + 1, 0)) * avnorm;
+          if (err1 > 10 * err2) {
+            err = err2;
+            xm = 1.0 / m;
+          } else if (err1 > err2) {
+            err = (err2 * err1) / (err1 - err2);
+            xm = 1.0 / m;
+          } else {
+            err = err1;
+            xm = 1.0 / std::max<tensor::index>(1, m - 1);
+          }
+          if (err <= delta * tau * abs_tol)
+            break;
+          if (rejections == EXPMV_MAX_REJECTIONS) {
+            std::cerr << "In expmv(), the requested tolerance " << tol
+                      << " is too small.\n";
+            abort();
+          }
+          tau = expmv_round(gamma * tau * pow(tau * abs_tol / err, xm));
+        }
+        mx = m + 1;
+      }
+      /* w = beta * V * F(:,0) */
+      for (tensor::index i = 0; i < mx; i++)
+        c.at(i) = beta * F(i, 0);
+      blas::gemv('N', n, mx, number_one<elt_t>(), V, n, c.begin_const(), 1,
+                 zero, pw, 1);
+      if (happy || tau >= 1 - s)
+        break;
+      s += tau;
+      double next = (err > 0)? gamma * tau * pow(tau * abs_tol / err, xm) : 1;
+      tau = expmv_round(std::min(next, 1.0));
+    }
+    return w;
+  }
+
+} // namespace linalg
@@ -0,0 +1,42 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include "expmv.hpp"
+
+namespace linalg {
+
+  /**Compute exp(t*A)*v for a real linear map, using a Krylov method with
+     adaptive time steps.*/
+  const RTensor
+  expmv(const Map<RTensor> *A, double t, const RTensor &v, double tol,
+        int krylov_dim)
+  {
+    return expmv_loop(A, t, v, tol, krylov_dim);
+  }
+
+  /**Compute exp(t*A)*v for a real sparse matrix.*/
+  const RTensor
+  expmv(const RSparse &A, double t, const RTensor &v, double tol,
+        int krylov_dim)
+  {
+    tensor::MatrixMap<RSparse> op(A);
+    return expmv_loop<double>(&op, t, v, tol, krylov_dim);
+  }
+
+} // namespace linalg
@@ -0,0 +1,596 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <vector>
+#include <algorithm>
+#include <tensor/tensor.h>
+#include <tensor/io.h>
+#include <tensor/tensor_lapack.h>
+#include <tensor/linalg.h>
+#include "lapack_workspace.hpp"
+
+namespace linalg {
+
+  using namespace lapack;
+  using tensor::Tensor;
+  using tensor::Indices;
+
+  /* Calls to the LAPACK drivers, overloaded on the element type. All of
+   * them operate on the lower triangle ('L') of symmetric matrices. The
+   * condition estimators allocate their own work arrays. */
+
+  static inline void
+  factor_getrf(integer n, double *a, integer *ipiv, integer *info)
+  {
+#ifdef TENSOR_USE_ACML
+    dgetrf(n, n, a, n, ipiv, info);
+#else
+    F77NAME(dgetrf)(&n, &n, a, &n, ipiv, info);
+#endif
+  }
+
+  static inline void
+  factor_getrf(integer n, cdouble *a, integer *ipiv, integer *info)
+  {
+#ifdef TENSOR_USE_ACML
+    zgetrf(n, n, a, n, ipiv, info);
+#else
+    F77NAME(zgetrf)(&n, &n, a, &n, ipiv, info);
+#endif
+  }
+
+  static inline void
+  factor_getrs(integer n, integer nrhs, double *a, integer *ipiv, double *b,
+               integer *info)
+  {
+    char trans = 'N';
+#ifdef TENSOR_USE_ACML
+    dgetrs(trans, n, nrhs, a, n, ipiv, b, n, info);
+#else
+    F77NAME(dgetrs)(&trans, &n, &nrhs, a, &n, ipiv, b, &n, info);
+#endif
+  }
+
+  static inline void
+  factor_getrs(integer n, integer nrhs, cdouble *a, integer *ipiv,
+               cdouble *b, integer *info)
+  {
+    char trans = 'N';
+#ifdef TENSOR_USE_ACML
+    zgetrs(trans, n, nrhs, a, n, ipiv, b, n, info);
+#else
+    F77NAME(zgetrs)(&trans, &n, &nrhs, a, &n, ipiv, b, &n, info);
+#endif
+  }
+
+  static inline double
+  factor_gecon(integer n, double *a, double anorm)
+  {
+    char norm = '1';
+    double rcond;
+    integer info;
+#ifdef TENSOR_USE_ACML
+    dgecon(norm, n, a, n, anorm, &rcond, &info);
+#else
+    double *work = new double[4 * n];
+    integer *iwork = new integer[n];
+    F77NAME(dgecon)(&norm, &n, a, &n, &anorm, &rcond, work, iwork, &info);
+    delete[] work;
+    delete[] iwork;
+#endif
+    return rcond;
+  }
+
+  static inline double
+  factor_gecon(integer n, cdouble *a, double anorm)
+  {
+    char norm = '1';
+    double rcond;
+    integer info;
+#ifdef TENSOR_USE_ACML
+    zgecon(norm, n, a, n, anorm, &rcond, &info);
+#else
+    cdouble *work = new cdouble[2 * n];
+    double *rwork = new double[2 * n];
+    F77NAME(zgecon)(&norm, &n, a, &n, &anorm, &rcond, work, rwork, &info);
+    delete[] work;
+    delete[] rwork;
+#endif
+    return rcond;
+  }
+
+  static inline void
+  factor_potrf(integer n, double *a, integer *info)
+  {
+    char uplo = 'L';
+#ifdef TENSOR_USE_ACML
+    dpotrf(uplo, n, a, n, info);
+#else
+    F77NAME(dpotrf)(&uplo, &n, a, &n, info);
+#endif
+  }
+
+  static inline void
+  factor_potrf(integer n, cdouble *a, integer *info)
+  {
+    char uplo = 'L';
+#ifdef TENSOR_USE_ACML
+    zpotrf(uplo, n, a, n, info);
+#else
+    F77NAME(zpotrf)(&uplo, &n, a, &n, info);
+#endif
+  }
+
+  static inline void
+  factor_potrs(integer n, integer nrhs, double *a, double *b, integer *info)
+  {
+    char uplo = 'L';
+#ifdef TENSOR_USE_ACML
+    dpotrs(uplo, n, nrhs, a, n, b, n, info);
+#else
+    F77NAME(dpotrs)(&uplo, &n, &nrhs, a, &n, b, &n, info);
+#endif
+  }
+
+  static inline void
+  factor_potrs(integer n, integer nrhs, cdouble *a, cdouble *b, integer *info)
+  {
+    char uplo = 'L';
+#ifdef TENSOR_USE_ACML
+    zpotrs(uplo, n, nrhs, a, n, b, n, info);
+#else
+    F77NAME(zpotrs)(&uplo, &n, &nrhs, a, &n, b, &n, info);
+#endif
+  }
+
+  static inline double
+  factor_pocon(integer n, double *a, double anorm)
+  {
+    char uplo = 'L';
+    double rcond;
+    integer info;
+#ifdef TENSOR_USE_ACML
+    dpocon(uplo, n, a, n, anorm, &rcond, &info);
+#else
+    double *work = new double[3 * n];
+    integer *iwork = new integer[n];
+    F77NAME(dpocon)(&uplo, &n, a, &n, &anorm, &rcond, work, iwork, &info);
+    delete[] work;
+    delete[] iwork;
+#endif
+    return rcond;
+  }
+
+  static inline double
+  factor_pocon(integer n, cdouble *a, double anorm)
+  {
+    char uplo = 'L';
+    double rcond;
+    integer info;
+#ifdef TENSOR_USE_ACML
+    zpocon(uplo, n, a, n, anorm, &rcond, &info);
+#else
+    cdouble *work = new cdouble[2 * n];
+    double *rwork = new double[n];
+    F77NAME(zpocon)(&uplo, &n, a, &n, &anorm, &rcond, work, rwork, &info);
+    delete[] work;
+    delete[] rwork;
+#endif
+    return rcond;
+  }
+
+  static inline void
+  factor_sytrf(integer n, double *a, integer *ipiv, double *work,
+               integer lwork, integer *info)
+  {
+    char uplo = 'L';
+#ifdef TENSOR_USE_ACML
+    if (lwork < 0) { *work = 1; *info = 0; return; }
+    dsytrf(uplo, n, a, n, ipiv, info);
+#else
+    F77NAME(dsytrf)(&uplo, &n, a, &n, ipiv, work, &lwork, info);
+#endif
+  }
+
+  static inline void
+  factor_sytrf(integer n, cdouble *a, integer *ipiv, cdouble *work,
+               integer lwork, integer *info)
+  {
+    char uplo = 'L';
+#ifdef TENSOR_USE_ACML
+    if (lwork < 0) { *work = 1; *info = 0; return; }
+    zhetrf(uplo, n, a, n, ipiv, info);
+#else
+    F77NAME(zhetrf)(&uplo, &n, a, &n, ipiv, work, &lwork, info);
+#endif
+  }
+
+  static inline void
+  factor_sytrs(integer n, integer nrhs, double *a, integer *ipiv, double *b,
+               integer *info)
+  {
+    char uplo = 'L';
+#ifdef TENSOR_USE_ACML
+    dsytrs(uplo, n, nrhs, a, n, ipiv, b, n, info);
+#else
+    F77NAME(dsytrs)(&uplo, &n, &nrhs, a, &n, ipiv, b, &n, info);
+#endif
+  }
+
+  static inline void
+  factor_sytrs(integer n, integer nrhs, cdouble *a, integer *ipiv,
+               cdouble *b, integer *info)
+  {
+    char uplo = 'L';
+#ifdef TENSOR_USE_ACML
+    zhetrs(uplo, n, nrhs, a, n, ipiv, b, n, info);
+#else
+    F77NAME(zhetrs)(&uplo, &n, &nrhs, a, &n, ipiv, b, &n, info);
+#endif
+  }
+
+  static inline double
+  factor_sycon(integer n, double *a, integer *ipiv, double anorm)
+  {
+    char uplo = 'L';
+    double rcond;
+    integer info;
+#ifdef TENSOR_USE_ACML
+    dsycon(uplo, n, a, n, ipiv, anorm, &rcond, &info);
+#else
+    double *work = new double[2 * n];
+    integer *iwork = new integer[n];
+    F77NAME(dsycon)(&uplo, &n, a, &n, ipiv, &anorm, &rcond, work, iwork,
+                    &info);
+    delete[] work;
+    delete[] iwork;
+#endif
+    return rcond;
+  }
+
+  static inline double
+  factor_sycon(integer n, cdouble *a, integer *ipiv, double anorm)
+  {
+    char uplo = 'L';
+    double rcond;
+    integer info;
+#ifdef TENSOR_USE_ACML
+    zhecon(uplo, n, a, n, ipiv, anorm, &rcond, &info);
+#else
+    cdouble *work = new cdouble[2 * n];
+    F77NAME(zhecon)(&uplo, &n, a, &n, ipiv, &anorm, &rcond, work, &info);
+    delete[] work;
+#endif
+    return rcond;
+  }
+
+  /* Size of a square matrix, aborting with a message for other shapes. */
+  template<class Tensor>
+  static integer
+  factor_check_square(const Tensor &A, const char *name)
+  {
+    if (A.rank() != 2 || A.rows() != A.columns() || A.rows() == 0) {
+      std::cerr << "In " << name << "(A), the matrix must be square and "
+                << "nonempty, but it has dimensions " << A.dimensions()
+                << std::endl;
+      abort();
+    }
+    return A.rows();
+  }
+
+  /* Number of right hand sides in B, which is a vector of 'n' elements or
+   * has 'n' rows. */
+  template<class Tensor>
+  static integer
+  factor_check_rhs(const Tensor &B, integer n, const char *name)
+  {
+    if (n == 0) {
+      std::cerr << "In " << name << "::solve(), no matrix has been factored."
+                << std::endl;
+      abort();
+    }
+    if (B.rank() == 0 || (integer)B.dimension(0) != n) {
+      std::cerr << "In " << name << "::solve(B), the number of equations does "
+                << "not match the number of right\nhand members. While the "
+                << "matrix has " << n << " rows, B has dimensions "
+                << B.dimensions() << std::endl;
+      abort();
+    }
+    return B.size() / n;
+  }
+
+  /* 1-norm of A, or of the Hermitian matrix whose lower triangle is that of
+   * A, as required by the condition estimators. */
+  template<typename elt_t>
+  static double
+  factor_norm1(const Tensor<elt_t> &A, bool hermitian)
+  {
+    tensor::index n = A.rows();
+    const elt_t *a = A.begin_const();
+    std::vector<double> sums(n, 0.0);
+    for (tensor::index j = 0; j < n; j++, a += n) {
+      if (hermitian) {
+        for (tensor::index i = j; i < n; i++) {
+          double x = tensor::abs(a[i]);
+          sums[j] += x;
+          if (i != j) sums[i] += x;
+        }
+      } else {
+        for (tensor::index i = 0; i < n; i++)
+          sums[j] += tensor::abs(a[i]);
+      }
+    }
+    return *std::max_element(sums.begin(), sums.end());
+  }
+
+  static inline void
+  factor_store_pivots(const integer *ipiv, integer n, Indices *pivots)
+  {
+    *pivots = Indices(n);
+    std::copy(ipiv, ipiv + n, pivots->begin());
+  }
+
+  static inline integer *
+  factor_load_pivots(const Indices &pivots)
+  {
+    integer *ipiv = new integer[pivots.size()];
+    std::copy(pivots.begin_const(), pivots.end_const(), ipiv);
+    return ipiv;
+  }
+
+  /* Pointer to the factors, which LAPACK does not modify when solving. */
+  template<class Tensor>
+  static inline typename lapack_type<typename Tensor::elt_t>::type *
+  factor_pointer(const Tensor &factors)
+  {
+    typedef typename lapack_type<typename Tensor::elt_t>::type lapack_t;
+    return const_cast<lapack_t *>(tensor_pointer(factors));
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // LU
+  //
+
+  template<class Tensor>
+  LU<Tensor>::LU() : factors_(), pivots_(), rcond_(0.0)
+  {}
+
+  template<class Tensor>
+  LU<Tensor>::LU(const Tensor &A) : factors_(), pivots_(), rcond_(0.0)
+  {
+    if (!factor(A)) {
+      std::cerr << "In LU(A), the matrix is singular." << std::endl;
+      abort();
+    }
+  }
+
+  template<class Tensor>
+  bool
+  LU<Tensor>::factor(const Tensor &A)
+  {
+    integer n = factor_check_square(A, "LU");
+    double anorm = factor_norm1(A, false);
+    factors_ = A;
+    integer *ipiv = new integer[n], info;
+    factor_getrf(n, tensor_pointer(factors_), ipiv, &info);
+    factor_store_pivots(ipiv, n, &pivots_);
+    delete[] ipiv;
+    if (info) {
+      factors_ = Tensor();
+      pivots_ = Indices();
+      rcond_ = 0.0;
+      return false;
+    }
+    rcond_ = factor_gecon(n, tensor_pointer(factors_), anorm);
+    return true;
+  }
+
+  template<class Tensor>
+  void
+  LU<Tensor>::solve_in_place(Tensor &B) const
+  {
+    integer n = size();
+    integer nrhs = factor_check_rhs(B, n, "LU");
+    integer *ipiv = factor_load_pivots(pivots_), info;
+    factor_getrs(n, nrhs, factor_pointer(factors_), ipiv, tensor_pointer(B),
+                 &info);
+    delete[] ipiv;
+  }
+
+  template<class Tensor>
+  const Tensor
+  LU<Tensor>::solve(const Tensor &B) const
+  {
+    Tensor X(B);
+    solve_in_place(X);
+    return X;
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // CHOLESKY
+  //
+
+  template<class Tensor>
+  Cholesky<Tensor>::Cholesky() : factors_(), rcond_(0.0)
+  {}
+
+  template<class Tensor>
+  Cholesky<Tensor>::Cholesky(const Tensor &A) : factors_(), rcond_(0.0)
+  {
+    if (!factor(A)) {
+      std::cerr << "In Cholesky(A), the matrix is not positive definite."
+                << std::endl;
+      abort();
+    }
+  }
+
+  template<class Tensor>
+  bool
+  Cholesky<Tensor>::factor(const Tensor &A)
+  {
+    integer n = factor_check_square(A, "Cholesky");
+    double anorm = factor_norm1(A, true);
+    factors_ = A;
+    integer info;
+    factor_potrf(n, tensor_pointer(factors_), &info);
+    if (info) {
+      factors_ = Tensor();
+      rcond_ = 0.0;
+      return false;
+    }
+    rcond_ = factor_pocon(n, tensor_pointer(factors_), anorm);
+    return true;
+  }
+
+  template<class Tensor>
+  void
+  Cholesky<Tensor>::solve_in_place(Tensor &B) const
+  {
+    integer n = size();
+    integer nrhs = factor_check_rhs(B, n, "Cholesky");
+    integer info;
+    factor_potrs(n, nrhs, factor_pointer(factors_), tensor_pointer(B), &info);
+  }
+
+  template<class Tensor>
+  const Tensor
+  Cholesky<Tensor>::solve(const Tensor &B) const
+  {
+    Tensor X(B);
+    solve_in_place(X);
+    return X;
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // LDLT
+  //
+
+  template<class Tensor>
+  LDLT<Tensor>::LDLT() : factors_(), pivots_(), rcond_(0.0)
+  {}
+
+  template<class Tensor>
+  LDLT<Tensor>::LDLT(const Tensor &A) : factors_(), pivots_(), rcond_(0.0)
+  {
+    if (!factor(A)) {
+      std::cerr << "In LDLT(A), the matrix is singular." << std::endl;
+      abort();
+    }
+  }
+
+  template<class Tensor>
+  bool
+  LDLT<Tensor>::factor(const Tensor &A)
+  {
+    typedef typename lapack_type<elt_t>::type lapack_t;
+    integer n = factor_check_square(A, "LDLT");
+    double anorm = factor_norm1(A, true);
+    factors_ = A;
+    lapack_t *a = tensor_pointer(factors_), foo;
+    integer *ipiv = new integer[n], info;
+    LapackWorkspaceKey key('T', 'L', 'N', n, n, 0);
+    LapackWorkspace sizes;
+    if (!lapack_cached_workspace(key, &sizes)) {
+      factor_sytrf(n, a, ipiv, &foo, -1, &info);
+      sizes.lwork = lapack_lwork(foo);
+      lapack_store_workspace(key, sizes);
+    }
+    lapack_t *work = new lapack_t[sizes.lwork];
+    factor_sytrf(n, a, ipiv, work, sizes.lwork, &info);
+    delete[] work;
+    if (info) {
+      delete[] ipiv;
+      factors_ = Tensor();
+      pivots_ = Indices();
+      rcond_ = 0.0;
+      return false;
+    }
+    rcond_ = factor_sycon(n, a, ipiv, anorm);
+    factor_store_pivots(ipiv, n, &pivots_);
+    delete[] ipiv;
+    return true;
+  }
+
+  template<class Tensor>
+  void
+  LDLT<Tensor>::solve_in_place(Tensor &B) const
+  {
+    integer n = size();
+    integer nrhs = factor_check_rhs(B, n, "LDLT");
+    integer *ipiv = factor_load_pivots(pivots_), info;
+    factor_sytrs(n, nrhs, factor_pointer(factors_), ipiv, tensor_pointer(B),
+                 &info);
+    delete[] ipiv;
+  }
+
+  template<class Tensor>
+  const Tensor
+  LDLT<Tensor>::solve(const Tensor &B) const
+  {
+    Tensor X(B);
+    solve_in_place(X);
+    return X;
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // SOLVE WITH AUTOMATIC DETECTION
+  //
+
+  /* Whether A may be Hermitian and positive definite: it must be exactly
+   * Hermitian and have a positive real diagonal. Only potrf can tell
+   * whether it is really positive definite. */
+  template<typename elt_t>
+  static bool
+  factor_hermitian_candidate(const Tensor<elt_t> &A)
+  {
+    if (A.rank() != 2 || A.rows() != A.columns())
+      return false;
+    tensor::index n = A.rows();
+    const elt_t *a = A.begin_const();
+    for (tensor::index j = 0; j < n; j++) {
+      const elt_t &d = a[j + n * j];
+      if (!(tensor::real(d) > 0) || tensor::imag(d) != 0)
+        return false;
+      for (tensor::index i = j + 1; i < n; i++)
+        if (a[i + n * j] != tensor::conj(a[j + n * i]))
+          return false;
+    }
+    return true;
+  }
+
+  template<class Tensor>
+  static const Tensor
+  do_solve(const Tensor &A, const Tensor &B, SolveAlgorithm algorithm)
+  {
+    if (algorithm == SOLVE_AUTO && !factor_hermitian_candidate(A))
+      algorithm = SOLVE_LU;
+    if (algorithm != SOLVE_LU) {
+      Cholesky<Tensor> cholesky;
+      if (cholesky.factor(A))
+        return cholesky.solve(B);
+      if (algorithm == SOLVE_CHOLESKY) {
+        std::cerr << "In solve(A, B, SOLVE_CHOLESKY), the matrix is not "
+                  << "positive definite." << std::endl;
+        abort();
+      }
+    }
+    return solve(A, B);
+  }
+
+} // namespace linalg
@@ -17,22 +17,123 @@
     51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
 */
 
-#include <list>
+#include <vector>
 #include <algorithm>
 #include <tensor/flags.h>
 #include <tensor/tensor.h>
+#include <tensor/sparse.h>
 
 namespace linalg {
 
   using namespace tensor;
   using tensor::index;
 
-  static void
-  replace_integer(index N, index v[], index old_value, index new_value)
+  /* Disjoint sets of the rows and columns of a matrix, stored as a forest
+   * of 'parent' links. Nodes 0 to N-1 are the rows and N to N+M-1 the
+   * columns. Unions attach the smaller tree to the larger one and find()
+   * halves the paths it walks, so that a sequence of operations costs
+   * almost linear time. */
+  class BlockUnionFind {
+  public:
+    BlockUnionFind(index nodes) :
+      parent_(nodes), size_(nodes, 1), used_(nodes, false)
+    {
+      for (index i = 0; i < nodes; i++)
+        parent_[i] = i;
+    }
+
+    index find(index i) {
+      while (parent_[i] != i) {
+        parent_[i] = parent_[parent_[i]];
+        i = parent_[i];
+      }
+      return i;
+    }
+
+    /* Record that the row and column of a nonzero element belong to the
+     * same block. */
+    void join(index a, index b) {
+      used_[a] = used_[b] = true;
+      a = find(a);
+      b = find(b);
+      if (a == b)
+        return;
+      if (size_[a] < size_[b])
+        std::swap(a, b);
+      parent_[b] = a;
+      size_[a] += size_[b];
+    }
+
+    bool used(index i) const { return used_[i]; }
+
+  private:
+    std::vector<index> parent_, size_;
+    std::vector<bool> used_;
+  };
+
+  /* Convert the sets into lists of rows and columns for each block. Blocks
+   * are numbered by their first column and rows and columns that contain no
+   * significant element do not belong to any block. */
+  static bool
+  find_blocks_collect(index N, index M, BlockUnionFind &sets,
+                      index *pnblocks, Indices **pblock_rows,
+                      Indices **pblock_cols)
   {
-    for (index k = 0; k < N; k++) {
-      if (v[k] == old_value) v[k] = new_value;
+    const index empty = ~(index)0;
+    std::vector<index> block_of(N + M, empty), root_block(N + M, empty);
+    index nblocks = 0;
+    for (index i = N; i < N + M; i++) {
+      if (sets.used(i)) {
+        index root = sets.find(i);
+        if (root_block[root] == empty)
+          root_block[root] = nblocks++;
+        block_of[i] = root_block[root];
+      }
+    }
+    for (index i = 0; i < N; i++) {
+      if (sets.used(i))
+        block_of[i] = root_block[sets.find(i)];
     }
+    *pnblocks = nblocks;
+    if (tensor::FLAGS.get(tensor::TENSOR_DEBUG_BLOCK_SVD)) {
+      std::cout << "*** find_blocks: nxm=" << N << "x" << M
+                << ", n_blocks=" << nblocks << std::endl;
+    }
+    if (nblocks == 1) {
+      *pblock_rows = 0;
+      *pblock_cols = 0;
+      return false;
+    }
+
+    std::vector<index> nrows(nblocks, 0), ncols(nblocks, 0);
+    for (index i = 0; i < N; i++)
+      if (block_of[i] != empty) nrows[block_of[i]]++;
+    for (index i = 0; i < M; i++)
+      if (block_of[N + i] != empty) ncols[block_of[N + i]]++;
+
+    Indices *block_rows = *pblock_rows = new Indices[nblocks];
+    Indices *block_cols = *pblock_cols = new Indices[nblocks];
+    for (index b = 0; b < nblocks; b++) {
+      block_rows[b] = Indices(nrows[b]);
+      block_cols[b] = Indices(ncols[b]);
+      nrows[b] = ncols[b] = 0;
+    }
+    for (index i = 0; i < N; i++) {
+      index b = block_of[i];
+      if (b != empty) block_rows[b].at(nrows[b]++) = i;
+    }
+    for (index i = 0; i < M; i++) {
+      index b = block_of[N + i];
+      if (b != empty) block_cols[b].at(ncols[b]++) = i;
+    }
+    return true;
+  }
+
+  template<typename elt_t>
+  static inline bool
+  find_blocks_significant(const elt_t &x, double tol)
+  {
+    return abs(real(x)) + abs(imag(x)) > tol;
   }
 
   /*Find blocks in a block-diagonal matrix.*/
@@ -55,6 +156,10 @@ namespace linalg {
     which shows the evident block-diagonal structure. The routine find_block()
     takes as input a matrix such as A and produces a two lists of vectors, each
     one denoting the rows and columns of the nonzero blocks in the matrix.
+
+    Rows and columns are the nodes of a graph in which every significant
+    element is an edge, and the blocks are its connected components, which
+    we find with a union-find structure in a single pass over the matrix.
   */
   template<class Tensor>
   bool
@@ -63,98 +168,37 @@ namespace linalg {
   {
     index N = A.rows();
     index M = A.columns();
-    if (N > M)
-      return find_blocks(transpose(A), pnblocks, pblock_cols, pblock_rows);
-
-    index &nblocks = *pnblocks;
-    Indices *&block_rows = *pblock_rows;
-    Indices *&block_cols = *pblock_cols;
-
-    index *row_block = new index[N];
-    index *col_block = new index[M];
-    const index aux = 0;
-    const index empty = ~aux;
-
-    for (index row = 0; row < N; row++)
-      row_block[row] = empty;
-
-    nblocks = 0;
+    BlockUnionFind sets(N + M);
     const typename Tensor::elt_t *data = A.begin_const();
-
     for (index col = 0; col < M; col++) {
-      // For each col, we see what rowumns it is linked to. If some of these
-      // rowumns belongs to a block, and the current block is not set, we
-      // set our current block. Otherwise, we mix different blocks.
-      index curr_block = col;
-      bool set = 0;
       for (index row = 0; row < N; row++, data++) {
-	bool significant = abs(real(*data)) + abs(imag(*data)) > tol;
-	if (significant) {
-	  set = 1;
-	  index new_block = row_block[row];
-	  if (new_block == empty) {
-	    row_block[row] = curr_block;
-	  } else if (new_block != curr_block) {
-	    nblocks--;
-	    replace_integer(N, row_block, curr_block, new_block);
-	    replace_integer(col, col_block, curr_block, new_block);
-	    curr_block = new_block;
-	  }
-	}
-      }
-      if (set) {
-	nblocks++;
-	col_block[col] = curr_block;
-      } else {
-	col_block[col] = empty;
+        if (find_blocks_significant(*data, tol))
+          sets.join(row, N + col);
       }
     }
-    if (tensor::FLAGS.get(tensor::TENSOR_DEBUG_BLOCK_SVD)) {
-      std::cout << "*** find_blocks: nxm=" << N << "x" << M
-                << ", n_blocks=" << nblocks << std::endl;
-    }
-    if (nblocks == 1) {
-      block_rows = 0;
-      block_cols = 0;
-      delete[] row_block;
-      delete[] col_block;
-      return false;
-    }
+    return find_blocks_collect(N, M, sets, pnblocks, pblock_rows, pblock_cols);
+  }
 
-    index *buffer = new index[std::max<index>(N,M)];
-    block_cols = new Indices[nblocks];
-    block_rows = new Indices[nblocks];
-
-    for (index b = 0, col = 0; col < M; col++) {
-      index block = col_block[col];
-      if (block != empty) {
-	index block_ncols = 0;
-	for (index c = 0; c < M; c++) {
-	  if (col_block[c] == block) {
-	    buffer[block_ncols++] = c;
-	    col_block[c] = empty;
-	  }
-	}
-	assert(block_ncols);
-	block_cols[b] = Indices(block_ncols);
-	memcpy(block_cols[b].begin(), buffer, sizeof(index)*block_ncols);
-
-	index block_nrows = 0;
-	for (index r = 0; r < N; r++){
-	  if (row_block[r] == block) {
-	    buffer[block_nrows++] = r;
-	  }
-	}
-	assert(block_nrows);
-	block_rows[b] = Indices(block_nrows);
-	memcpy(block_rows[b].begin(), buffer, sizeof(index)*block_nrows);
-	b++;
+  /*Find blocks in a block-diagonal sparse matrix. Only the stored elements
+    are inspected.*/
+  template<typename elt_t>
+  bool
+  find_blocks(const Sparse<elt_t> &A, index *pnblocks, Indices **pblock_rows,
+              Indices **pblock_cols, double tol = 0.0)
+  {
+    index N = A.rows();
+    index M = A.columns();
+    BlockUnionFind sets(N + M);
+    const index *row_start = A.priv_row_start().begin();
+    const index *column = A.priv_column().begin();
+    const elt_t *data = A.priv_data().begin();
+    for (index row = 0; row < N; row++) {
+      for (index j = row_start[row]; j < row_start[row + 1]; j++) {
+        if (find_blocks_significant(data[j], tol))
+          sets.join(row, N + column[j]);
       }
     }
-    delete[] buffer;
-    delete[] row_block;
-    delete[] col_block;
-    return true;
+    return find_blocks_collect(N, M, sets, pnblocks, pblock_rows, pblock_cols);
   }
 
 } // namespace linalg
@@ -0,0 +1,388 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <cmath>
+#include <algorithm>
+#include <tensor/tensor.h>
+#include <tensor/linalg.h>
+
+namespace linalg {
+
+  using namespace tensor;
+
+  /* Default size of the Krylov basis in GMRES(m). */
+  static const tensor::index KRYLOV_GMRES_RESTART = 30;
+
+  template<typename elt_t>
+  static inline elt_t
+  krylov_dot(tensor::index n, const elt_t *x, const elt_t *y)
+  {
+    elt_t output = number_zero<elt_t>();
+    for (tensor::index i = 0; i < n; i++)
+      output += ::tensor::conj(x[i]) * y[i];
+    return output;
+  }
+
+  template<typename elt_t>
+  static inline double
+  krylov_norm(tensor::index n, const elt_t *x)
+  {
+    double output = 0;
+    for (tensor::index i = 0; i < n; i++)
+      output += abs2(x[i]);
+    return sqrt(output);
+  }
+
+  /* y += a * x */
+  template<typename elt_t>
+  static inline void
+  krylov_axpy(tensor::index n, elt_t a, const elt_t *x, elt_t *y)
+  {
+    for (tensor::index i = 0; i < n; i++)
+      y[i] += a * x[i];
+  }
+
+  /* z = M^{-1} r, or a copy of 'r' when there is no preconditioner. */
+  template<class Tensor>
+  static inline void
+  krylov_precondition(const Map<Tensor> *M, const Tensor &r, Tensor &z)
+  {
+    if (M) {
+      M->apply_into(r, z);
+    } else {
+      std::copy(r.begin_const(), r.end_const(), z.begin());
+    }
+  }
+
+  /* Common initialization of the solvers: the starting point 'x' and its
+   * residual 'r = b - A x', which are allocated here once. Returns the norm
+   * of 'b'. */
+  template<class Tensor>
+  static double
+  krylov_start(const Map<Tensor> *A, const Tensor &b, const Tensor *x_start,
+               Tensor &x, Tensor &r)
+  {
+    tensor::index n = b.size();
+    r = Tensor(b.dimensions());
+    if (x_start) {
+      if (x_start->size() != n) {
+        std::cerr << "In an iterative solver, the starting point has "
+                  << x_start->size() << " elements, but the right-hand side "
+                  << "has " << n << std::endl;
+        abort();
+      }
+      x = *x_start;
+      A->apply_into(x, r);
+      const typename Tensor::elt_t *pb = b.begin_const();
+      typename Tensor::elt_t *pr = r.begin();
+      for (tensor::index i = 0; i < n; i++)
+        pr[i] = pb[i] - pr[i];
+    } else {
+      x = Tensor::zeros(b.dimensions());
+      std::copy(b.begin_const(), b.end_const(), r.begin());
+    }
+    /* Make sure that 'x' does not share storage with 'x_start' */
+    x.begin();
+    return krylov_norm(n, b.begin_const());
+  }
+
+  /* Record the relative residual of an iteration. */
+  static inline void
+  krylov_record(RTensor &history, tensor::index &count, double residual)
+  {
+    if (count < history.size())
+      history.at(count++) = residual;
+  }
+
+  static inline void
+  krylov_history(RTensor *output, const RTensor &history, tensor::index count)
+  {
+    if (output) {
+      *output = RTensor(igen << count);
+      std::copy(history.begin_const(), history.begin_const() + count,
+                output->begin());
+    }
+  }
+
+  /* Preconditioned conjugate gradient for Hermitian positive definite
+   * systems. All vectors are allocated once and updated in place. */
+  template<class Tensor>
+  const Tensor
+  krylov_pcg(const Map<Tensor> *A, const Tensor &b, const Map<Tensor> *M,
+             const Tensor *x_start, int maxiter, double tol, RTensor *history)
+  {
+    typedef typename Tensor::elt_t elt_t;
+    tensor::index n = b.size();
+    if (maxiter <= 0)
+      maxiter = std::max<int>(2 * n, 20);
+    if (tol <= 0)
+      tol = 1e-10;
+    Tensor x, r;
+    double bnorm = krylov_start(A, b, x_start, x, r);
+    RTensor residuals(igen << (maxiter + 1));
+    tensor::index count = 0;
+    if (bnorm == 0) {
+      x.fill_with_zeros();
+      krylov_record(residuals, count, 0.0);
+    } else {
+      Tensor z(b.dimensions()), p(b.dimensions()), Ap(b.dimensions());
+      elt_t *px = x.begin(), *pr = r.begin(), *pp = p.begin();
+      double rnorm = krylov_norm(n, pr) / bnorm;
+      krylov_record(residuals, count, rnorm);
+      krylov_precondition(M, r, z);
+      const elt_t *pz = z.begin_const();
+      std::copy(pz, pz + n, pp);
+      elt_t rz = krylov_dot(n, pr, pz);
+      for (int iter = 0; iter < maxiter && rnorm > tol; iter++) {
+        A->apply_into(p, Ap);
+        const elt_t *pAp = Ap.begin_const();
+        elt_t pAp_norm = krylov_dot(n, pp, pAp);
+        if (abs(pAp_norm) == 0 || abs(rz) == 0) {
+          /* Breakdown: A or M is not positive definite or the
+           * search direction vanished. */
+          break;
+        }
+        elt_t alpha = rz / pAp_norm;
+        krylov_axpy(n, alpha, pp, px);
+        krylov_axpy(n, -alpha, pAp, pr);
+        rnorm = krylov_norm(n, pr) / bnorm;
+        krylov_record(residuals, count, rnorm);
+        if (rnorm <= tol)
+          break;
+        krylov_precondition(M, r, z);
+        pz = z.begin_const();
+        elt_t rz_new = krylov_dot(n, pr, pz);
+        elt_t beta = rz_new / rz;
+        for (tensor::index i = 0; i < n; i++)
+          pp[i] = pz[i] + beta * pp[i];
+        rz = rz_new;
+      }
+    }
+    delete A;
+    krylov_history(history, residuals, count);
+    return x;
+  }
+
+  /* Right-preconditioned BiCGSTAB (H. A. van der Vorst, SIAM J. Sci. Stat.
+   * Comput. 13, 631 (1992)) for general systems. When the shadow residual
+   * becomes orthogonal to the residual we restart it with the current
+   * residual, instead of giving up. */
+  template<class Tensor>
+  const Tensor
+  krylov_bicgstab(const Map<Tensor> *A, const Tensor &b, const Map<Tensor> *M,
+                  const Tensor *x_start, int maxiter, double tol,
+                  RTensor *history)
+  {
+    typedef typename Tensor::elt_t elt_t;
+    const elt_t zero = number_zero<elt_t>(), one = number_one<elt_t>();
+    tensor::index n = b.size();
+    if (maxiter <= 0)
+      maxiter = std::max<int>(2 * n, 20);
+    if (tol <= 0)
+      tol = 1e-10;
+    Tensor x, r;
+    double bnorm = krylov_start(A, b, x_start, x, r);
+    RTensor residuals(igen << (maxiter + 1));
+    tensor::index count = 0;
+    if (bnorm == 0) {
+      x.fill_with_zeros();
+      krylov_record(residuals, count, 0.0);
+    } else {
+      Tensor rhat(b.dimensions()), p(b.dimensions()), v(b.dimensions()),
+        phat(b.dimensions()), shat(b.dimensions()), t(b.dimensions());
+      elt_t *px = x.begin(), *pr = r.begin(), *prhat = rhat.begin(),
+        *pp = p.begin(), *pv = v.begin();
+      std::copy(pr, pr + n, prhat);
+      std::fill(pp, pp + n, zero);
+      std::fill(pv, pv + n, zero);
+      elt_t rho = one, alpha = one, omega = one;
+      double rnorm = krylov_norm(n, pr) / bnorm;
+      krylov_record(residuals, count, rnorm);
+      for (int iter = 0; iter < maxiter && rnorm > tol; iter++) {
+        elt_t rho_new = krylov_dot(n, prhat, pr);
+        if (abs(rho_new) <= 1e-30 * krylov_norm(n, prhat) * krylov_norm(n, pr)) {
+          /* Restart with a new shadow residual */
+          std::copy(pr, pr + n, prhat);
+          std::fill(pp, pp + n, zero);
+          std::fill(pv, pv + n, zero);
+          rho = alpha = omega = one;
+          rho_new = krylov_dot(n, prhat, pr);
+        }
+        elt_t beta = (rho_new / rho) * (alpha / omega);
+        for (tensor::index i = 0; i < n; i++)
+          pp[i] = pr[i] + beta * (pp[i] - omega * pv[i]);
+        krylov_precondition(M, p, phat);
+        A->apply_into(phat, v);
+        pv = v.begin();
+        elt_t rhat_v = krylov_dot(n, prhat, pv);
+        if (abs(rhat_v) == 0)
+          break;
+        alpha = rho_new / rhat_v;
+        /* s = r - alpha v is stored in 'r' */
+        krylov_axpy(n, -alpha, pv, pr);
+        krylov_axpy(n, alpha, phat.begin_const(), px);
+        rnorm = krylov_norm(n, pr) / bnorm;
+        if (rnorm <= tol) {
+          krylov_record(residuals, count, rnorm);
+          break;
+        }
+        krylov_precondition(M, r, shat);
+        A->apply_into(shat, t);
+        const elt_t *pt = t.begin_const();
+        double tt = krylov_norm(n, pt);
+        if (tt == 0) {
+          krylov_record(residuals, count, rnorm);
+          break;
+        }
+        omega = krylov_dot(n, pt, (const elt_t *)pr) / (tt * tt);
+        krylov_axpy(n, omega, shat.begin_const(), px);
+        krylov_axpy(n, -omega, pt, pr);
+        rnorm = krylov_norm(n, pr) / bnorm;
+        krylov_record(residuals, count, rnorm);
+        rho = rho_new;
+        if (abs(omega) == 0)
+          break;
+      }
+    }
+    delete A;
+    krylov_history(history, residuals, count);
+    return x;
+  }
+
+  /* Right-preconditioned, restarted GMRES(m) (Y. Saad and M. H. Schultz,
+   * SIAM J. Sci. Stat. Comput. 7, 856 (1986)). The Hessenberg matrix is
+   * reduced with Givens rotations as it grows, which gives the residual
+   * of every iteration without forming the solution. The basis is
+   * orthogonalized with modified Gram-Schmidt. */
+  template<class Tensor>
+  const Tensor
+  krylov_gmres(const Map<Tensor> *A, const Tensor &b, const Map<Tensor> *M,
+               const Tensor *x_start, int maxiter, double tol,
+               RTensor *history, int restart)
+  {
+    typedef typename Tensor::elt_t elt_t;
+    const elt_t zero = number_zero<elt_t>();
+    tensor::index n = b.size();
+    if (maxiter <= 0)
+      maxiter = std::max<int>(2 * n, 20);
+    if (tol <= 0)
+      tol = 1e-10;
+    tensor::index m = (restart > 0)? restart : KRYLOV_GMRES_RESTART;
+    m = std::min<tensor::index>(m, n);
+    Tensor x, r;
+    double bnorm = krylov_start(A, b, x_start, x, r);
+    RTensor residuals(igen << (maxiter + 1));
+    tensor::index count = 0;
+    if (bnorm == 0) {
+      x.fill_with_zeros();
+      krylov_record(residuals, count, 0.0);
+    } else {
+      Tensor basis(n, m + 1), H(m + 1, m), sn(m), g(m + 1), y(m);
+      RTensor cs(m);
+      Tensor v(b.dimensions()), z(b.dimensions()), w(b.dimensions());
+      elt_t *V = basis.begin(), *px = x.begin();
+      double rnorm = krylov_norm(n, r.begin_const());
+      krylov_record(residuals, count, rnorm / bnorm);
+      int iter = 0;
+      while (iter < maxiter && rnorm > tol * bnorm) {
+        const elt_t *pr = r.begin_const();
+        for (tensor::index i = 0; i < n; i++)
+          V[i] = pr[i] / rnorm;
+        std::fill(g.begin(), g.end(), zero);
+        g.at(0) = rnorm;
+        tensor::index j = 0;
+        while (j < m && iter < maxiter) {
+          /* Arnoldi step: w = A M^{-1} v_j, orthogonal to v_0...v_j */
+          std::copy(V + j * n, V + (j + 1) * n, v.begin());
+          krylov_precondition(M, v, z);
+          A->apply_into(z, w);
+          elt_t *pw = w.begin();
+          for (tensor::index i = 0; i <= j; i++) {
+            elt_t h = krylov_dot(n, V + i * n, (const elt_t *)pw);
+            krylov_axpy(n, -h, V + i * n, pw);
+            H.at(i, j) = h;
+          }
+          double hnorm = krylov_norm(n, pw);
+          /* Apply the previous rotations and compute a new one */
+          for (tensor::index i = 0; i < j; i++) {
+            elt_t a = H(i, j), c = H(i+1, j);
+            H.at(i, j) = cs[i] * a + sn[i] * c;
+            H.at(i+1, j) = -::tensor::conj(sn[i]) * a + cs[i] * c;
+          }
+          elt_t a = H(j, j);
+          double t = sqrt(abs2(a) + hnorm * hnorm);
+          if (t == 0) {
+            /* Breakdown: A M^{-1} v_j lies in the span of the previous
+             * vectors and the new column of H is singular. We solve with
+             * the first j columns, or keep x if there are none. */
+            ++iter;
+            krylov_record(residuals, count, abs(g[j]) / bnorm);
+            break;
+          }
+          if (abs(a) == 0) {
+            cs.at(j) = 0;
+            sn.at(j) = number_one<elt_t>();
+          } else {
+            cs.at(j) = abs(a) / t;
+            sn.at(j) = (a / abs(a)) * hnorm / t;
+          }
+          H.at(j, j) = cs[j] * a + sn[j] * hnorm;
+          g.at(j + 1) = -::tensor::conj(sn[j]) * g[j];
+          g.at(j) = cs[j] * g[j];
+          ++j;
+          ++iter;
+          krylov_record(residuals, count, abs(g[j]) / bnorm);
+          if (hnorm == 0 || abs(g[j]) <= tol * bnorm)
+            break;
+          if (j < m) {
+            elt_t *vj = V + j * n;
+            for (tensor::index i = 0; i < n; i++)
+              vj[i] = pw[i] / hnorm;
+          }
+        }
+        /* Solve the triangular system and update x += M^{-1} V y */
+        for (tensor::index i = j; i-- > 0; ) {
+          elt_t s = g[i];
+          for (tensor::index k = i + 1; k < j; k++)
+            s -= H(i, k) * y[k];
+          y.at(i) = s / H(i, i);
+        }
+        elt_t *pv = v.begin();
+        std::fill(pv, pv + n, zero);
+        for (tensor::index i = 0; i < j; i++)
+          krylov_axpy(n, y[i], V + i * n, pv);
+        krylov_precondition(M, v, z);
+        krylov_axpy(n, number_one<elt_t>(), z.begin_const(), px);
+        /* True residual for the next cycle */
+        A->apply_into(x, r);
+        elt_t *pr2 = r.begin();
+        const elt_t *pb = b.begin_const();
+        for (tensor::index i = 0; i < n; i++)
+          pr2[i] = pb[i] - pr2[i];
+        rnorm = krylov_norm(n, pr2);
+        if (j == 0)
+          break;
+      }
+    }
+    delete A;
+    krylov_history(history, residuals, count);
+    return x;
+  }
+
+} // namespace linalg
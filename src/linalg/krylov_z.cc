@@ -0,0 +1,117 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include "krylov.hpp"
+
+namespace linalg {
+
+  //////////////////////////////////////////////////////////////////////
+  // PRECONDITIONED CONJUGATE GRADIENT
+  //
+
+  const CTensor
+  do_pcg(const Map<CTensor> *A, const CTensor &b, const Map<CTensor> *preconditioner,
+         const CTensor *x_start, int maxiter, double tol, RTensor *history)
+  {
+    return krylov_pcg(A, b, preconditioner, x_start, maxiter, tol, history);
+  }
+
+  /**Solve a Hermitian positive definite system of equations with the
+     preconditioned conjugate gradient method.*/
+  const CTensor
+  pcg(const CTensor &A, const CTensor &b, const Map<CTensor> *preconditioner,
+      const CTensor *x_start, int maxiter, double tol, RTensor *history)
+  {
+    return do_pcg(new tensor::MatrixMap<CTensor>(A), b, preconditioner, x_start,
+                  maxiter, tol, history);
+  }
+
+  /**Solve a sparse Hermitian positive definite system of equations with the
+     preconditioned conjugate gradient method.*/
+  const CTensor
+  pcg(const CSparse &A, const CTensor &b, const Map<CTensor> *preconditioner,
+      const CTensor *x_start, int maxiter, double tol, RTensor *history)
+  {
+    return do_pcg(new tensor::MatrixMap<CSparse>(A), b, preconditioner, x_start,
+                  maxiter, tol, history);
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // BICGSTAB
+  //
+
+  const CTensor
+  do_bicgstab(const Map<CTensor> *A, const CTensor &b, const Map<CTensor> *preconditioner,
+              const CTensor *x_start, int maxiter, double tol, RTensor *history)
+  {
+    return krylov_bicgstab(A, b, preconditioner, x_start, maxiter, tol, history);
+  }
+
+  /**Solve a system of equations with the BiCGSTAB method.*/
+  const CTensor
+  bicgstab(const CTensor &A, const CTensor &b, const Map<CTensor> *preconditioner,
+           const CTensor *x_start, int maxiter, double tol, RTensor *history)
+  {
+    return do_bicgstab(new tensor::MatrixMap<CTensor>(A), b, preconditioner,
+                       x_start, maxiter, tol, history);
+  }
+
+  /**Solve a sparse system of equations with the BiCGSTAB method.*/
+  const CTensor
+  bicgstab(const CSparse &A, const CTensor &b, const Map<CTensor> *preconditioner,
+           const CTensor *x_start, int maxiter, double tol, RTensor *history)
+  {
+    return do_bicgstab(new tensor::MatrixMap<CSparse>(A), b, preconditioner,
+                       x_start, maxiter, tol, history);
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // GMRES(m)
+  //
+
+  const CTensor
+  do_gmres(const Map<CTensor> *A, const CTensor &b, const Map<CTensor> *preconditioner,
+           const CTensor *x_start, int maxiter, double tol, RTensor *history,
+           int restart)
+  {
+    return krylov_gmres(A, b, preconditioner, x_start, maxiter, tol, history,
+                        restart);
+  }
+
+  /**Solve a system of equations with the restarted GMRES(m) method.*/
+  const CTensor
+  gmres(const CTensor &A, const CTensor &b, const Map<CTensor> *preconditioner,
+        const CTensor *x_start, int maxiter, double tol, RTensor *history,
+        int restart)
+  {
+    return do_gmres(new tensor::MatrixMap<CTensor>(A), b, preconditioner, x_start,
+                    maxiter, tol, history, restart);
+  }
+
+  /**Solve a sparse system of equations with the restarted GMRES(m) method.*/
+  const CTensor
+  gmres(const CSparse &A, const CTensor &b, const Map<CTensor> *preconditioner,
+        const CTensor *x_start, int maxiter, double tol, RTensor *history,
+        int restart)
+  {
+    return do_gmres(new tensor::MatrixMap<CSparse>(A), b, preconditioner, x_start,
+                    maxiter, tol, history, restart);
+  }
+
+} // namespace linalg
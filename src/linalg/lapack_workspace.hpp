@@ -0,0 +1,169 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#ifndef TENSOR_LINALG_LAPACK_WORKSPACE_HPP
+#define TENSOR_LINALG_LAPACK_WORKSPACE_HPP
+
+#include <map>
+#include <vector>
+#include <algorithm>
+#include <tensor/tensor.h>
+#include <tensor/tensor_lapack.h>
+
+namespace linalg {
+
+  using namespace lapack;
+
+  /* Element type of the LAPACK interface, which need not be the same as the
+   * complex type of the tensors. */
+  template<typename elt_t> struct lapack_type {
+    typedef double type;
+    enum { is_complex = 0 };
+  };
+  template<> struct lapack_type<tensor::cdouble> {
+    typedef cdouble type;
+    enum { is_complex = 1 };
+  };
+
+  /* Size of the real work array RWORK, which only the complex drivers use,
+   * so that the real ones do not allocate it. */
+  template<typename elt_t>
+  static inline integer
+  lapack_rwork_size(integer size)
+  {
+    return lapack_type<elt_t>::is_complex? size : 0;
+  }
+
+  static inline integer lapack_lwork(double w) { return (integer)w; }
+  static inline integer lapack_lwork(cdouble w) { return (integer)lapack::real(w); }
+
+  /* Sizes of the work arrays of a LAPACK driver, as returned by a query
+   * with LWORK = -1. Arrays that the driver does not use are left at 0. */
+  struct LapackWorkspace {
+    integer lwork, lrwork, liwork;
+
+    LapackWorkspace() : lwork(0), lrwork(0), liwork(0) {}
+  };
+
+  /* Driver, jobs and shape, which determine the optimal workspace. */
+  struct LapackWorkspaceKey {
+    char driver, job1, job2;
+    integer m, n, r;
+
+    LapackWorkspaceKey(char d, char j1, char j2, integer am, integer an,
+                       integer ar) :
+      driver(d), job1(j1), job2(j2), m(am), n(an), r(ar)
+    {}
+
+    bool operator<(const LapackWorkspaceKey &o) const {
+      if (driver != o.driver) return driver < o.driver;
+      if (job1 != o.job1) return job1 < o.job1;
+      if (job2 != o.job2) return job2 < o.job2;
+      if (m != o.m) return m < o.m;
+      if (n != o.n) return n < o.n;
+      return r < o.r;
+    }
+  };
+
+  typedef std::map<LapackWorkspaceKey,LapackWorkspace> LapackWorkspaceCache;
+
+  /* Workspace sizes that have already been queried. The decompositions in
+   * MPS sweeps and in iterative solvers act on matrices of a few recurring
+   * shapes, and this avoids a second call to the driver for each of them. */
+  static LapackWorkspaceCache lapack_workspace_cache;
+
+  static bool
+  lapack_cached_workspace(const LapackWorkspaceKey &key,
+                          LapackWorkspace *sizes)
+  {
+    bool found = false;
+#pragma omp critical (linalg_lapack_workspace)
+    {
+      LapackWorkspaceCache::const_iterator it =
+        lapack_workspace_cache.find(key);
+      if (it != lapack_workspace_cache.end()) {
+        *sizes = it->second;
+        found = true;
+      }
+    }
+    return found;
+  }
+
+  static void
+  lapack_store_workspace(const LapackWorkspaceKey &key,
+                         const LapackWorkspace &sizes)
+  {
+#pragma omp critical (linalg_lapack_workspace)
+    lapack_workspace_cache[key] = sizes;
+  }
+
+  /* Work arrays owned by one thread and reused by consecutive calls to the
+   * drivers, as in the batched decompositions. Each array grows to the
+   * largest size requested so far. Drivers that are not given buffers
+   * allocate and free their work arrays in every call. */
+  struct LapackBuffers {
+    std::vector<tensor::cdouble> work;
+    std::vector<double> rwork;
+    std::vector<integer> iwork;
+  };
+
+  template<typename T>
+  static inline T *
+  lapack_work(LapackBuffers *buffers, integer size)
+  {
+    if (!buffers)
+      return new T[size];
+    size_t n = (std::max<integer>(size, 1) * sizeof(T) +
+                sizeof(tensor::cdouble) - 1) / sizeof(tensor::cdouble);
+    if (buffers->work.size() < n)
+      buffers->work.resize(n);
+    return reinterpret_cast<T *>(&buffers->work[0]);
+  }
+
+  static inline double *
+  lapack_rwork(LapackBuffers *buffers, integer size)
+  {
+    if (!buffers)
+      return new double[size];
+    if (buffers->rwork.size() < (size_t)std::max<integer>(size, 1))
+      buffers->rwork.resize(std::max<integer>(size, 1));
+    return &buffers->rwork[0];
+  }
+
+  static inline integer *
+  lapack_iwork(LapackBuffers *buffers, integer size)
+  {
+    if (!buffers)
+      return new integer[size];
+    if (buffers->iwork.size() < (size_t)std::max<integer>(size, 1))
+      buffers->iwork.resize(std::max<integer>(size, 1));
+    return &buffers->iwork[0];
+  }
+
+  template<typename T>
+  static inline void
+  lapack_release(LapackBuffers *buffers, T *array)
+  {
+    if (!buffers)
+      delete[] array;
+  }
+
+} // namespace linalg
+
+#endif // TENSOR_LINALG_LAPACK_WORKSPACE_HPP
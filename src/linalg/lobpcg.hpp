@@ -0,0 +1,287 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <cfloat>
+#include <cmath>
+#include <algorithm>
+#include <tensor/tensor.h>
+#include <tensor/linalg.h>
+
+namespace linalg {
+
+  using namespace tensor;
+
+  /* Apply the map to all columns of 'X' at once, which for matrices and
+   * sparse operators is a single matrix-matrix product. */
+  template<class Tensor>
+  static const Tensor
+  lobpcg_apply(const Map<Tensor> *A, const Tensor &X)
+  {
+    Tensor output;
+    A->apply_into(X, output);
+    return output;
+  }
+
+  /* Copy 'nr' rows of the matrix 'C', starting at 'r0'. */
+  template<class Tensor>
+  static const Tensor
+  lobpcg_rows(const Tensor &C, tensor::index r0, tensor::index nr)
+  {
+    tensor::index nc = C.columns();
+    Tensor output(nr, nc);
+    for (tensor::index c = 0; c < nc; c++)
+      for (tensor::index r = 0; r < nr; r++)
+        output.at(r, c) = C(r0 + r, c);
+    return output;
+  }
+
+  /* Copy the columns of 'R' listed in 'which'. */
+  template<class Tensor>
+  static const Tensor
+  lobpcg_columns(const Tensor &R, const Indices &which)
+  {
+    tensor::index n = R.rows(), k = which.size();
+    Tensor output(n, k);
+    for (tensor::index c = 0; c < k; c++)
+      std::copy(R.begin_const() + which[c] * n,
+                R.begin_const() + (which[c] + 1) * n,
+                output.begin() + c * n);
+    return output;
+  }
+
+  /* Remove from 'W' (and its image 'AW', if not NULL) the components along
+   * the orthonormal basis 'X' (whose image is 'AX'). */
+  template<class Tensor>
+  static void
+  lobpcg_project(Tensor &W, Tensor *AW, const Tensor &X, const Tensor &AX)
+  {
+    if (X.size() == 0)
+      return;
+    Tensor a = mmult(adjoint(X), W);
+    W -= mmult(X, a);
+    if (AW) *AW -= mmult(AX, a);
+  }
+
+  /* Make the columns of 'W' orthonormal and orthogonal to the bases 'X' and
+   * 'P', applying the same transformations to 'AW' when it is not NULL.
+   * Directions that are linearly dependent are dropped, and we return the
+   * number of columns that remain. */
+  template<class Tensor>
+  static tensor::index
+  lobpcg_orthonormalize(Tensor &W, Tensor *AW, const Tensor &X, const Tensor &AX,
+                        const Tensor &P, const Tensor &AP)
+  {
+    tensor::index n = W.rows(), k = W.columns();
+    /* Normalize the columns so that the drop tolerance is relative */
+    RTensor scale(k);
+    for (tensor::index c = 0; c < k; c++) {
+      double norm = 0;
+      for (tensor::index r = 0; r < n; r++) norm += abs2(W(r, c));
+      scale.at(c) = (norm > 0)? 1.0/sqrt(norm) : 0.0;
+    }
+    Tensor M = diag(Tensor(scale));
+    for (int pass = 0; pass < 2; pass++) {
+      W = mmult(W, M);
+      if (AW) *AW = mmult(*AW, M);
+      lobpcg_project(W, AW, X, AX);
+      lobpcg_project(W, AW, P, AP);
+      Tensor U;
+      RTensor lambda = eig_sym(mmult(adjoint(W), W), &U);
+      double lmax = lambda.size()? max(lambda) : 0.0;
+      Indices keep(lambda.size());
+      tensor::index nkeep = 0;
+      for (tensor::index i = 0; i < (tensor::index)lambda.size(); i++)
+        if (lambda[i] > 1e-10 * lmax)
+          keep.at(nkeep++) = i;
+      M = Tensor::zeros(W.columns(), nkeep);
+      for (tensor::index c = 0; c < nkeep; c++) {
+        double s = 1.0 / sqrt(lambda[keep[c]]);
+        for (tensor::index r = 0; r < (tensor::index)W.columns(); r++)
+          M.at(r, c) = U(r, keep[c]) * s;
+      }
+      if (nkeep == 0) {
+        W = Tensor();
+        if (AW) *AW = Tensor();
+        return 0;
+      }
+    }
+    W = mmult(W, M);
+    if (AW) *AW = mmult(*AW, M);
+    return W.columns();
+  }
+
+  /* Locally optimal block preconditioned conjugate gradient method (A. V.
+   * Knyazev, SIAM J. Sci. Comput. 23, 517 (2001)). The operator and the
+   * preconditioner are applied to blocks of vectors. We use an orthonormal
+   * basis [X, W, P] for the Rayleigh-Ritz step, where W contains the
+   * preconditioned residuals of the eigenpairs that have not yet converged
+   * ("soft locking") and P the previous search directions, whose images are
+   * updated implicitly so that every iteration needs only one application
+   * of the operator to the block W. */
+  template<class Tensor>
+  RTensor
+  lobpcg_loop(const Map<Tensor> *A, size_t dims, int eig_type, size_t nev,
+              Tensor *vectors, bool *converged, const Map<Tensor> *preconditioner,
+              double tol, size_t maxiter)
+  {
+    tensor::index n = dims, k = nev;
+    if (k > n || k == 0) {
+      std::cerr << "In lobpcg(): Can only compute up to " << n
+                << " eigenvalues\nin a matrix that has " << n << " times "
+                << n << " elements.";
+      abort();
+    }
+    if (eig_type != SmallestAlgebraic && eig_type != LargestAlgebraic) {
+      std::cerr << "In lobpcg(), only SmallestAlgebraic and LargestAlgebraic "
+                << "eigenvalues can be computed.\n";
+      abort();
+    }
+    bool largest = (eig_type == LargestAlgebraic);
+    if (tol <= 0)
+      tol = 1e-10;
+    if (maxiter == 0)
+      maxiter = std::max<size_t>(500, n);
+
+    /* Starting block, completed with random vectors. */
+    Tensor X = Tensor::random(n, k) - 0.5;
+    if (vectors && vectors->rank() == 2 && vectors->rows() == n) {
+      tensor::index c = std::min<tensor::index>(vectors->columns(), k);
+      std::copy(vectors->begin_const(), vectors->begin_const() + c * n, X.begin());
+    } else if (vectors && vectors->rank() == 1 && vectors->size() == n) {
+      std::copy(vectors->begin_const(), vectors->end_const(), X.begin());
+    }
+    Tensor empty;
+    if (lobpcg_orthonormalize(X, (Tensor *)0, empty, empty, empty, empty) < k) {
+      X = Tensor::random(n, k) - 0.5;
+      lobpcg_orthonormalize(X, (Tensor *)0, empty, empty, empty, empty);
+    }
+    Tensor AX = lobpcg_apply(A, X);
+    Tensor P, AP, W, AW;
+    RTensor theta(k);
+    bool done = false;
+
+    for (size_t iter = 0; iter <= maxiter; iter++) {
+      /* Rayleigh-Ritz on the orthonormal basis [X, W, P] */
+      tensor::index nw = W.size()? W.columns() : 0;
+      tensor::index np = P.size()? P.columns() : 0;
+      tensor::index q = k + nw + np;
+      Tensor H(q, q);
+      const Tensor *S[3] = { &X, &W, &P };
+      const Tensor *AS[3] = { &AX, &AW, &AP };
+      tensor::index offset[4] = { 0, k, k + nw, q };
+      for (int i = 0; i < 3; i++) {
+        if (offset[i+1] == offset[i]) continue;
+        for (int j = i; j < 3; j++) {
+          if (offset[j+1] == offset[j]) continue;
+          Tensor Hij = mmult(adjoint(*S[i]), *AS[j]);
+          for (tensor::index c = 0; c < offset[j+1] - offset[j]; c++)
+            for (tensor::index r = 0; r < offset[i+1] - offset[i]; r++) {
+              H.at(offset[i] + r, offset[j] + c) = Hij(r, c);
+              H.at(offset[j] + c, offset[i] + r) = ::tensor::conj(Hij(r, c));
+            }
+        }
+      }
+      for (tensor::index i = 0; i < q; i++)
+        H.at(i, i) = real(H(i, i));
+      Tensor U;
+      RTensor values = eig_sym(H, &U);
+      Indices wanted(k);
+      for (tensor::index i = 0; i < k; i++) {
+        wanted.at(i) = largest? (q - 1 - i) : i;
+        theta.at(i) = values[wanted[i]];
+      }
+      Tensor C = lobpcg_columns(U, wanted);
+      if (q > k) {
+        Tensor Cx = lobpcg_rows(C, 0, k);
+        Tensor newP, newAP;
+        if (nw) {
+          Tensor Cw = lobpcg_rows(C, k, nw);
+          newP = mmult(W, Cw);
+          newAP = mmult(AW, Cw);
+        }
+        if (np) {
+          Tensor Cp = lobpcg_rows(C, k + nw, np);
+          if (nw) {
+            newP += mmult(P, Cp);
+            newAP += mmult(AP, Cp);
+          } else {
+            newP = mmult(P, Cp);
+            newAP = mmult(AP, Cp);
+          }
+        }
+        X = mmult(X, Cx) + newP;
+        AX = mmult(AX, Cx) + newAP;
+        P = newP;
+        AP = newAP;
+      } else {
+        X = mmult(X, C);
+        AX = mmult(AX, C);
+      }
+
+      /* Residuals and convergence */
+      Tensor R = AX - mmult(X, diag(Tensor(theta)));
+      double scale = std::max(1.0, max(abs(theta)));
+      Indices active(k);
+      tensor::index nactive = 0;
+      for (tensor::index c = 0; c < k; c++) {
+        double norm = 0;
+        for (tensor::index r = 0; r < n; r++) norm += abs2(R(r, c));
+        if (sqrt(norm) > tol * scale)
+          active.at(nactive++) = c;
+      }
+      if (nactive == 0) {
+        done = true;
+        break;
+      }
+      if (iter == maxiter)
+        break;
+
+      /* New search directions */
+      Indices which(nactive);
+      std::copy(active.begin_const(), active.begin_const() + nactive, which.begin());
+      W = lobpcg_columns(R, which);
+      if (preconditioner)
+        W = lobpcg_apply(preconditioner, W);
+      if (lobpcg_orthonormalize(W, (Tensor *)0, X, AX, empty, empty)) {
+        AW = lobpcg_apply(A, W);
+      } else {
+        W = AW = empty;
+      }
+      if (P.size() && !lobpcg_orthonormalize(P, &AP, X, AX, W, AW)) {
+        P = AP = empty;
+      }
+      if (W.size() == 0 && P.size() == 0) {
+        /* No new directions: the iteration has stagnated. */
+        break;
+      }
+    }
+    delete A;
+    if (!done) {
+      std::cerr << "lobpcg: Maximum number of iterations reached.\n";
+      if (!converged)
+        abort();
+    }
+    if (converged)
+      *converged = done;
+    if (vectors)
+      *vectors = X;
+    return theta;
+  }
+
+} // namespace linalg
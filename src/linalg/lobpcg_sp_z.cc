@@ -0,0 +1,47 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <tensor/linalg.h>
+
+namespace linalg {
+
+  /**Find out a few extremal eigenvalues and eigenvectors of a symmetric
+     (Hermitian) sparse matrix, with the LOBPCG method. */
+  RTensor
+  lobpcg(const CSparse &A, int eig_type, size_t neig, CTensor *vectors,
+         bool *converged, const Map<CTensor> *preconditioner, double tol,
+         size_t maxiter)
+  {
+    return do_lobpcg(new tensor::MatrixMap<CSparse>(A), A.columns(), eig_type, neig,
+                     vectors, converged, preconditioner, tol, maxiter);
+  }
+
+  /**Find out a few extremal eigenvalues and eigenvectors of a symmetric
+     (Hermitian) sparse matrix that only stores its upper triangle, with the
+     LOBPCG method. */
+  RTensor
+  lobpcg(const CSymSparse &A, int eig_type, size_t neig, CTensor *vectors,
+         bool *converged, const Map<CTensor> *preconditioner, double tol,
+         size_t maxiter)
+  {
+    return do_lobpcg(new tensor::MatrixMap<CSymSparse>(A), A.columns(), eig_type,
+                     neig, vectors, converged, preconditioner, tol, maxiter);
+  }
+
+} // namespace linalg
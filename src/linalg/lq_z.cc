@@ -0,0 +1,40 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include "qr.hpp"
+
+namespace linalg {
+
+  /**LQ decomposition of a complex matrix.
+
+     Finds a lower triangular matrix L and a matrix Q with orthonormal rows
+     such that \f$A = L Q\f$. If A has \c MxN elements, L is \c MxN and
+     Q is \c NxN, unless \c economic is different from zero, in which case
+     L is \c MxK and Q is \c KxN, with \c K=min(M,N). Either of L and Q
+     may be omitted by passing a null pointer.
+
+     \ingroup Linalg
+  */
+  void
+  lq(const CTensor &A, CTensor *L, CTensor *Q, bool economic)
+  {
+    lq_driver(A, L, Q, economic);
+  }
+
+} // namespace linalg
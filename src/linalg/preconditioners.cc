@@ -0,0 +1,212 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <algorithm>
+#include <tensor/linalg.h>
+
+namespace linalg {
+
+  using namespace tensor;
+
+  /* Number of right-hand sides in 'arg', which is either a vector of 'n'
+   * elements or a matrix with 'n' rows. */
+  template<class Tensor>
+  static tensor::index
+  preconditioner_columns(const Tensor &arg, tensor::index n, const char *name)
+  {
+    if (n == 0 || arg.size() % n || (arg.rank() > 0 && arg.dimension(0) != n)) {
+      std::cerr << "In " << name << ", the argument has " << arg.size()
+                << " elements, which is not compatible with a matrix of size "
+                << n << std::endl;
+      abort();
+    }
+    return arg.size() / n;
+  }
+
+  template<class Tensor>
+  static void
+  prepare_output(const Tensor &arg, Tensor &output)
+  {
+    if (!all_equal(output.dimensions(), arg.dimensions()) ||
+        output.begin_const() == arg.begin_const())
+      output = Tensor(arg.dimensions());
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // JACOBI
+  //
+
+  template<typename elt_t>
+  JacobiPreconditioner<elt_t>::JacobiPreconditioner(const Sparse<elt_t> &A) :
+    inverse_diagonal_(igen << A.rows())
+  {
+    tensor::index n = A.rows();
+    if (n != A.columns()) {
+      std::cerr << "In JacobiPreconditioner(A), the matrix is not square but has "
+                << A.rows() << " rows and " << A.columns() << " columns.\n";
+      abort();
+    }
+    const tensor::index *row_start = A.priv_row_start().begin_const();
+    const tensor::index *column = A.priv_column().begin_const();
+    const elt_t *data = A.priv_data().begin_const();
+    elt_t *d = inverse_diagonal_.begin();
+    for (tensor::index r = 0; r < n; r++) {
+      tensor::index k = sparse_find(row_start, column, r, r);
+      if (k < 0 || abs(data[k]) == 0) {
+        std::cerr << "In JacobiPreconditioner(A), the diagonal element "
+                  << r << " of the matrix is zero.\n";
+        abort();
+      }
+      d[r] = number_one<elt_t>() / data[k];
+    }
+  }
+
+  template<typename elt_t>
+  JacobiPreconditioner<elt_t>::~JacobiPreconditioner() {}
+
+  template<typename elt_t>
+  const typename JacobiPreconditioner<elt_t>::tensor_t
+  JacobiPreconditioner<elt_t>::operator()(const tensor_t &arg) const
+  {
+    tensor_t output;
+    apply_into(arg, output);
+    return output;
+  }
+
+  template<typename elt_t>
+  void
+  JacobiPreconditioner<elt_t>::apply_into(const tensor_t &arg, tensor_t &output) const
+  {
+    tensor::index n = inverse_diagonal_.size();
+    tensor::index columns = preconditioner_columns(arg, n, "JacobiPreconditioner");
+    prepare_output(arg, output);
+    const elt_t *d = inverse_diagonal_.begin_const();
+    const elt_t *x = arg.begin_const();
+    elt_t *y = output.begin();
+    for (tensor::index c = 0; c < columns; c++, x += n, y += n)
+      for (tensor::index i = 0; i < n; i++)
+        y[i] = d[i] * x[i];
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // ILU(0)
+  //
+
+  /* The factorization is done in place over a copy of the elements of A,
+   * row by row (the IKJ variant of Gaussian elimination), discarding any
+   * element outside the sparsity pattern. The strictly lower triangle keeps
+   * L, whose diagonal is one, and the rest keeps U. */
+  template<typename elt_t>
+  ILU0Preconditioner<elt_t>::ILU0Preconditioner(const Sparse<elt_t> &A) :
+    row_start_(A.priv_row_start()), column_(A.priv_column()),
+    diagonal_(A.rows()), data_(A.priv_data())
+  {
+    tensor::index n = A.rows();
+    if (n != A.columns()) {
+      std::cerr << "In ILU0Preconditioner(A), the matrix is not square but has "
+                << A.rows() << " rows and " << A.columns() << " columns.\n";
+      abort();
+    }
+    const tensor::index *row_start = row_start_.begin_const();
+    const tensor::index *column = column_.begin_const();
+    elt_t *data = data_.begin();
+    for (tensor::index r = 0; r < n; r++) {
+      tensor::index k = sparse_find(row_start, column, r, r);
+      if (k < 0) {
+        std::cerr << "In ILU0Preconditioner(A), the diagonal element "
+                  << r << " is missing from the matrix.\n";
+        abort();
+      }
+      diagonal_.at(r) = k;
+    }
+    const tensor::index *diagonal = diagonal_.begin_const();
+    Indices where(n);
+    std::fill(where.begin(), where.end(), -1);
+    for (tensor::index i = 0; i < n; i++) {
+      for (tensor::index p = row_start[i]; p < row_start[i+1]; p++)
+        where.at(column[p]) = p;
+      for (tensor::index p = row_start[i]; p < diagonal[i]; p++) {
+        tensor::index k = column[p];
+        elt_t l = data[p] / data[diagonal[k]];
+        data[p] = l;
+        for (tensor::index q = diagonal[k] + 1; q < row_start[k+1]; q++) {
+          tensor::index j = where[column[q]];
+          if (j >= 0)
+            data[j] -= l * data[q];
+        }
+      }
+      if (abs(data[diagonal[i]]) == 0) {
+        std::cerr << "In ILU0Preconditioner(A), zero pivot found in row "
+                  << i << ".\n";
+        abort();
+      }
+      for (tensor::index p = row_start[i]; p < row_start[i+1]; p++)
+        where.at(column[p]) = -1;
+    }
+  }
+
+  template<typename elt_t>
+  ILU0Preconditioner<elt_t>::~ILU0Preconditioner() {}
+
+  template<typename elt_t>
+  const typename ILU0Preconditioner<elt_t>::tensor_t
+  ILU0Preconditioner<elt_t>::operator()(const tensor_t &arg) const
+  {
+    tensor_t output;
+    apply_into(arg, output);
+    return output;
+  }
+
+  template<typename elt_t>
+  void
+  ILU0Preconditioner<elt_t>::apply_into(const tensor_t &arg, tensor_t &output) const
+  {
+    tensor::index n = diagonal_.size();
+    tensor::index columns = preconditioner_columns(arg, n, "ILU0Preconditioner");
+    prepare_output(arg, output);
+    const tensor::index *row_start = row_start_.begin_const();
+    const tensor::index *column = column_.begin_const();
+    const tensor::index *diagonal = diagonal_.begin_const();
+    const elt_t *data = data_.begin_const();
+    const elt_t *b = arg.begin_const();
+    elt_t *x = output.begin();
+    for (tensor::index c = 0; c < columns; c++, b += n, x += n) {
+      /* L y = b, with unit diagonal */
+      for (tensor::index i = 0; i < n; i++) {
+        elt_t s = b[i];
+        for (tensor::index p = row_start[i]; p < diagonal[i]; p++)
+          s -= data[p] * x[column[p]];
+        x[i] = s;
+      }
+      /* U x = y */
+      for (tensor::index i = n; i-- > 0; ) {
+        elt_t s = x[i];
+        for (tensor::index p = diagonal[i] + 1; p < row_start[i+1]; p++)
+          s -= data[p] * x[column[p]];
+        x[i] = s / data[diagonal[i]];
+      }
+    }
+  }
+
+  template struct JacobiPreconditioner<double>;
+  template struct JacobiPreconditioner<cdouble>;
+  template struct ILU0Preconditioner<double>;
+  template struct ILU0Preconditioner<cdouble>;
+
+} // namespace linalg
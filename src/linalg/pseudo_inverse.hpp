@@ -0,0 +1,124 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#ifndef TENSOR_LINALG_PSEUDO_INVERSE_HPP
+#define TENSOR_LINALG_PSEUDO_INVERSE_HPP
+
+#include <cfloat>
+#include <algorithm>
+#include <tensor/tensor.h>
+#include <tensor/linalg.h>
+#include "../tensor/gemm.cc"
+
+namespace linalg {
+
+  using tensor::Tensor;
+  using tensor::Indices;
+  using blas::integer;
+
+  /* Number of singular values, sorted in decreasing order, that are above
+   * the tolerance. */
+  static tensor::index
+  pinv_rank(const RTensor &s, double tol)
+  {
+    if (tol <= 0) {
+      tol = DBL_EPSILON;
+    }
+    tensor::index r = 0;
+    while (r < s.size() && s[r] > tol) {
+      r++;
+    }
+    return r;
+  }
+
+  template<class Tensor>
+  PseudoInverse<Tensor>::PseudoInverse() : U_(), VT_(), s_(), rank_(0)
+  {}
+
+  template<class Tensor>
+  PseudoInverse<Tensor>::PseudoInverse(const Tensor &A, double tol) :
+    U_(), VT_(), s_(), rank_(0)
+  {
+    factor(A, tol);
+  }
+
+  template<class Tensor>
+  void
+  PseudoInverse<Tensor>::factor(const Tensor &A, double tol)
+  {
+    s_ = svd(A, &U_, &VT_, SVD_ECONOMIC);
+    rank_ = pinv_rank(s_, tol);
+  }
+
+  /* X = V * S^-1 * U^+ * B, using only the first 'rank' columns of U and
+   * rows of VT. Both truncated factors are read in place, with the leading
+   * dimension of the full matrices, so nothing is sliced or copied. */
+  template<class Tensor>
+  void
+  PseudoInverse<Tensor>::solve(const Tensor &B, Tensor *X) const
+  {
+    typedef typename Tensor::elt_t elt_t;
+    integer m = U_.rows(), k = U_.columns(), n = VT_.columns();
+    if (B.rank() == 0 || B.dimension(0) != m) {
+      std::cerr << "In PseudoInverse::solve(B), the first dimension of B "
+                << "does not match the rows of the factored matrix."
+                << std::endl;
+      abort();
+    }
+    integer nrhs = m? B.size() / m : 0;
+    integer r = rank_;
+    Tensor W(r, nrhs);
+    if (r && nrhs) {
+      elt_t *w = W.begin();
+      blas::gemm('C', 'N', r, nrhs, m, tensor::number_one<elt_t>(),
+                 U_.begin_const(), m, B.begin_const(), m,
+                 tensor::number_zero<elt_t>(), w, r);
+      for (integer i = 0; i < r; i++) {
+        double inv_s = 1.0 / s_[i];
+        for (integer j = 0; j < nrhs; j++) {
+          w[i + j * r] *= inv_s;
+        }
+      }
+    }
+    Indices d(B.dimensions());
+    d.at(0) = n;
+    if (!all_equal(X->dimensions(), d)) {
+      *X = Tensor(d);
+    }
+    if (r && nrhs) {
+      blas::gemm('C', 'N', n, nrhs, r, tensor::number_one<elt_t>(),
+                 VT_.begin_const(), k, W.begin_const(), r,
+                 tensor::number_zero<elt_t>(), X->begin(), n);
+    } else {
+      std::fill(X->begin(), X->end(), tensor::number_zero<elt_t>());
+    }
+  }
+
+  template<class Tensor>
+  const Tensor
+  PseudoInverse<Tensor>::solve(const Tensor &B) const
+  {
+    Tensor X;
+    solve(B, &X);
+    return X;
+  }
+
+} // namespace linalg
+
+#endif // TENSOR_LINALG_PSEUDO_INVERSE_HPP
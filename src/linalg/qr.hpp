@@ -0,0 +1,314 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <algorithm>
+#include <tensor/tensor.h>
+#include <tensor/tensor_lapack.h>
+#include <tensor/linalg.h>
+#include "lapack_workspace.hpp"
+
+namespace linalg {
+
+  using namespace lapack;
+  using tensor::Tensor;
+  using tensor::Indices;
+
+  /* Calls to the LAPACK drivers, overloaded on the element type. A query
+   * (lwork = -1) returns the optimal size of 'work' in its first element.
+   * ACML allocates its own workspace, so its queries return 1. */
+
+  static inline void
+  qr_geqrf(integer m, integer n, double *a, double *tau, double *work,
+           integer lwork, integer *info)
+  {
+#ifdef TENSOR_USE_ACML
+    if (lwork < 0) { *work = 1; *info = 0; return; }
+    dgeqrf(m, n, a, m, tau, info);
+#else
+    F77NAME(dgeqrf)(&m, &n, a, &m, tau, work, &lwork, info);
+#endif
+  }
+
+  static inline void
+  qr_geqrf(integer m, integer n, cdouble *a, cdouble *tau, cdouble *work,
+           integer lwork, integer *info)
+  {
+#ifdef TENSOR_USE_ACML
+    if (lwork < 0) { *work = 1; *info = 0; return; }
+    zgeqrf(m, n, a, m, tau, info);
+#else
+    F77NAME(zgeqrf)(&m, &n, a, &m, tau, work, &lwork, info);
+#endif
+  }
+
+  static inline void
+  qr_geqp3(integer m, integer n, double *a, integer *jpvt, double *tau,
+           double *work, integer lwork, double *, integer *info)
+  {
+#ifdef TENSOR_USE_ACML
+    if (lwork < 0) { *work = 1; *info = 0; return; }
+    dgeqp3(m, n, a, m, jpvt, tau, info);
+#else
+    F77NAME(dgeqp3)(&m, &n, a, &m, jpvt, tau, work, &lwork, info);
+#endif
+  }
+
+  static inline void
+  qr_geqp3(integer m, integer n, cdouble *a, integer *jpvt, cdouble *tau,
+           cdouble *work, integer lwork, double *rwork, integer *info)
+  {
+#ifdef TENSOR_USE_ACML
+    if (lwork < 0) { *work = 1; *info = 0; return; }
+    zgeqp3(m, n, a, m, jpvt, tau, info);
+#else
+    F77NAME(zgeqp3)(&m, &n, a, &m, jpvt, tau, work, &lwork, rwork, info);
+#endif
+  }
+
+  static inline void
+  qr_orgqr(integer m, integer n, integer k, double *a, double *tau,
+           double *work, integer lwork, integer *info)
+  {
+#ifdef TENSOR_USE_ACML
+    if (lwork < 0) { *work = 1; *info = 0; return; }
+    dorgqr(m, n, k, a, m, tau, info);
+#else
+    F77NAME(dorgqr)(&m, &n, &k, a, &m, tau, work, &lwork, info);
+#endif
+  }
+
+  static inline void
+  qr_orgqr(integer m, integer n, integer k, cdouble *a, cdouble *tau,
+           cdouble *work, integer lwork, integer *info)
+  {
+#ifdef TENSOR_USE_ACML
+    if (lwork < 0) { *work = 1; *info = 0; return; }
+    zungqr(m, n, k, a, m, tau, info);
+#else
+    F77NAME(zungqr)(&m, &n, &k, a, &m, tau, work, &lwork, info);
+#endif
+  }
+
+  static inline void
+  qr_gelqf(integer m, integer n, double *a, double *tau, double *work,
+           integer lwork, integer *info)
+  {
+#ifdef TENSOR_USE_ACML
+    if (lwork < 0) { *work = 1; *info = 0; return; }
+    dgelqf(m, n, a, m, tau, info);
+#else
+    F77NAME(dgelqf)(&m, &n, a, &m, tau, work, &lwork, info);
+#endif
+  }
+
+  static inline void
+  qr_gelqf(integer m, integer n, cdouble *a, cdouble *tau, cdouble *work,
+           integer lwork, integer *info)
+  {
+#ifdef TENSOR_USE_ACML
+    if (lwork < 0) { *work = 1; *info = 0; return; }
+    zgelqf(m, n, a, m, tau, info);
+#else
+    F77NAME(zgelqf)(&m, &n, a, &m, tau, work, &lwork, info);
+#endif
+  }
+
+  static inline void
+  qr_orglq(integer m, integer n, integer k, double *a, double *tau,
+           double *work, integer lwork, integer *info)
+  {
+#ifdef TENSOR_USE_ACML
+    if (lwork < 0) { *work = 1; *info = 0; return; }
+    dorglq(m, n, k, a, m, tau, info);
+#else
+    F77NAME(dorglq)(&m, &n, &k, a, &m, tau, work, &lwork, info);
+#endif
+  }
+
+  static inline void
+  qr_orglq(integer m, integer n, integer k, cdouble *a, cdouble *tau,
+           cdouble *work, integer lwork, integer *info)
+  {
+#ifdef TENSOR_USE_ACML
+    if (lwork < 0) { *work = 1; *info = 0; return; }
+    zunglq(m, n, k, a, m, tau, info);
+#else
+    F77NAME(zunglq)(&m, &n, &k, a, &m, tau, work, &lwork, info);
+#endif
+  }
+
+  static void
+  qr_check_info(const char *function, const char *driver, integer info)
+  {
+    if (info) {
+      std::cerr << "In " << function << "(), " << driver
+                << " returned info = " << info << std::endl;
+      abort();
+    }
+  }
+
+  /* QR decomposition A = Q R of an m x n matrix, or A(:,perm) = Q R when
+   * 'perm' is not null, with column pivoting chosen by geqp3 so that the
+   * diagonal of R decreases in absolute value. The Householder reflectors
+   * returned by geqrf are expanded into Q by orgqr, which only needs the
+   * first min(m,n) of them. With 'economic', Q is m x min(m,n) and R is
+   * min(m,n) x n; otherwise Q is m x m and R is m x n. */
+  template<typename elt_t>
+  static void
+  qr_driver(Tensor<elt_t> A, Tensor<elt_t> *Q, Tensor<elt_t> *R,
+            bool economic, Indices *perm)
+  {
+    assert(A.rows() > 0);
+    assert(A.columns() > 0);
+    assert(A.rank() == 2);
+
+    integer m = A.rows();
+    integer n = A.columns();
+    integer k = std::min(m, n);
+    integer info;
+    typedef typename lapack_type<elt_t>::type lapack_t;
+    lapack_t *a = tensor_pointer(A), *tau = new lapack_t[k], foo;
+
+    if (perm) {
+      integer *jpvt = new integer[n];
+      std::fill(jpvt, jpvt + n, 0);
+      double *rwork = new double[lapack_rwork_size<elt_t>(2 * n)];
+      LapackWorkspaceKey key('P', 'N', 'N', m, n, 0);
+      LapackWorkspace sizes;
+      if (!lapack_cached_workspace(key, &sizes)) {
+        qr_geqp3(m, n, a, jpvt, tau, &foo, -1, rwork, &info);
+        sizes.lwork = lapack_lwork(foo);
+        lapack_store_workspace(key, sizes);
+      }
+      lapack_t *work = new lapack_t[sizes.lwork];
+      qr_geqp3(m, n, a, jpvt, tau, work, sizes.lwork, rwork, &info);
+      delete[] work;
+      delete[] rwork;
+      *perm = Indices(n);
+      for (integer j = 0; j < n; j++)
+        perm->at(j) = jpvt[j] - 1;
+      delete[] jpvt;
+      qr_check_info("qr_pivoted", "geqp3", info);
+    } else {
+      LapackWorkspaceKey key('Q', 'N', 'N', m, n, 0);
+      LapackWorkspace sizes;
+      if (!lapack_cached_workspace(key, &sizes)) {
+        qr_geqrf(m, n, a, tau, &foo, -1, &info);
+        sizes.lwork = lapack_lwork(foo);
+        lapack_store_workspace(key, sizes);
+      }
+      lapack_t *work = new lapack_t[sizes.lwork];
+      qr_geqrf(m, n, a, tau, work, sizes.lwork, &info);
+      delete[] work;
+      qr_check_info("qr", "geqrf", info);
+    }
+
+    if (R) {
+      integer rrows = economic? k : m;
+      *R = Tensor<elt_t>::zeros(rrows, n);
+      lapack_t *r = tensor_pointer(*R);
+      for (integer j = 0; j < n; j++) {
+        for (integer i = 0, last = std::min(j + 1, rrows); i < last; i++)
+          r[i + rrows * j] = a[i + m * j];
+      }
+    }
+    if (Q) {
+      integer qcols = economic? k : m;
+      *Q = Tensor<elt_t>(m, qcols);
+      lapack_t *q = tensor_pointer(*Q);
+      std::copy(a, a + m * std::min(qcols, n), q);
+      LapackWorkspaceKey key('G', 'N', 'N', m, qcols, k);
+      LapackWorkspace sizes;
+      if (!lapack_cached_workspace(key, &sizes)) {
+        qr_orgqr(m, qcols, k, q, tau, &foo, -1, &info);
+        sizes.lwork = lapack_lwork(foo);
+        lapack_store_workspace(key, sizes);
+      }
+      lapack_t *work = new lapack_t[sizes.lwork];
+      qr_orgqr(m, qcols, k, q, tau, work, sizes.lwork, &info);
+      delete[] work;
+      qr_check_info(perm? "qr_pivoted" : "qr", "orgqr", info);
+    }
+    delete[] tau;
+  }
+
+  /* LQ decomposition A = L Q of an m x n matrix, the transpose of the QR
+   * decomposition, computed by gelqf and orglq without transposing A. With
+   * 'economic', L is m x min(m,n) and Q is min(m,n) x n; otherwise L is
+   * m x n and Q is n x n. */
+  template<typename elt_t>
+  static void
+  lq_driver(Tensor<elt_t> A, Tensor<elt_t> *L, Tensor<elt_t> *Q,
+            bool economic)
+  {
+    assert(A.rows() > 0);
+    assert(A.columns() > 0);
+    assert(A.rank() == 2);
+
+    integer m = A.rows();
+    integer n = A.columns();
+    integer k = std::min(m, n);
+    integer info;
+    typedef typename lapack_type<elt_t>::type lapack_t;
+    lapack_t *a = tensor_pointer(A), *tau = new lapack_t[k], foo;
+
+    LapackWorkspaceKey key('L', 'N', 'N', m, n, 0);
+    LapackWorkspace sizes;
+    if (!lapack_cached_workspace(key, &sizes)) {
+      qr_gelqf(m, n, a, tau, &foo, -1, &info);
+      sizes.lwork = lapack_lwork(foo);
+      lapack_store_workspace(key, sizes);
+    }
+    lapack_t *work = new lapack_t[sizes.lwork];
+    qr_gelqf(m, n, a, tau, work, sizes.lwork, &info);
+    delete[] work;
+    qr_check_info("lq", "gelqf", info);
+
+    if (L) {
+      integer lcols = economic? k : n;
+      *L = Tensor<elt_t>::zeros(m, lcols);
+      lapack_t *l = tensor_pointer(*L);
+      for (integer j = 0; j < std::min(lcols, m); j++) {
+        for (integer i = j; i < m; i++)
+          l[i + m * j] = a[i + m * j];
+      }
+    }
+    if (Q) {
+      integer qrows = economic? k : n;
+      *Q = Tensor<elt_t>(qrows, n);
+      lapack_t *q = tensor_pointer(*Q);
+      integer copied = std::min(qrows, m);
+      for (integer j = 0; j < n; j++)
+        std::copy(a + m * j, a + m * j + copied, q + qrows * j);
+      LapackWorkspaceKey key('H', 'N', 'N', qrows, n, k);
+      LapackWorkspace sizes;
+      if (!lapack_cached_workspace(key, &sizes)) {
+        qr_orglq(qrows, n, k, q, tau, &foo, -1, &info);
+        sizes.lwork = lapack_lwork(foo);
+        lapack_store_workspace(key, sizes);
+      }
+      lapack_t *work = new lapack_t[sizes.lwork];
+      qr_orglq(qrows, n, k, q, tau, work, sizes.lwork, &info);
+      delete[] work;
+      qr_check_info("lq", "orglq", info);
+    }
+    delete[] tau;
+  }
+
+} // namespace linalg
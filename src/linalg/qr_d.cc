@@ -0,0 +1,61 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include "qr.hpp"
+
+namespace linalg {
+
+  /**QR decomposition of a real matrix.
+
+     Finds a matrix Q with orthonormal columns and an upper triangular matrix
+     R such that \f$A = Q R\f$. If A has \c MxN elements, Q is \c MxM and
+     R is \c MxN, unless \c economic is different from zero, in which case
+     Q is \c MxK and R is \c KxN, with \c K=min(M,N). Either of Q and R
+     may be omitted by passing a null pointer.
+
+     Obtaining an orthonormal basis for the columns of A in this way is
+     several times cheaper than with svd().
+
+     \ingroup Linalg
+  */
+  void
+  qr(const RTensor &A, RTensor *Q, RTensor *R, bool economic)
+  {
+    qr_driver(A, Q, R, economic, 0);
+  }
+
+  /**QR decomposition of a real matrix with column pivoting.
+
+     As qr(), but the columns of A are reordered so that the diagonal
+     elements of R decrease in absolute value, \f$A(:,p) = Q R\f$. The
+     output is the permutation \c p. The number of diagonal elements of R
+     above a tolerance estimates the numerical rank of A, and the first
+     columns of Q are a basis for its range.
+
+     \ingroup Linalg
+  */
+  Indices
+  qr_pivoted(const RTensor &A, RTensor *Q, RTensor *R, bool economic)
+  {
+    Indices perm;
+    qr_driver(A, Q, R, economic, &perm);
+    return perm;
+  }
+
+} // namespace linalg
@@ -0,0 +1,142 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <cmath>
+#include <tensor/tensor.h>
+#include <tensor/linalg.h>
+#include "../arpack/gemv.cc"
+
+namespace linalg {
+
+  using namespace tensor;
+
+  /* Number of times that a column which is linearly dependent on the
+   * previous ones is replaced with a random vector. */
+  static const int RSVD_MAX_RETRIES = 3;
+
+  static inline double rsvd_center(double) { return 0.5; }
+  static inline cdouble rsvd_center(cdouble) { return to_complex(0.5, 0.5); }
+
+  /* Gaussian-like test matrix, uniformly distributed around zero. */
+  template<typename elt_t>
+  static const Tensor<elt_t>
+  rsvd_random(tensor::index rows, tensor::index cols)
+  {
+    Tensor<elt_t> output = Tensor<elt_t>::random(rows, cols);
+    elt_t center = rsvd_center(number_zero<elt_t>());
+    for (typename Tensor<elt_t>::iterator it = output.begin();
+         it != output.end(); ++it)
+      *it -= center;
+    return output;
+  }
+
+  template<typename elt_t>
+  static double
+  rsvd_norm(tensor::index n, const elt_t *v)
+  {
+    double output = 0;
+    for (tensor::index i = 0; i < n; i++)
+      output += abs2(v[i]);
+    return sqrt(output);
+  }
+
+  /* Replace the columns of 'Q' with an orthonormal basis of the space they
+   * span, using two passes of classical Gram-Schmidt per column. Columns
+   * that are (numerically) dependent on the previous ones are replaced by
+   * random vectors, so that the output always has orthonormal columns. */
+  template<typename elt_t>
+  static void
+  rsvd_orthonormalize(Tensor<elt_t> &Q)
+  {
+    const elt_t one = number_one<elt_t>(), zero = number_zero<elt_t>();
+    tensor::index m = Q.rows(), l = Q.columns();
+    Tensor<elt_t> C(l);
+    elt_t *q = Q.begin(), *c = C.begin();
+    for (tensor::index j = 0; j < l; j++) {
+      elt_t *v = q + j * m;
+      for (int retry = 0; ; retry++) {
+        double old_norm = rsvd_norm(m, v);
+        for (int pass = 0; j && pass < 2; pass++) {
+          blas::gemv('C', m, j, one, q, m, v, 1, zero, c, 1);
+          blas::gemv('N', m, j, -one, q, m, c, 1, one, v, 1);
+        }
+        double norm = rsvd_norm(m, v);
+        if (norm > 1e-10 * old_norm && norm > 0) {
+          for (tensor::index i = 0; i < m; i++)
+            v[i] /= norm;
+          break;
+        }
+        if (retry == RSVD_MAX_RETRIES) {
+          std::cerr << "In rsvd(), unable to complete an orthonormal basis\n";
+          abort();
+        }
+        Tensor<elt_t> r = rsvd_random<elt_t>(m, 1);
+        std::copy(r.begin(), r.end(), v);
+      }
+    }
+  }
+
+  template<typename elt_t>
+  static const Tensor<elt_t>
+  rsvd_apply(const Map<Tensor<elt_t> > *A, const Tensor<elt_t> &X)
+  {
+    Tensor<elt_t> output;
+    A->apply_into(X, output);
+    return output;
+  }
+
+  /* Randomized SVD (Halko, Martinsson and Tropp, SIAM Rev. 53, 217
+   * (2011)). The range of A is sampled with 'rank + oversampling' random
+   * vectors, refined with 'power_iters' steps of subspace iteration with
+   * A A^H, and the SVD of the small projection Q^H A gives the leading
+   * singular triplets. */
+  template<typename elt_t>
+  static RTensor
+  rsvd_loop(const Map<Tensor<elt_t> > *A, const Map<Tensor<elt_t> > *Ah,
+            tensor::index m, tensor::index n, tensor::index rank,
+            tensor::index oversampling, int power_iters, Tensor<elt_t> *U,
+            Tensor<elt_t> *VT)
+  {
+    tensor::index k = std::min(m, n);
+    if (rank == 0 || rank > k) {
+      std::cerr << "In rsvd(), the rank " << rank << " must be between 1 "
+                << "and the smallest dimension of the matrix, " << k << '\n';
+      abort();
+    }
+    tensor::index l = std::min(rank + oversampling, k);
+
+    Tensor<elt_t> Q = rsvd_apply(A, rsvd_random<elt_t>(n, l));
+    rsvd_orthonormalize(Q);
+    for (int i = 0; i < power_iters; i++) {
+      Tensor<elt_t> Z = rsvd_apply(Ah, Q);
+      rsvd_orthonormalize(Z);
+      Q = rsvd_apply(A, Z);
+      rsvd_orthonormalize(Q);
+    }
+    Tensor<elt_t> B = adjoint(rsvd_apply(Ah, Q));
+    Tensor<elt_t> UB;
+    RTensor s = svd(B, U? &UB : 0, VT, SVD_ECONOMIC);
+    if (U)
+      *U = mmult(Q, Tensor<elt_t>(UB(range(), range(0, rank - 1))));
+    if (VT)
+      *VT = (*VT)(range(0, rank - 1), range());
+    return s(range(0, rank - 1));
+  }
+
+} // namespace linalg
@@ -0,0 +1,61 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include "rsvd.hpp"
+
+namespace linalg {
+
+  /**Randomized singular value decomposition of a real linear map, given
+     through the maps for A and its adjoint, which remain owned by the caller.
+     See rsvd(const RTensor &, tensor::index, tensor::index, int, RTensor *, RTensor *).
+
+     \ingroup Linalg
+  */
+  RTensor
+  rsvd(const Map<RTensor> *A, const Map<RTensor> *Ah, tensor::index rows,
+       tensor::index columns, tensor::index rank, tensor::index oversampling,
+       int power_iters, RTensor *U, RTensor *VT)
+  {
+    return rsvd_loop(A, Ah, rows, columns, rank, oversampling, power_iters,
+                     U, VT);
+  }
+
+  /**Randomized singular value decomposition of a real matrix.
+
+     This computes approximately the \a rank largest singular values of \a A
+     and, optionally, the associated vectors, with U being \c M x rank and VT
+     \c rank x N. The range of A is sampled with \a rank + \a oversampling
+     random vectors and improved with \a power_iters steps of subspace
+     iteration, which are needed when the singular values decay slowly. Only
+     products of A and its adjoint with blocks of vectors, and a small SVD
+     are needed, making this much cheaper than svd() when the rank is small.
+
+     \ingroup Linalg
+  */
+  RTensor
+  rsvd(const RTensor &A, tensor::index rank, tensor::index oversampling,
+       int power_iters, RTensor *U, RTensor *VT)
+  {
+    assert(A.rank() == 2);
+    tensor::MatrixMap<RTensor> map(A), adjoint_map(adjoint(A));
+    return rsvd_loop(&map, &adjoint_map, A.rows(), A.columns(), rank,
+                     oversampling, power_iters, U, VT);
+  }
+
+} // namespace linalg
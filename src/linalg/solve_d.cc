@@ -20,6 +20,7 @@
 #include <tensor/tensor.h>
 #include <tensor/tensor_lapack.h>
 #include <tensor/linalg.h>
+#include "factorizations.hpp"
 
 namespace linalg {
 
@@ -90,4 +91,23 @@ namespace linalg {
     return output;
   }
 
+  /**Solve a real linear system of equations, choosing the factorization.
+
+     With SOLVE_CHOLESKY, A must be Hermitian and positive definite, and
+     only its lower triangle is used. With SOLVE_AUTO, the Cholesky
+     factorization, which costs half as much as LU, is tried when A is
+     exactly Hermitian with a positive diagonal, and LU is used if that
+     fails or A is not Hermitian. SOLVE_LU is the same as solve(A, B).
+
+     To solve many systems with the same matrix, use the LU, Cholesky or
+     LDLT objects, which keep the factorization.
+
+     \ingroup Linalg
+  */
+  const RTensor
+  solve(const RTensor &A, const RTensor &B, SolveAlgorithm algorithm)
+  {
+    return do_solve(A, B, algorithm);
+  }
+
 }
@@ -0,0 +1,257 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <cfloat>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <tensor/tensor.h>
+#include <tensor/io.h>
+#include <tensor/tensor_lapack.h>
+#include <tensor/linalg.h>
+#include "../tensor/gemm.cc"
+
+namespace linalg {
+
+  using namespace lapack;
+  using tensor::Tensor;
+
+  /* Single precision counterpart of each element type. */
+  template<typename elt_t> struct refined_float { typedef float type; };
+  template<> struct refined_float<tensor::cdouble> { typedef cfloat type; };
+
+  /* Maximum number of refinement steps before we give up and solve in
+   * double precision, as in LAPACK's dsgesv. */
+  static const int refine_max_iterations = 30;
+
+  static inline void
+  refine_getrf(integer n, float *a, integer *ipiv, integer *info)
+  {
+#ifdef TENSOR_USE_ACML
+    sgetrf(n, n, a, n, ipiv, info);
+#else
+    F77NAME(sgetrf)(&n, &n, a, &n, ipiv, info);
+#endif
+  }
+
+  static inline void
+  refine_getrf(integer n, cfloat *a, integer *ipiv, integer *info)
+  {
+#ifdef TENSOR_USE_ACML
+    cgetrf(n, n, a, n, ipiv, info);
+#else
+    F77NAME(cgetrf)(&n, &n, a, &n, ipiv, info);
+#endif
+  }
+
+  static inline void
+  refine_getrs(integer n, integer nrhs, float *a, integer *ipiv, float *b,
+               integer *info)
+  {
+    char trans = 'N';
+#ifdef TENSOR_USE_ACML
+    sgetrs(trans, n, nrhs, a, n, ipiv, b, n, info);
+#else
+    F77NAME(sgetrs)(&trans, &n, &nrhs, a, &n, ipiv, b, &n, info);
+#endif
+  }
+
+  static inline void
+  refine_getrs(integer n, integer nrhs, cfloat *a, integer *ipiv, cfloat *b,
+               integer *info)
+  {
+    char trans = 'N';
+#ifdef TENSOR_USE_ACML
+    cgetrs(trans, n, nrhs, a, n, ipiv, b, n, info);
+#else
+    F77NAME(cgetrs)(&trans, &n, &nrhs, a, &n, ipiv, b, &n, info);
+#endif
+  }
+
+  /* Conversion kernels between double and single precision buffers. A
+   * complex number is a pair of reals in both precisions, so 'size' counts
+   * real components. Rounding to single precision fails, returning false,
+   * if some element overflows. */
+  static bool
+  refine_to_float(const double *x, float *y, size_t size)
+  {
+    bool ok = true;
+    for (size_t i = 0; i < size; i++) {
+      ok = ok && std::abs(x[i]) <= FLT_MAX;
+      y[i] = (float)x[i];
+    }
+    return ok;
+  }
+
+  static void
+  refine_to_double(const float *x, double *y, size_t size)
+  {
+    for (size_t i = 0; i < size; i++)
+      y[i] = x[i];
+  }
+
+  static void
+  refine_add_float(const float *x, double *y, size_t size)
+  {
+    for (size_t i = 0; i < size; i++)
+      y[i] += x[i];
+  }
+
+  template<typename elt_t>
+  static double
+  refine_column_norminf(const elt_t *x, tensor::index n)
+  {
+    double output = 0.0;
+    for (tensor::index i = 0; i < n; i++)
+      output = std::max(output, tensor::abs(x[i]));
+    return output;
+  }
+
+  /* R = B - A X, computed in double precision. */
+  template<typename elt_t>
+  static void
+  refine_residual(integer n, integer nrhs, const elt_t *a, const elt_t *b,
+                  const elt_t *x, elt_t *r)
+  {
+    std::copy(b, b + n * nrhs, r);
+    blas::gemm('N', 'N', n, nrhs, n, -tensor::number_one<elt_t>(), a, n,
+               x, n, tensor::number_one<elt_t>(), r, n);
+  }
+
+  /* Convergence test of dsgesv: every column satisfies |r| <= tol |x| in
+   * the infinity norm. */
+  template<typename elt_t>
+  static bool
+  refine_converged(integer n, integer nrhs, const elt_t *x, const elt_t *r,
+                   double tolerance)
+  {
+    for (integer j = 0; j < nrhs; j++, x += n, r += n) {
+      if (refine_column_norminf(r, n) > tolerance * refine_column_norminf(x, n))
+        return false;
+    }
+    return true;
+  }
+
+  /* Normwise backward error of the worst column, |r| / (|A| |x| + |b|) in
+   * the infinity norm. */
+  template<typename elt_t>
+  static double
+  refine_backward_error(integer n, integer nrhs, double anorm,
+                        const elt_t *b, const elt_t *x, const elt_t *r)
+  {
+    double output = 0.0;
+    for (integer j = 0; j < nrhs; j++, b += n, x += n, r += n) {
+      double scale = anorm * refine_column_norminf(x, n) +
+        refine_column_norminf(b, n);
+      if (scale > 0)
+        output = std::max(output, refine_column_norminf(r, n) / scale);
+    }
+    return output;
+  }
+
+  /* Mixed precision solver, following LAPACK's dsgesv: A is factored in
+   * single precision, at half the cost and memory traffic of a double LU,
+   * and the solution is refined with residuals computed in double
+   * precision until its backward error is that of a double precision
+   * solver. Badly conditioned matrices, with a condition number beyond
+   * 1e8, and matrices with elements that overflow in single precision,
+   * fall back to the double precision LU of solve(). */
+  template<typename elt_t>
+  static const Tensor<elt_t>
+  do_solve_refined(const Tensor<elt_t> &A, const Tensor<elt_t> &B,
+                   int *iterations, double *backward_error)
+  {
+    typedef typename refined_float<elt_t>::type float_t;
+    const size_t width = sizeof(elt_t) / sizeof(double);
+
+    integer n = A.rows();
+    if (A.rank() != 2 || n != (integer)A.columns() || n == 0) {
+      std::cerr << "Routine solve_refined() can only operate on square "
+                << "systems of equations, but A has dimensions "
+                << A.dimensions() << std::endl;
+      abort();
+    }
+    if (B.rank() == 0 || (integer)B.dimension(0) != n) {
+      std::cerr << "In solve_refined(A,B), the number of equations does not "
+                << "match the number of right\nhand members. While matrix A "
+                << "has " << n << " rows, B has dimensions " << B.dimensions()
+                << std::endl;
+      abort();
+    }
+    integer nrhs = B.size() / n;
+    const elt_t *a = A.begin_const();
+    const elt_t *b = B.begin_const();
+
+    double anorm = 0.0;
+    {
+      std::vector<double> rows(n, 0.0);
+      for (integer j = 0; j < n; j++)
+        for (integer i = 0; i < n; i++)
+          rows[i] += tensor::abs(a[i + n * j]);
+      anorm = *std::max_element(rows.begin(), rows.end());
+    }
+    double tolerance = anorm * DBL_EPSILON * std::sqrt((double)n);
+
+    Tensor<elt_t> X(B.dimensions()), R(B.dimensions());
+    elt_t *x = X.begin(), *r = R.begin();
+    float_t *af = new float_t[n * n];
+    float_t *wf = new float_t[n * nrhs];
+    integer *ipiv = new integer[n];
+    integer info;
+    int steps = -1;
+
+    if (refine_to_float((const double *)a, (float *)af, width * n * n)) {
+      refine_getrf(n, af, ipiv, &info);
+      if (info == 0 &&
+          refine_to_float((const double *)b, (float *)wf, width * n * nrhs)) {
+        refine_getrs(n, nrhs, af, ipiv, wf, &info);
+        refine_to_double((const float *)wf, (double *)x, width * n * nrhs);
+        for (int k = 0; k <= refine_max_iterations; k++) {
+          refine_residual(n, nrhs, a, b, x, r);
+          if (refine_converged(n, nrhs, x, r, tolerance)) {
+            steps = k;
+            break;
+          }
+          if (k == refine_max_iterations ||
+              !refine_to_float((const double *)r, (float *)wf,
+                               width * n * nrhs))
+            break;
+          refine_getrs(n, nrhs, af, ipiv, wf, &info);
+          refine_add_float((const float *)wf, (double *)x, width * n * nrhs);
+        }
+      }
+    }
+    delete[] af;
+    delete[] wf;
+    delete[] ipiv;
+
+    if (steps < 0) {
+      X = solve(A, B);
+      x = X.begin();
+      if (backward_error)
+        refine_residual(n, nrhs, a, b, x, r);
+    }
+    if (iterations)
+      *iterations = steps;
+    if (backward_error)
+      *backward_error = refine_backward_error(n, nrhs, anorm, b, x, r);
+    return X;
+  }
+
+} // namespace linalg
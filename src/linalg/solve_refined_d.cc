@@ -0,0 +1,49 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include "solve_refined.hpp"
+
+namespace linalg {
+
+  /**Solve a real linear system of equations with mixed precision.
+
+     Finds X such that A X = B, as solve(A, B). The matrix is factored in
+     single precision with sgetrf, which is roughly twice as fast as the
+     double precision factorization, and the solution is then refined with
+     residuals computed in double precision until it is as accurate as that
+     of solve(). If the refinement does not converge, because A is too
+     badly conditioned, or A does not fit in single precision, the system
+     is solved with a double precision LU decomposition instead.
+
+     If \c iterations is not null, it receives the number of refinement
+     steps, or -1 if the double precision solver had to be used. If
+     \c backward_error is not null, it receives the normwise backward error
+     of the solution, \f$\max_j |B_j - A X_j| / (|A| |X_j| + |B_j|)\f$ in
+     the infinity norm.
+
+     \ingroup Linalg
+  */
+  const RTensor
+  solve_refined(const RTensor &A, const RTensor &B, int *iterations,
+                double *backward_error)
+  {
+    return do_solve_refined(A, B, iterations, backward_error);
+  }
+
+} // namespace linalg
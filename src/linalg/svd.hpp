@@ -0,0 +1,323 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <algorithm>
+#include <tensor/tensor.h>
+#include <tensor/tensor_lapack.h>
+#include <tensor/linalg.h>
+#include "lapack_workspace.hpp"
+
+namespace linalg {
+
+  using namespace lapack;
+  using tensor::Tensor;
+  using tensor::range;
+
+  /* Calls to the LAPACK drivers, overloaded on the element type so that
+   * the algorithm below is written only once. 'rwork' is ignored by the
+   * real versions, which get an empty one. */
+
+  static inline void
+  svd_gesvd(char jobu, char jobv, integer m, integer n, double *a, double *s,
+            double *u, integer ldu, double *v, integer ldv, double *work,
+            integer lwork, double *, integer *info)
+  {
+    F77NAME(dgesvd)(&jobu, &jobv, &m, &n, a, &m, s, u, &ldu, v, &ldv,
+                    work, &lwork, info);
+  }
+
+  static inline void
+  svd_gesvd(char jobu, char jobv, integer m, integer n, cdouble *a, double *s,
+            cdouble *u, integer ldu, cdouble *v, integer ldv, cdouble *work,
+            integer lwork, double *rwork, integer *info)
+  {
+    F77NAME(zgesvd)(&jobu, &jobv, &m, &n, a, &m, s, u, &ldu, v, &ldv,
+                    work, &lwork, rwork, info);
+  }
+
+  static inline void
+  svd_gesdd(char jobz, integer m, integer n, double *a, double *s,
+            double *u, integer ldu, double *v, integer ldv, double *work,
+            integer lwork, double *, integer *iwork, integer *info)
+  {
+    F77NAME(dgesdd)(&jobz, &m, &n, a, &m, s, u, &ldu, v, &ldv,
+                    work, &lwork, iwork, info);
+  }
+
+  static inline void
+  svd_gesdd(char jobz, integer m, integer n, cdouble *a, double *s,
+            cdouble *u, integer ldu, cdouble *v, integer ldv, cdouble *work,
+            integer lwork, double *rwork, integer *iwork, integer *info)
+  {
+    F77NAME(zgesdd)(&jobz, &m, &n, a, &m, s, u, &ldu, v, &ldv,
+                    work, &lwork, rwork, iwork, info);
+  }
+
+  static inline void
+  svd_gesvdx(char jobu, char jobv, integer m, integer n, double *a,
+             integer iu, integer *ns, double *s, double *u, integer ldu,
+             double *v, integer ldv, double *work, integer lwork,
+             double *, integer *iwork, integer *info)
+  {
+    char range = 'I';
+    integer il = 1;
+    double vl = 0, vu = 0;
+    F77NAME(dgesvdx)(&jobu, &jobv, &range, &m, &n, a, &m, &vl, &vu, &il, &iu,
+                     ns, s, u, &ldu, v, &ldv, work, &lwork, iwork, info);
+  }
+
+  static inline void
+  svd_gesvdx(char jobu, char jobv, integer m, integer n, cdouble *a,
+             integer iu, integer *ns, double *s, cdouble *u, integer ldu,
+             cdouble *v, integer ldv, cdouble *work, integer lwork,
+             double *rwork, integer *iwork, integer *info)
+  {
+    char range = 'I';
+    integer il = 1;
+    double vl = 0, vu = 0;
+    F77NAME(zgesvdx)(&jobu, &jobv, &range, &m, &n, a, &m, &vl, &vu, &il, &iu,
+                     ns, s, u, &ldu, v, &ldv, work, &lwork, rwork, iwork,
+                     info);
+  }
+
+#ifdef TENSOR_USE_ACML
+  static inline void
+  acml_gesvd(char jobu, char jobv, integer m, integer n, double *a, double *s,
+             double *u, integer ldu, double *v, integer ldv, integer *info)
+  {
+    dgesvd(jobu, jobv, m, n, a, m, s, u, ldu, v, ldv, info);
+  }
+
+  static inline void
+  acml_gesvd(char jobu, char jobv, integer m, integer n, cdouble *a,
+             double *s, cdouble *u, integer ldu, cdouble *v, integer ldv,
+             integer *info)
+  {
+    zgesvd(jobu, jobv, m, n, a, m, s, u, ldu, v, ldv, info);
+  }
+#endif
+
+  /* Singular value decomposition with one of three LAPACK drivers:
+   *  - gesvd, QR iteration, the slowest but most robust one.
+   *  - gesdd, divide and conquer, which needs more memory and is several
+   *    times faster when the singular vectors are computed. If it fails to
+   *    converge, we retry with gesvd.
+   *  - gesvdx, which computes only the 'max_rank' largest singular values
+   *    and their vectors, through a bisection and inverse iteration on an
+   *    auxiliary tridiagonal matrix. It cannot produce the full unitary
+   *    matrices.
+   * The decomposition overwrites 'A'.
+   */
+  template<typename elt_t>
+  static RTensor
+  svd_driver(Tensor<elt_t> &A, Tensor<elt_t> *U, Tensor<elt_t> *VT,
+             bool economic, tensor::index max_rank, SVDAlgorithm algorithm,
+             LapackBuffers *buffers = 0)
+  {
+    assert(A.rows() > 0);
+    assert(A.columns() > 0);
+    assert(A.rank() == 2);
+
+    integer m = A.rows();
+    integer n = A.columns();
+    integer k = std::min(m, n);
+    integer r = (max_rank == 0 || (integer)max_rank > k)? k : max_rank;
+    integer lwork, ldu, ldv, info;
+    RTensor output(k);
+    typedef typename lapack_type<elt_t>::type lapack_t;
+    lapack_t *work, *u, *v, foo;
+    double *rwork, *s = tensor_pointer(output), rfoo;
+    integer *iwork, ifoo;
+
+#ifdef TENSOR_USE_ACML
+    algorithm = SVD_GESVD;
+#endif
+    if (algorithm == SVD_GESVDX && (r == k || (!economic && (U || VT))))
+      algorithm = SVD_GESDD;
+
+    if (algorithm == SVD_GESVDX) {
+      char jobu = U? 'V' : 'N', jobv = VT? 'V' : 'N';
+      if (U) {
+        *U = Tensor<elt_t>(m, r);
+        u = tensor_pointer(*U);
+      } else {
+        u = &foo;
+      }
+      if (VT) {
+        *VT = Tensor<elt_t>(r, n);
+        v = tensor_pointer(*VT);
+      } else {
+        v = &foo;
+      }
+      ldu = m;
+      ldv = r;
+      integer ns;
+      LapackWorkspaceKey key('X', jobu, jobv, m, n, r);
+      LapackWorkspace sizes;
+      if (!lapack_cached_workspace(key, &sizes)) {
+        lwork = -1;
+        svd_gesvdx(jobu, jobv, m, n, tensor_pointer(A), r, &ns, s, u, ldu,
+                   v, ldv, &foo, lwork, &rfoo, &ifoo, &info);
+        sizes.lwork = lapack_lwork(foo);
+        lapack_store_workspace(key, sizes);
+      }
+      lwork = sizes.lwork;
+      work = lapack_work<lapack_t>(buffers, lwork);
+      rwork = lapack_rwork(buffers, lapack_rwork_size<elt_t>(17 * k * k));
+      iwork = lapack_iwork(buffers, 12 * k);
+      svd_gesvdx(jobu, jobv, m, n, tensor_pointer(A), r, &ns, s, u, ldu,
+                 v, ldv, work, lwork, rwork, iwork, &info);
+      lapack_release(buffers, work);
+      lapack_release(buffers, rwork);
+      lapack_release(buffers, iwork);
+      if (info) {
+        std::cerr << "In svd(), gesvdx failed to converge (info = " << info
+                  << ")\n";
+        abort();
+      }
+      return output(range(0, ns - 1));
+    }
+
+    Tensor<elt_t> copy;
+    if (algorithm == SVD_GESDD) {
+      /* gesdd computes either both sets of vectors or none. */
+      char jobz;
+      Tensor<elt_t> Ubuffer, VTbuffer;
+      if (!U && !VT) {
+        jobz = 'N';
+        u = v = &foo;
+        ldu = ldv = 1;
+      } else {
+        jobz = economic? 'S' : 'A';
+        Tensor<elt_t> *pU = U? U : &Ubuffer, *pVT = VT? VT : &VTbuffer;
+        *pU = Tensor<elt_t>(m, economic? k : m);
+        *pVT = Tensor<elt_t>(economic? k : n, n);
+        u = tensor_pointer(*pU);
+        v = tensor_pointer(*pVT);
+        ldu = m;
+        ldv = economic? k : n;
+      }
+      copy = A;
+      LapackWorkspaceKey key('D', jobz, jobz, m, n, k);
+      LapackWorkspace sizes;
+      if (!lapack_cached_workspace(key, &sizes)) {
+        lwork = -1;
+        svd_gesdd(jobz, m, n, tensor_pointer(A), s, u, ldu, v, ldv, &foo,
+                  lwork, &rfoo, &ifoo, &info);
+        sizes.lwork = lapack_lwork(foo);
+        lapack_store_workspace(key, sizes);
+      }
+      lwork = sizes.lwork;
+      integer mx = std::max(m, n);
+      integer lrwork = (jobz == 'N')? 7 * k :
+        std::max(5 * k * k + 5 * k, 2 * mx * k + 2 * k * k + k);
+      work = lapack_work<lapack_t>(buffers, lwork);
+      rwork = lapack_rwork(buffers, lapack_rwork_size<elt_t>(lrwork));
+      iwork = lapack_iwork(buffers, 8 * k);
+      svd_gesdd(jobz, m, n, tensor_pointer(A), s, u, ldu, v, ldv, work,
+                lwork, rwork, iwork, &info);
+      lapack_release(buffers, work);
+      lapack_release(buffers, rwork);
+      lapack_release(buffers, iwork);
+      if (info == 0)
+        return output;
+      A = copy;
+    }
+
+    char jobu, jobv;
+    if (U) {
+      *U = Tensor<elt_t>(m, economic? k : m);
+      u = tensor_pointer(*U);
+      jobu = economic? 'S' : 'A';
+      ldu = m;
+    } else {
+      jobu = 'N';
+      u = &foo;
+      ldu = 1;
+    }
+    if (VT) {
+      *VT = Tensor<elt_t>(economic? k : n, n);
+      v = tensor_pointer(*VT);
+      jobv = economic? 'S' : 'A';
+      ldv = economic? k : n;
+    } else {
+      jobv = 'N';
+      v = &foo;
+      ldv = 1;
+    }
+#ifdef TENSOR_USE_ACML
+    acml_gesvd(jobu, jobv, m, n, tensor_pointer(A), s, u, ldu, v, ldv, &info);
+#else
+    LapackWorkspaceKey key('S', jobu, jobv, m, n, k);
+    LapackWorkspace sizes;
+    if (!lapack_cached_workspace(key, &sizes)) {
+      lwork = -1;
+      svd_gesvd(jobu, jobv, m, n, tensor_pointer(A), s, u, ldu, v, ldv, &foo,
+                lwork, &rfoo, &info);
+      sizes.lwork = lapack_lwork(foo);
+      lapack_store_workspace(key, sizes);
+    }
+    lwork = sizes.lwork;
+    work = lapack_work<lapack_t>(buffers, lwork);
+    rwork = lapack_rwork(buffers, lapack_rwork_size<elt_t>(5 * k));
+    svd_gesvd(jobu, jobv, m, n, tensor_pointer(A), s, u, ldu, v, ldv, work,
+              lwork, rwork, &info);
+    lapack_release(buffers, work);
+    lapack_release(buffers, rwork);
+#endif
+    return output;
+  }
+
+  /* Number of singular values, out of the decreasing list 's', that are
+   * kept when truncating to 'max_rank' and relative tolerance 'tol'. At
+   * least one value is always kept. */
+  static tensor::index
+  svd_truncation(const RTensor &s, tensor::index max_rank, double tol)
+  {
+    tensor::index r = s.size();
+    if (max_rank && max_rank < r)
+      r = max_rank;
+    if (r && tol > 0) {
+      double cut = tol * s[0];
+      tensor::index i = 1;
+      while (i < r && s[i] > cut)
+        i++;
+      r = i;
+    }
+    return r;
+  }
+
+  template<typename elt_t>
+  static RTensor
+  svd_truncated(Tensor<elt_t> &A, tensor::index max_rank, double tol,
+                Tensor<elt_t> *U, Tensor<elt_t> *VT)
+  {
+    RTensor s = svd_driver(A, U, VT, true, max_rank, svd_algorithm);
+    tensor::index r = svd_truncation(s, max_rank, tol);
+    if (r < s.size()) {
+      s = s(range(0, r - 1));
+      if (U)
+        *U = (*U)(range(), range(0, r - 1));
+      if (VT)
+        *VT = (*VT)(range(0, r - 1), range());
+    }
+    return s;
+  }
+
+} // namespace linalg
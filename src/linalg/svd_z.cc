@@ -17,14 +17,10 @@
     51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
 */
 
-#include <tensor/tensor.h>
-#include <tensor/tensor_lapack.h>
-#include <tensor/linalg.h>
+#include "svd.hpp"
 
 namespace linalg {
 
-  using namespace lapack;
-
   /**Singular value decomposition of a complex matrix.
 
      The singular value decomposition of a matrix A, consists in finding two
@@ -38,6 +34,8 @@ namespace linalg {
      \c MxM, V is \c NxN and the vector S will have \c min(M,N) elements. However
      if flag \c economic is different from zero, then we get smaller matrices,
      U being \c MxR, V being \c RxN and S will have \c R=min(M,N) elements.
+
+     The LAPACK routine is selected with \ref svd_algorithm.
      
      \ingroup Linalg
   */
@@ -45,62 +43,30 @@ namespace linalg {
   svd(CTensor A, CTensor *U, CTensor *VT, bool economic)
   {
     /*
-    if (accurate_svd) {
+      if (accurate_svd) {
       return block_svd(A, U, VT, economic);
-    }
+      }
     */
-    assert(A.rows() > 0);
-    assert(A.columns() > 0);
-    assert(A.rank() == 2);
-
-    blas::integer m = A.rows();
-    blas::integer n = A.columns();
-    blas::integer k = std::min(m, n);
-    blas::integer lwork, ldu, lda, ldv, info;
-    RTensor output(k);
-    cdouble *work, *u, *v, *a = tensor_pointer(A), foo;
-    double *rwork, *s = tensor_pointer(output);
-    char jobv[1], jobu[1];
-    
-    if (U) {
-      *U = CTensor(m, economic? k : m);
-      u = tensor_pointer(*U);
-      jobu[0] = economic? 'S' : 'A';
-      ldu = m;
-    } else {
-      jobu[0] = 'N';
-      u = &foo;
-      ldu = 1;
-    }
-    if (VT) {
-      (*VT) = CTensor(economic? k : n, n);
-      v = tensor_pointer(*VT);
-      jobv[0] = economic? 'S' : 'A';
-      ldv = economic? k : n;
-    } else {
-	jobv[0] = 'N';
-	v = &foo;
-	ldv = 1;
-    }
-    lda = m;
-#ifdef TENSOR_USE_ACML
-    zgesvd(*jobu, *jobv, m, n, a, m, s, u, ldu, v, ldv, &info);
-#else
-    lwork = -1;
-    work = &foo;
-    rwork = (double *)&foo;
-    F77NAME(zgesvd)(jobu, jobv, &m, &n, a, &m, s, u, &ldu, v, &ldv,
-		    work, &lwork, rwork, &info);
-    lwork = lapack::real(work[0]);
-    work = new cdouble[lwork];
-    rwork = new double[5 * k];
-    F77NAME(zgesvd)(jobu, jobv, &m, &n, a, &m, s, u, &ldu, v, &ldv,
-		    work, &lwork, rwork, &info);
-    delete[] work;
-    delete[] rwork;
-#endif
-    return output;
+    return svd_driver(A, U, VT, economic, 0, svd_algorithm);
   }
 
+  /**Truncated singular value decomposition of a complex matrix.
+
+     This computes the economic decomposition \f$A \simeq U S V\f$ and keeps
+     only the largest singular values, at most \a max_rank of them (0 means no
+     limit), dropping those that are not larger than \a tol times the first
+     one. At least one singular value is kept. U and VT only contain the
+     vectors associated to the values that are returned.
+
+     With \ref svd_algorithm set to SVD_GESVDX and \a max_rank smaller than
+     \c min(M,N), only the requested singular triplets are computed.
+
+     \ingroup Linalg
+  */
+  RTensor
+  svd(CTensor A, tensor::index max_rank, double tol, CTensor *U, CTensor *VT)
+  {
+    return svd_truncated(A, max_rank, tol, U, VT);
+  }
 
 } // namespace linalg
@@ -0,0 +1,47 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#ifndef TENSOR_MMULT_OUTPUT_H
+#define TENSOR_MMULT_OUTPUT_H
+
+//////////////////////////////////////////////////////////////////////
+// OUTPUT OF PRODUCTS WITH SPARSE MATRICES
+//
+
+/* Prepare 'output' to receive the product with the given dimensions and
+ * return a pointer to its zeroed storage. The storage of 'output' is reused
+ * when it has the right dimensions and does not coincide with that of the
+ * tensor argument 'input'. */
+template<typename elt_t>
+static elt_t *
+prepare_mmult_output(Tensor<elt_t> &output, const Indices &dims,
+		     const Tensor<elt_t> &input)
+{
+    if (!all_equal(output.dimensions(), dims))
+	output = Tensor<elt_t>(dims);
+    elt_t *dest = output.begin();
+    if (dest == input.begin()) {
+	output = Tensor<elt_t>(dims);
+	dest = output.begin();
+    }
+    std::fill(dest, dest + output.size(), number_zero<elt_t>());
+    return dest;
+}
+
+#endif /* !TENSOR_MMULT_OUTPUT_H */
@@ -20,6 +20,8 @@
 #ifndef TENSOR_MMULT_SPARSE_TENSOR_H
 #define TENSOR_MMULT_SPARSE_TENSOR_H
 
+#include "mmult_output.h"
+
 //////////////////////////////////////////////////////////////////////
 // RAW ROUTINES FOR THE SPARSE-TENSOR PRODUCT
 //
@@ -78,8 +80,8 @@ mult_sp_t(elt_t *dest,
 //
 
 template<typename elt_t>
-static inline const Tensor<elt_t>
-do_mmult(const Sparse<elt_t> &m1, const Tensor<elt_t> &m2)
+static inline void
+do_mmult_into(Tensor<elt_t> &output, const Sparse<elt_t> &m1, const Tensor<elt_t> &m2)
 {
     Indices dims(m2.rank());
     index l_len = 1;
@@ -97,14 +99,21 @@ do_mmult(const Sparse<elt_t> &m1, const Tensor<elt_t> &m2)
 	abort();
     }
 
-    Tensor<elt_t> output = Tensor<elt_t>::zeros(dims);
+    elt_t *dest = prepare_mmult_output(output, dims, m2);
 
-    mult_sp_t<elt_t>(output.begin(),
+    mult_sp_t<elt_t>(dest,
                      m1.priv_row_start().begin(), m1.priv_column().begin(),
                      m1.priv_data().begin(),
                      m2.begin(),
                      i_len, j_len, 1, l_len);
+}
 
+template<typename elt_t>
+static inline const Tensor<elt_t>
+do_mmult(const Sparse<elt_t> &m1, const Tensor<elt_t> &m2)
+{
+    Tensor<elt_t> output;
+    do_mmult_into(output, m1, m2);
     return output;
 }
 
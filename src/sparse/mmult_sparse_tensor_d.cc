@@ -30,4 +30,13 @@ mmult(const Sparse<double> &m1, const Tensor<double> &m2)
   return do_mmult(m1, m2);
 }
 
+
+/** Matrix multiplication that writes its output into an existing tensor,
+    reusing its memory when it has the right dimensions. */
+void
+mmult_into(Tensor<double> &output, const Sparse<double> &m1, const Tensor<double> &m2)
+{
+  do_mmult_into(output, m1, m2);
+}
+
 }
@@ -0,0 +1,162 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#ifndef TENSOR_MMULT_SYM_SPARSE_H
+#define TENSOR_MMULT_SYM_SPARSE_H
+
+#include "mmult_output.h"
+
+//////////////////////////////////////////////////////////////////////
+// RAW ROUTINES FOR THE PRODUCTS WITH SYMMETRIC SPARSE MATRICES
+//
+
+template<typename elt_t>
+static void
+mult_symsp_t(elt_t *dest,
+	     const index *row_start, const index *column, const elt_t *matrix,
+	     const elt_t *vector, index n, index l_len)
+{
+    // dest(i,l) = matrix(i,j) vector(j,l), where only the upper triangle
+    // of the matrix is stored. Each element matrix(i,j) contributes both to
+    // row i and, through its conjugate, to row j.
+    for (; l_len; l_len--, vector += n, dest += n) {
+	const elt_t *m = matrix;
+	const index *c = column;
+	for (index i = 0; i < n; i++) {
+	    elt_t vi = vector[i];
+	    elt_t accum = dest[i];
+	    for (index j = row_start[i+1] - row_start[i]; j; j--, m++, c++) {
+		index col = *c;
+		if (col == i) {
+		    accum += *m * vi;
+		} else {
+		    accum += *m * vector[col];
+		    dest[col] += ::tensor::conj(*m) * vi;
+		}
+	    }
+	    dest[i] = accum;
+	}
+    }
+}
+
+template<typename elt_t>
+static void
+mult_t_symsp(elt_t *dest, const elt_t *vector,
+	     const index *row_start, const index *column, const elt_t *matrix,
+	     index i_len, index n)
+{
+    // dest(i,l) = vector(i,j) matrix(j,l), with the same storage as above.
+    for (index j = 0; j < n; j++) {
+	const elt_t *vj = vector + j * i_len;
+	elt_t *dj = dest + j * i_len;
+	for (index x = row_start[j]; x < row_start[j+1]; x++) {
+	    index l = column[x];
+	    elt_t m = matrix[x];
+	    elt_t *dl = dest + l * i_len;
+	    for (index i = 0; i < i_len; i++) {
+		dl[i] += vj[i] * m;
+	    }
+	    if (l != j) {
+		const elt_t *vl = vector + l * i_len;
+		m = ::tensor::conj(m);
+		for (index i = 0; i < i_len; i++) {
+		    dj[i] += vl[i] * m;
+		}
+	    }
+	}
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+// HIGHER LEVEL INTERFACE
+//
+
+template<typename elt_t>
+static inline void
+do_mmult_into(Tensor<elt_t> &output, const SymSparse<elt_t> &m1, const Tensor<elt_t> &m2)
+{
+    Indices dims(m2.rank());
+    index l_len = 1;
+    for (index k = 1, N = m2.rank(); k < N; k++) {
+	dims.at(k) = m2.dimension(k);
+	l_len *= dims[k];
+    }
+    index n = dims.at(0) = m1.rows();
+
+    if (m2.dimension(0) != n) {
+	std::cerr <<
+	  "In mmult(S,T), the first index of tensor T does not match the number of\n"
+	  "columns in sparse matrix S.";
+	abort();
+    }
+
+    elt_t *dest = prepare_mmult_output(output, dims, m2);
+
+    mult_symsp_t<elt_t>(dest,
+                        m1.priv_row_start().begin(), m1.priv_column().begin(),
+                        m1.priv_data().begin(),
+                        m2.begin(), n, l_len);
+}
+
+template<typename elt_t>
+static inline void
+do_mmult_into(Tensor<elt_t> &output, const Tensor<elt_t> &m1, const SymSparse<elt_t> &m2)
+{
+    index N = m1.rank();
+    index i_len = 1;
+    Indices dims(N);
+    for (index k = 0; k < N-1; k++) {
+	dims.at(k) = m1.dimension(k);
+	i_len *= dims[k];
+    }
+    index n = dims.at(N-1) = m2.rows();
+
+    if (m1.dimension(N-1) != n) {
+	std::cerr <<
+	  "In mmult(T,S), the last index of tensor T does not match the number of rows\n"
+	  "in sparse matrix S.";
+	abort();
+    }
+
+    elt_t *dest = prepare_mmult_output(output, dims, m1);
+
+    mult_t_symsp<elt_t>(dest, m1.begin(),
+                        m2.priv_row_start().begin(), m2.priv_column().begin(),
+                        m2.priv_data().begin(), i_len, n);
+}
+
+template<typename elt_t>
+static inline const Tensor<elt_t>
+do_mmult(const SymSparse<elt_t> &m1, const Tensor<elt_t> &m2)
+{
+    Tensor<elt_t> output;
+    do_mmult_into(output, m1, m2);
+    return output;
+}
+
+template<typename elt_t>
+static inline const Tensor<elt_t>
+do_mmult(const Tensor<elt_t> &m1, const SymSparse<elt_t> &m2)
+{
+    Tensor<elt_t> output;
+    do_mmult_into(output, m1, m2);
+    return output;
+}
+
+#endif /* !TENSOR_MMULT_SYM_SPARSE_H */
@@ -20,6 +20,8 @@
 #ifndef TENSOR_MMULT_TENSOR_SPARSE_H
 #define TENSOR_MMULT_TENSOR_SPARSE_H
 
+#include "mmult_output.h"
+
 //////////////////////////////////////////////////////////////////////
 // RAW ROUTINE FOR THE TENSOR-SPARSE PRODUCT
 //
@@ -53,8 +55,8 @@ mult_t_sp(elt_t *dest,
 //
 
 template<typename elt_t>
-static inline const Tensor<elt_t>
-do_mmult(const Tensor<elt_t> &m1, const Sparse<elt_t> &m2)
+static inline void
+do_mmult_into(Tensor<elt_t> &output, const Tensor<elt_t> &m1, const Sparse<elt_t> &m2)
 {
     index N = m1.rank();
     index i_len = 1;
@@ -63,7 +65,7 @@ do_mmult(const Tensor<elt_t> &m1, const Sparse<elt_t> &m2)
 	dims.at(k) = m1.dimension(k);
 	i_len *= dims[k];
     }
-    index j_len = m1.dimension(-1);
+    index j_len = m1.dimension(N-1);
     index l_len = dims.at(N-1) = m2.columns();
 
     if (j_len != m2.rows()) {
@@ -73,14 +75,21 @@ do_mmult(const Tensor<elt_t> &m1, const Sparse<elt_t> &m2)
 	abort();
     }
 
-    Tensor<elt_t> output = Tensor<elt_t>::zeros(dims);
+    elt_t *dest = prepare_mmult_output(output, dims, m1);
 
-    mult_t_sp<elt_t>(output.begin(),
+    mult_t_sp<elt_t>(dest,
                      m1.begin(),
                      m2.priv_row_start().begin(),
                      m2.priv_column().begin(), m2.priv_data().begin(),
                      i_len, j_len, 1, l_len);
+}
 
+template<typename elt_t>
+static inline const Tensor<elt_t>
+do_mmult(const Tensor<elt_t> &m1, const Sparse<elt_t> &m2)
+{
+    Tensor<elt_t> output;
+    do_mmult_into(output, m1, m2);
     return output;
 }
 
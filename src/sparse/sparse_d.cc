@@ -28,5 +28,6 @@ namespace tensor {
   // all required code.
   //
   template class Sparse<double>;
+  template class SparseBuilder<double>;
 
 } // namespace tensor
@@ -17,50 +17,149 @@
     51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
 */
 
+#include <vector>
+
 namespace tensor {
 
   //////////////////////////////////////////////////////////////////////
   // KRONECKER PRODUCT OF MATRICES
   //
 
+  /* Products with more nonzero elements than this are built in parallel. */
+  static const index KRON_PARALLEL_SIZE = 1 << 16;
+
+  /* Kronecker product of several matrices, in Matlab order:
+   *   C([r0,r1,...],[c0,c1,...]) = F0(r0,c0) F1(r1,c1) ...
+   * where the last factor runs fastest. The row_start of the output is
+   * computed in advance, so that every output row can be filled in
+   * independently of the others. */
   template<typename elt_t>
-  static const Sparse<elt_t> do_kron(const Sparse<elt_t> &s2, const Sparse<elt_t> &s1)
+  static const Sparse<elt_t>
+  do_kron(const std::vector<const Sparse<elt_t> *> &factors)
   {
-    index rows1 = s1.rows();
-    index cols1 = s1.columns();
-    index rows2 = s2.rows();
-    index cols2 = s2.columns();
-    index number_nonzero = s1.length() * s2.length();
-    index total_rows = rows1 * rows2;
-    index total_cols = cols1 * cols2;
+    index m = factors.size();
+    assert(m > 0);
+    std::vector<const index *> f_row_start(m), f_column(m);
+    std::vector<const elt_t *> f_data(m);
+    std::vector<index> f_rows(m), f_cols(m);
+    index total_rows = 1, total_cols = 1, number_nonzero = 1;
+    for (index n = 0; n < m; n++) {
+      const Sparse<elt_t> &f = *factors[n];
+      f_row_start[n] = f.priv_row_start().begin();
+      f_column[n] = f.priv_column().begin();
+      f_data[n] = f.priv_data().begin();
+      total_rows *= f_rows[n] = f.rows();
+      total_cols *= f_cols[n] = f.columns();
+      number_nonzero *= f.length();
+    }
 
     if (number_nonzero == 0)
       return Sparse<elt_t>(total_rows, total_cols);
+    if (m == 1)
+      return *factors[0];
 
-    Tensor<elt_t> output_data(number_nonzero);
-    Indices output_column(number_nonzero);
-    Indices output_row_start(total_rows+1);
-    Indices output_dims(igen << total_rows << total_cols);
+    /* row_start of the product K = Fn x K' of the factors n..m-1, built
+     * from the right. Row [l,k] of K starts after all elements of the rows
+     * of Fn before 'l', multiplied with all of K', plus the elements of row
+     * 'l' of Fn multiplied with the rows of K' before 'k'. */
+    std::vector<index> suffix(f_row_start[m-1], f_row_start[m-1] + f_rows[m-1] + 1);
+    std::vector<index> aux;
+    index suffix_rows = f_rows[m-1];
+    index suffix_nonzero = suffix[suffix_rows];
+    for (index n = m-2; n >= 0; n--) {
+      const index *rs = f_row_start[n];
+      aux.resize(f_rows[n] * suffix_rows + 1);
+      for (index l = 0, o = 0; l < f_rows[n]; l++) {
+        index before = rs[l] * suffix_nonzero;
+        index length = rs[l+1] - rs[l];
+        for (index k = 0; k < suffix_rows; k++)
+          aux[o++] = before + length * suffix[k];
+      }
+      suffix_rows *= f_rows[n];
+      suffix_nonzero *= rs[f_rows[n]];
+      aux[suffix_rows] = suffix_nonzero;
+      suffix.swap(aux);
+    }
 
-    typename Tensor<elt_t>::iterator out_data = output_data.begin();
-    typename Indices::iterator out_column = output_column.begin();
-    typename Indices::iterator out_begin = out_column;
-    typename Indices::iterator out_row_start = output_row_start.begin();
+    Indices output_row_start(total_rows+1);
+    Indices output_column(number_nonzero);
+    Tensor<elt_t> output_data(number_nonzero);
+    std::copy(suffix.begin(), suffix.end(), output_row_start.begin());
+    const index *row_start = output_row_start.begin();
+    index *column = output_column.begin();
+    elt_t *data = output_data.begin();
+    bool parallel = number_nonzero > KRON_PARALLEL_SIZE;
 
-    // C([i,j],[k,l]) = s1(i,k) s2(j,l)
-    *(out_row_start++) = 0;
-    for (index l = 0; l < rows2; l++) {
-      for (index k = 0; k < rows1; k++) {
-	for (index j = s2.priv_row_start()[l]; j < s2.priv_row_start()[l+1]; j++) {
-	  for (index i = s1.priv_row_start()[k]; i < s1.priv_row_start()[k+1]; i++) {
-	    *(out_data++) = s1.priv_data()[i] * s2.priv_data()[j];
-	    *(out_column++) = s1.priv_column()[i] + cols1 * s2.priv_column()[j];
-	  }
-	}
-	*(out_row_start++) = out_column - out_begin;
+#ifdef _OPENMP
+#pragma omp parallel if(parallel)
+#endif
+    {
+      std::vector<index> begin(m), pos(m), end(m), base_col(m);
+      std::vector<elt_t> base_val(m);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+      for (index r = 0; r < total_rows; r++) {
+        if (row_start[r] == row_start[r+1])
+          continue;
+        /* Rows of each factor that make up this row. */
+        for (index n = m-1, aux = r; n >= 0; n--) {
+          index fr = aux % f_rows[n];
+          aux /= f_rows[n];
+          pos[n] = begin[n] = f_row_start[n][fr];
+          end[n] = f_row_start[n][fr+1];
+        }
+        index *out_column = column + row_start[r];
+        elt_t *out_data = data + row_start[r];
+        const index *last_column = f_column[m-1] + begin[m-1];
+        const elt_t *last_data = f_data[m-1] + begin[m-1];
+        index last_length = end[m-1] - begin[m-1];
+        index last_cols = f_cols[m-1];
+        /* Iterate over all combinations of elements in the rows of the
+         * first m-1 factors, in increasing column order, and multiply each
+         * of them with the row of the last factor. */
+        for (index n = 0; n >= 0; ) {
+          for (; n < m-1; n++) {
+            index c = f_column[n][pos[n]];
+            elt_t v = f_data[n][pos[n]];
+            base_col[n] = n? (base_col[n-1] * f_cols[n] + c) : c;
+            base_val[n] = n? (base_val[n-1] * v) : v;
+          }
+          index c0 = base_col[m-2] * last_cols;
+          elt_t v0 = base_val[m-2];
+          for (index i = 0; i < last_length; i++) {
+            *(out_column++) = c0 + last_column[i];
+            *(out_data++) = v0 * last_data[i];
+          }
+          for (n = m-2; n >= 0 && ++pos[n] == end[n]; n--)
+            pos[n] = begin[n];
+        }
       }
     }
-    return Sparse<elt_t>(output_dims, output_row_start, output_column, output_data);
+    return Sparse<elt_t>(igen << total_rows << total_cols, output_row_start,
+                         output_column, output_data);
+  }
+
+  template<typename elt_t>
+  static const Sparse<elt_t> do_kron(const Sparse<elt_t> &s1, const Sparse<elt_t> &s2)
+  {
+    std::vector<const Sparse<elt_t> *> factors(2);
+    factors[0] = &s1;
+    factors[1] = &s2;
+    return do_kron(factors);
+  }
+
+  template<typename elt_t>
+  static const Sparse<elt_t> do_kron(const std::vector<Sparse<elt_t> > &s)
+  {
+    if (s.empty()) {
+      std::cerr << "In kron(factors), the list of factors is empty.\n";
+      abort();
+    }
+    std::vector<const Sparse<elt_t> *> factors(s.size());
+    for (size_t n = 0; n < s.size(); n++)
+      factors[n] = &s[n];
+    return do_kron(factors);
   }
 
 } // namespace tensor
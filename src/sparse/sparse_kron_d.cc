@@ -28,6 +28,20 @@ namespace tensor {
     return do_kron(s1, s2);
   }
 
+  const Sparse<double> kron(const Sparse<double> &s1, const Sparse<double> &s2, const Sparse<double> &s3)
+  {
+    std::vector<const Sparse<double> *> factors(3);
+    factors[0] = &s1;
+    factors[1] = &s2;
+    factors[2] = &s3;
+    return do_kron(factors);
+  }
+
+  const Sparse<double> kron(const std::vector<Sparse<double> > &factors)
+  {
+    return do_kron(factors);
+  }
+
   const Sparse<double> kron2(const Sparse<double> &s1, const Sparse<double> &s2)
   {
     return kron(s2, s1);
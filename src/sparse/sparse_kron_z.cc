@@ -28,6 +28,20 @@ namespace tensor {
     return do_kron(s1, s2);
   }
 
+  const Sparse<cdouble> kron(const Sparse<cdouble> &s1, const Sparse<cdouble> &s2, const Sparse<cdouble> &s3)
+  {
+    std::vector<const Sparse<cdouble> *> factors(3);
+    factors[0] = &s1;
+    factors[1] = &s2;
+    factors[2] = &s3;
+    return do_kron(factors);
+  }
+
+  const Sparse<cdouble> kron(const std::vector<Sparse<cdouble> > &factors)
+  {
+    return do_kron(factors);
+  }
+
   const Sparse<cdouble> kron2(const Sparse<cdouble> &s1, const Sparse<cdouble> &s2)
   {
     return kron(s2, s1);
@@ -0,0 +1,268 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+#include <tensor/sparse.h>
+
+namespace tensor {
+
+  template<typename elt_t>
+  static void
+  check_sparse_sum_dimensions(const Sparse<elt_t> &a, const Sparse<elt_t> &b,
+                              const char *where)
+  {
+    if (a.rows() != b.rows() || a.columns() != b.columns()) {
+      std::cerr << "In " << where << ", sparse matrices have different "
+                << "dimensions: " << a.rows() << 'x' << a.columns()
+                << " and " << b.rows() << 'x' << b.columns() << '\n';
+      abort();
+    }
+  }
+
+  /* Remove the elements that have become zero after an in-place update. */
+  template<typename elt_t>
+  static void
+  sparse_drop_zeros(Sparse<elt_t> &H)
+  {
+    index rows = H.rows();
+    index *row_start = H.row_start_.begin();
+    index *column = H.column_.begin();
+    elt_t *data = H.data_.begin();
+    index k = 0, j = 0;
+    for (index r = 0; r < rows; r++) {
+      for (; j < row_start[r+1]; j++) {
+        if (!(data[j] == number_zero<elt_t>())) {
+          column[k] = column[j];
+          data[k] = data[j];
+          k++;
+        }
+      }
+      row_start[r+1] = k;
+    }
+    Indices new_column(k);
+    Tensor<elt_t> new_data(k);
+    std::copy(column, column + k, new_column.begin());
+    std::copy(data, data + k, new_data.begin());
+    H.column_ = new_column;
+    H.data_ = new_data;
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // H += alpha * T
+  //
+
+  template<typename elt_t>
+  static void
+  do_sparse_axpy(Sparse<elt_t> &H, elt_t alpha, const Sparse<elt_t> &T)
+  {
+    check_sparse_sum_dimensions(H, T, "sparse_axpy_inplace(H,alpha,T)");
+    if (T.length() == 0 || alpha == number_zero<elt_t>())
+      return;
+
+    index rows = H.rows();
+    const index *h_row_start = H.priv_row_start().begin();
+    const index *h_column = H.priv_column().begin();
+    const index *t_row_start = T.priv_row_start().begin();
+    const index *t_column = T.priv_column().begin();
+    const elt_t *t_data = T.priv_data().begin();
+
+    /* First pass: size of the union of both sparsity patterns. */
+    index nonzero = 0;
+    for (index r = 0; r < rows; r++) {
+      index i = h_row_start[r], i_end = h_row_start[r+1];
+      index j = t_row_start[r], j_end = t_row_start[r+1];
+      while (i < i_end && j < j_end) {
+        index hc = h_column[i], tc = t_column[j];
+        if (hc <= tc) i++;
+        if (tc <= hc) j++;
+        nonzero++;
+      }
+      nonzero += (i_end - i) + (j_end - j);
+    }
+
+    bool zeros = false;
+    if (nonzero == H.length()) {
+      /* The pattern of T is contained in that of H: we only update
+       * the values of H, without allocating new memory. */
+      elt_t *h_data = H.data_.begin();
+      for (index r = 0; r < rows; r++) {
+        index i = h_row_start[r];
+        for (index j = t_row_start[r]; j < t_row_start[r+1]; j++) {
+          while (h_column[i] < t_column[j]) i++;
+          elt_t &v = h_data[i];
+          v += alpha * t_data[j];
+          if (v == number_zero<elt_t>()) zeros = true;
+        }
+      }
+    } else {
+      /* Otherwise we merge both matrices into exactly sized storage. */
+      const elt_t *h_data = H.priv_data().begin();
+      Indices row_start(rows + 1);
+      Indices column(nonzero);
+      Tensor<elt_t> data(nonzero);
+      index *out_row_start = row_start.begin();
+      index *out_column = column.begin();
+      elt_t *out_data = data.begin();
+      index k = out_row_start[0] = 0;
+      for (index r = 0; r < rows; r++) {
+        index i = h_row_start[r], i_end = h_row_start[r+1];
+        index j = t_row_start[r], j_end = t_row_start[r+1];
+        while (i < i_end || j < j_end) {
+          index hc = (i < i_end)? h_column[i] : H.columns();
+          index tc = (j < j_end)? t_column[j] : H.columns();
+          elt_t v = number_zero<elt_t>();
+          if (hc <= tc) v += h_data[i++];
+          if (tc <= hc) v += alpha * t_data[j++];
+          if (v == number_zero<elt_t>()) zeros = true;
+          out_column[k] = std::min(hc, tc);
+          out_data[k] = v;
+          k++;
+        }
+        out_row_start[r+1] = k;
+      }
+      H.row_start_ = row_start;
+      H.column_ = column;
+      H.data_ = data;
+    }
+    if (zeros)
+      sparse_drop_zeros(H);
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // K-WAY SUM OF SPARSE MATRICES
+  //
+
+  /* Next element of one of the terms: the heap gives the smallest (row,
+   * column) pair first, and the term only breaks ties. */
+  struct sparse_sum_cursor {
+    index row, column, term;
+    sparse_sum_cursor(index r, index c, index n) : row(r), column(c), term(n) {}
+    bool operator>(const sparse_sum_cursor &other) const {
+      if (row != other.row) return row > other.row;
+      if (column != other.column) return column > other.column;
+      return term > other.term;
+    }
+  };
+
+  /* Row of the j-th element of a matrix, knowing it is not before 'row'.
+   * Empty rows are skipped with a binary search, so that the sum does not
+   * visit every row of every term. */
+  static inline index
+  sparse_sum_row(const index *row_start, index rows, index row, index j)
+  {
+    if (j < row_start[row+1])
+      return row;
+    return std::upper_bound(row_start + row + 1, row_start + rows + 1, j)
+      - row_start - 1;
+  }
+
+  template<typename elt_t>
+  static const Sparse<elt_t>
+  do_sparse_sum(const std::vector<Sparse<elt_t> > &terms, const elt_t *weights)
+  {
+    index N = terms.size();
+    if (N == 0)
+      return Sparse<elt_t>();
+
+    index rows = terms[0].rows();
+    index cols = terms[0].columns();
+    index total = 0;
+    std::vector<const index *> row_start(N), column(N);
+    std::vector<const elt_t *> data(N);
+    for (index n = 0; n < N; n++) {
+      const Sparse<elt_t> &t = terms[n];
+      check_sparse_sum_dimensions(terms[0], t, "sparse_sum(terms)");
+      row_start[n] = t.priv_row_start().begin();
+      column[n] = t.priv_column().begin();
+      data[n] = t.priv_data().begin();
+      total += t.length();
+    }
+
+    std::vector<index> out_column;
+    std::vector<elt_t> out_data;
+    out_column.reserve(total);
+    out_data.reserve(total);
+    Indices out_row_start(rows + 1);
+    out_row_start.at(0) = 0;
+
+    /* One cursor per nonempty term, over the whole matrix, so that the
+     * cost is O(nnz log N) no matter how many rows are empty. */
+    std::greater<sparse_sum_cursor> order;
+    std::vector<sparse_sum_cursor> heap;
+    std::vector<index> pos(N, 0);
+    heap.reserve(N);
+    for (index n = 0; n < N; n++) {
+      if (row_start[n][rows] > 0) {
+        index r = sparse_sum_row(row_start[n], rows, 0, 0);
+        heap.push_back(sparse_sum_cursor(r, column[n][0], n));
+      }
+    }
+    std::make_heap(heap.begin(), heap.end(), order);
+    index last_row = 0;
+    while (!heap.empty()) {
+      index r = heap.front().row;
+      index c = heap.front().column;
+      elt_t v = number_zero<elt_t>();
+      do {
+        index n = heap.front().term;
+        std::pop_heap(heap.begin(), heap.end(), order);
+        heap.pop_back();
+        index j = pos[n]++;
+        v += weights? weights[n] * data[n][j] : data[n][j];
+        if (++j < row_start[n][rows]) {
+          index next_row = sparse_sum_row(row_start[n], rows, r, j);
+          heap.push_back(sparse_sum_cursor(next_row, column[n][j], n));
+          std::push_heap(heap.begin(), heap.end(), order);
+        }
+      } while (!heap.empty() && heap.front().row == r &&
+               heap.front().column == c);
+      if (!(v == number_zero<elt_t>())) {
+        while (last_row < r)
+          out_row_start.at(++last_row) = out_column.size();
+        out_column.push_back(c);
+        out_data.push_back(v);
+      }
+    }
+    while (last_row < rows)
+      out_row_start.at(++last_row) = out_column.size();
+
+    index nonzero = out_column.size();
+    Indices the_column(nonzero);
+    Tensor<elt_t> the_data(nonzero);
+    std::copy(out_column.begin(), out_column.end(), the_column.begin());
+    std::copy(out_data.begin(), out_data.end(), the_data.begin());
+    return Sparse<elt_t>(igen << rows << cols, out_row_start, the_column, the_data);
+  }
+
+  template<typename elt_t>
+  static const Sparse<elt_t>
+  do_sparse_sum(const std::vector<Sparse<elt_t> > &terms,
+                const Tensor<elt_t> &weights)
+  {
+    if (weights.size() != (index)terms.size()) {
+      std::cerr << "In sparse_sum(terms,weights), there are " << terms.size()
+                << " terms but " << weights.size() << " weights\n";
+      abort();
+    }
+    return do_sparse_sum(terms, weights.begin());
+  }
+
+} // namespace tensor
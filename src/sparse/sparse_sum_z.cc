@@ -0,0 +1,40 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <tensor/sparse.h>
+#include "sparse_sum.hpp"
+
+namespace tensor {
+
+  void sparse_axpy_inplace(CSparse &H, cdouble alpha, const CSparse &T)
+  {
+    do_sparse_axpy(H, alpha, T);
+  }
+
+  const CSparse sparse_sum(const std::vector<CSparse> &terms)
+  {
+    return do_sparse_sum(terms, (const cdouble *)0);
+  }
+
+  const CSparse sparse_sum(const std::vector<CSparse> &terms, const CTensor &weights)
+  {
+    return do_sparse_sum(terms, weights);
+  }
+
+} // namespace tensor
@@ -27,5 +27,6 @@ namespace tensor {
   // all required code.
   //
   template class Sparse<cdouble>;
+  template class SparseBuilder<cdouble>;
 
 } // namespace tensor
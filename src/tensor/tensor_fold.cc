@@ -160,4 +160,46 @@ namespace tensor {
     }
   }
 
+  /* Matrix product, mmult(a,b), between a matrix and a vector or another
+   * matrix. The output is written directly into 'c' when it already has the
+   * right dimensions and does not share memory with 'a' or 'b', so that
+   * repeated products do not allocate memory. */
+  template<typename elt_t>
+  void
+  do_mmult_into(Tensor<elt_t> &c, const Tensor<elt_t> &a, const Tensor<elt_t> &b)
+  {
+    const elt_t zero = number_zero<elt_t>();
+    const elt_t one = number_one<elt_t>();
+    if (a.rank() == 2 && (b.rank() == 1 || b.rank() == 2) &&
+        c.rank() == b.rank() && a.columns() == b.dimension(0) &&
+        c.dimension(0) == a.rows() && c.size() && a.columns())
+    {
+      index m_len = (b.rank() == 2)? b.dimension(1) : 1;
+      if (b.rank() == 1 || c.dimension(1) == m_len) {
+        elt_t *pC = c.begin();
+        if (pC != a.begin() && pC != b.begin()) {
+          // C(i_len,m_len) = A(i_len,l_len)*B(l_len,m_len);
+          gemm('N', 'N', a.rows(), m_len, a.columns(), one,
+               a.begin(), a.rows(), b.begin(), a.columns(), zero,
+               pC, a.rows());
+          return;
+        }
+      }
+    }
+    else if (a.rank() == 1 && b.rank() == 2 && c.rank() == 1 &&
+             a.size() == b.rows() && c.size() == b.columns() && c.size() &&
+             a.size())
+    {
+      elt_t *pC = c.begin();
+      if (pC != a.begin() && pC != b.begin()) {
+        // C(m_len) = A(l_len)*B(l_len,m_len);
+        gemm('T', 'N', b.columns(), 1, b.rows(), one,
+             b.begin(), b.rows(), a.begin(), b.rows(), zero,
+             pC, b.columns());
+        return;
+      }
+    }
+    do_fold<elt_t, false>(c, a, -1, b, 0);
+  }
+
 } // namespace tensor
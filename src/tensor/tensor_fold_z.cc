@@ -79,9 +79,12 @@ namespace tensor {
     return fold(m1, -1, m2, 0);
   }
 
+  /**Matrix multiplication, \c c=mmult(m1,m2). When \c c already has the
+     right dimensions and it does not share memory with the arguments, the
+     product is written into its storage. */
   void mmult_into(Tensor<cdouble> &c, const Tensor<cdouble> &m1, const Tensor<cdouble> &m2)
   {
-    fold_into(c, m1, -1, m2, 0);
+    do_mmult_into<cdouble>(c, m1, m2);
   }
 
 } // namespace tensor
@@ -34,4 +34,14 @@ namespace tensor {
   MatrixMap<Matrix>::operator()(const tensor_t &arg) const
   { return transpose_? mmult(arg, m_) : mmult(m_, arg); }
 
+  template<class Matrix>
+  void
+  MatrixMap<Matrix>::apply_into(const tensor_t &arg, tensor_t &output) const
+  {
+    if (transpose_)
+      mmult_into(output, arg, m_);
+    else
+      mmult_into(output, m_, arg);
+  }
+
 } // namespace tensor
@@ -0,0 +1,138 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <vector>
+#include "loops.h"
+#include <gtest/gtest.h>
+#include <tensor/tensor.h>
+#include <tensor/linalg.h>
+
+namespace tensor_test {
+
+  using namespace tensor;
+
+  /*
+   * Batches of 'n' matrices of different sizes, some of them repeated, so
+   * that different threads may hold references to the same data.
+   */
+  template<typename elt_t>
+  std::vector<Tensor<elt_t> > random_batch(int n, bool square) {
+    std::vector<Tensor<elt_t> > A;
+    for (int i = 0; i < n; i++) {
+      int rows = 1 + (7 * i) % 13;
+      int cols = square? rows : 1 + (5 * i) % 11;
+      Tensor<elt_t> M(rows, cols);
+      M.randomize();
+      A.push_back(M);
+      if (i % 4 == 0)
+        A.push_back(M);
+    }
+    return A;
+  }
+
+  template<typename elt_t>
+  void test_svd_batch(int n) {
+    std::vector<Tensor<elt_t> > A = random_batch<elt_t>(n, false);
+    for (int economic = 0; economic < 2; economic++) {
+      std::vector<Tensor<elt_t> > U, VT;
+      std::vector<RTensor> s = linalg::svd_batch(A, &U, &VT, economic);
+      ASSERT_EQ(s.size(), A.size());
+      ASSERT_EQ(U.size(), A.size());
+      ASSERT_EQ(VT.size(), A.size());
+      for (size_t i = 0; i < A.size(); i++) {
+        Tensor<elt_t> U1, VT1;
+        RTensor s1 = linalg::svd(A[i], &U1, &VT1, economic);
+        EXPECT_TRUE(approx_eq(s[i], s1));
+        EXPECT_TRUE(unitaryp(U[i], 1e-10));
+        EXPECT_TRUE(unitaryp(VT[i], 1e-10));
+        EXPECT_TRUE(approx_eq(A[i], mmult(U[i], mmult(economic? diag(s[i]) :
+              diag(s[i], 0, A[i].rows(), A[i].columns()), VT[i])), 1e-12));
+      }
+      std::vector<RTensor> s2 = linalg::svd_batch(A);
+      for (size_t i = 0; i < A.size(); i++)
+        EXPECT_TRUE(approx_eq(s[i], s2[i], 1e-12));
+    }
+  }
+
+  template<typename elt_t>
+  void test_eig_sym_batch(int n) {
+    std::vector<Tensor<elt_t> > A = random_batch<elt_t>(n, true);
+    for (size_t i = 0; i < A.size(); i++)
+      A[i] = A[i] + adjoint(A[i]);
+    std::vector<Tensor<elt_t> > V;
+    std::vector<RTensor> w = linalg::eig_sym_batch(A, &V);
+    ASSERT_EQ(w.size(), A.size());
+    ASSERT_EQ(V.size(), A.size());
+    for (size_t i = 0; i < A.size(); i++) {
+      EXPECT_TRUE(approx_eq(w[i], linalg::eig_sym(A[i]), 1e-12));
+      EXPECT_TRUE(unitaryp(V[i], 1e-10));
+      EXPECT_TRUE(approx_eq(mmult(A[i], V[i]),
+                            mmult(V[i], Tensor<elt_t>(diag(w[i]))), 1e-12));
+    }
+  }
+
+  template<typename elt_t>
+  void test_solve_batch(int n) {
+    std::vector<Tensor<elt_t> > A = random_batch<elt_t>(n, true), B;
+    for (size_t i = 0; i < A.size(); i++) {
+      A[i] = A[i] + (double)A[i].rows() * Tensor<elt_t>::eye(A[i].rows());
+      Tensor<elt_t> b(A[i].rows(), 1 + i % 3);
+      b.randomize();
+      B.push_back(b);
+    }
+    std::vector<Tensor<elt_t> > X = linalg::solve_batch(A, B);
+    ASSERT_EQ(X.size(), A.size());
+    for (size_t i = 0; i < A.size(); i++) {
+      EXPECT_TRUE(approx_eq(X[i], linalg::solve(A[i], B[i])));
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // REAL SPECIALIZATIONS
+  //
+
+  TEST(RBatchTest, Svd) {
+    test_over_integers(0, 40, test_svd_batch<double>);
+  }
+
+  TEST(RBatchTest, EigSym) {
+    test_over_integers(0, 40, test_eig_sym_batch<double>);
+  }
+
+  TEST(RBatchTest, Solve) {
+    test_over_integers(0, 40, test_solve_batch<double>);
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // COMPLEX SPECIALIZATIONS
+  //
+
+  TEST(CBatchTest, Svd) {
+    test_over_integers(0, 40, test_svd_batch<cdouble>);
+  }
+
+  TEST(CBatchTest, EigSym) {
+    test_over_integers(0, 40, test_eig_sym_batch<cdouble>);
+  }
+
+  TEST(CBatchTest, Solve) {
+    test_over_integers(0, 40, test_solve_batch<cdouble>);
+  }
+
+} // namespace tensor_test
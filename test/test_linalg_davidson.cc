@@ -0,0 +1,142 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include "loops.h"
+#include <gtest/gtest.h>
+#include <tensor/tensor.h>
+#include <tensor/sparse.h>
+#include <tensor/linalg.h>
+
+namespace tensor_test {
+
+  using namespace tensor;
+  using namespace linalg;
+
+  //////////////////////////////////////////////////////////////////////
+  // DAVIDSON
+  //
+
+  /* Compare with the dense solver and verify that the columns of U are
+   * orthonormal eigenvectors. */
+  template<class Tensor>
+  void check_davidson(const Tensor &A, const RTensor &E, const Tensor &U)
+  {
+    size_t neig = E.size();
+    RTensor exact = eig_sym(A);
+    ASSERT_EQ(2, U.rank());
+    ASSERT_EQ(A.columns(), U.dimension(0));
+    ASSERT_EQ(neig, U.dimension(1));
+    double scale = std::max(1.0, max(abs(exact)));
+    for (size_t i = 0; i < neig; i++)
+      EXPECT_TRUE(simeq(exact(i), E(i), 1e-9 * scale));
+    Tensor R = mmult(A, U) - mmult(U, diag(Tensor(E)));
+    EXPECT_LT(norm0(R), 1e-8 * scale);
+    EXPECT_TRUE(approx_eq(mmult(adjoint(U), U), Tensor::eye(neig), 1e-10));
+  }
+
+  /* Diagonally dominant Hermitian matrix with a small random coupling. */
+  template<typename elt_t>
+  const Tensor<elt_t> dominant_matrix(int n) {
+    Tensor<elt_t> A = Tensor<elt_t>::random(n, n) - 0.5;
+    A = 0.1 * (A + adjoint(A));
+    for (int i = 0; i < n; i++)
+      A.at(i, i) = (double)((7 * i) % n);
+    return A;
+  }
+
+  template<typename elt_t>
+  void test_davidson_dense(int n) {
+    Tensor<elt_t> A = dominant_matrix<elt_t>(n);
+    MatrixMap<Tensor<elt_t> > op(A);
+    RTensor d = real(take_diag(A));
+    for (int neig = 1; neig <= std::min(n, 3); neig++) {
+      Tensor<elt_t> U;
+      bool converged = false;
+      size_t matvecs = 0;
+      RTensor E = davidson(&op, d, neig, &U, &converged, 0, 0, &matvecs);
+      EXPECT_TRUE(converged);
+      EXPECT_LE(neig, matvecs);
+      check_davidson(A, E, U);
+    }
+  }
+
+  template<typename elt_t>
+  void test_davidson_restart(int n) {
+    Tensor<elt_t> A = dominant_matrix<elt_t>(n);
+    MatrixMap<Tensor<elt_t> > op(A);
+    RTensor d = real(take_diag(A));
+    Tensor<elt_t> U;
+    bool converged = false;
+    RTensor E = davidson(&op, d, 2, &U, &converged, 0, 4);
+    EXPECT_TRUE(converged);
+    check_davidson(A, E, U);
+
+    /* Starting from the solution converges immediately */
+    size_t matvecs = 0;
+    E = davidson(&op, d, 2, &U, &converged, 0, 4, &matvecs);
+    EXPECT_TRUE(converged);
+    EXPECT_EQ(2, matvecs);
+    check_davidson(A, E, U);
+  }
+
+  template<typename elt_t>
+  void test_davidson_sparse(int n) {
+    Sparse<elt_t> B = Sparse<elt_t>::random(n, n, 0.05);
+    Tensor<elt_t> d = Tensor<elt_t>(linspace(1.0, (double)n, n));
+    Sparse<elt_t> A = 0.1 * (B + adjoint(B)) + Sparse<elt_t>(diag(d));
+    Tensor<elt_t> U;
+    bool converged = false;
+    RTensor E = davidson(A, 3, &U, &converged);
+    EXPECT_TRUE(converged);
+    check_davidson(full(A), E, U);
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // REAL SPECIALIZATIONS
+  //
+
+  TEST(RDavidsonTest, Dense) {
+    test_over_integers(1, 40, test_davidson_dense<double>);
+  }
+
+  TEST(RDavidsonTest, Restart) {
+    test_over_integers(4, 40, test_davidson_restart<double>);
+  }
+
+  TEST(RDavidsonTest, Sparse) {
+    test_over_integers(10, 120, test_davidson_sparse<double>);
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // COMPLEX SPECIALIZATIONS
+  //
+
+  TEST(CDavidsonTest, Dense) {
+    test_over_integers(1, 40, test_davidson_dense<cdouble>);
+  }
+
+  TEST(CDavidsonTest, Restart) {
+    test_over_integers(4, 40, test_davidson_restart<cdouble>);
+  }
+
+  TEST(CDavidsonTest, Sparse) {
+    test_over_integers(10, 120, test_davidson_sparse<cdouble>);
+  }
+
+} // namespace tensor_test
@@ -100,6 +100,91 @@ namespace tensor_test {
     }
   }
 
+  /* A matrix with eigenvalues 5, -3, 2 and the rest in [0, 0.5) (or
+   * [1, 1.5) when 'positive'), Hermitian or with a random, well
+   * conditioned basis of eigenvectors. */
+  template<typename elt_t>
+  Tensor<elt_t> matrix_with_spectrum(int n, bool hermitian, bool positive = false) {
+    RTensor lambda(n);
+    lambda.randomize();
+    lambda *= 0.5;
+    if (positive) {
+      lambda += 1.0;
+    }
+    lambda.at(0) = 5.0;
+    lambda.at(1) = positive? 4.0 : -3.0;
+    lambda.at(2) = positive? 3.0 : 2.0;
+    Tensor<elt_t> D = diag(Tensor<elt_t>(lambda));
+    if (hermitian) {
+      Tensor<elt_t> U = tensor_test::random_unitary<elt_t>(n);
+      return mmult(U, mmult(D, adjoint(U)));
+    }
+    Tensor<elt_t> S = Tensor<elt_t>::random(n, n);
+    S = Tensor<elt_t>::eye(n, n) + (0.2 / n) * S;
+    return mmult(S, mmult(D, linalg::solve(S, Tensor<elt_t>::eye(n, n))));
+  }
+
+  /*
+   * Deflation finds the three eigenvalues with largest absolute value,
+   * with eigenvectors, for dense and sparse, Hermitian and non Hermitian
+   * matrices.
+   */
+  template<typename elt_t>
+  void test_deflated_eig_power(int n) {
+    if (n < 3) {
+      return;
+    }
+    for (int hermitian = 0; hermitian < 2; hermitian++) {
+      Tensor<elt_t> A = matrix_with_spectrum<elt_t>(n, hermitian);
+      Tensor<elt_t> R, L;
+      int iterations;
+      Tensor<elt_t> l = linalg::eig_power_right(A, 3, &R, 0.0, 1000, 1e-13,
+                                                &iterations);
+      EXPECT_EQ(l.size(), 3);
+      EXPECT_EQ(R.rows(), n);
+      EXPECT_EQ(R.columns(), 3);
+      EXPECT_GT(iterations, 0);
+      EXPECT_LT(tensor::abs(l[0] - 5.0), 1e-9);
+      EXPECT_LT(tensor::abs(l[1] + 3.0), 1e-9);
+      EXPECT_LT(tensor::abs(l[2] - 2.0), 1e-9);
+      EXPECT_LT(norm0(mmult(A, R) - mmult(R, diag(l))), 1e-8);
+
+      l = linalg::eig_power_left(A, 3, &L, 0.0, 1000, 1e-13);
+      EXPECT_LT(tensor::abs(l[1] + 3.0), 1e-9);
+      EXPECT_LT(norm0(mmult(transpose(L), A) - mmult(diag(l), transpose(L))),
+                1e-8);
+
+      Tensor<elt_t> l2 = linalg::eig_power_right(Sparse<elt_t>(A), 3, &R, 0.0,
+                                                 1000, 1e-13);
+      EXPECT_TRUE(approx_eq(l, l2, 1e-9));
+      EXPECT_LT(norm0(mmult(A, R) - mmult(R, diag(l2))), 1e-8);
+    }
+  }
+
+  /*
+   * A shift that moves the smaller eigenvalues towards zero speeds up
+   * convergence, without changing the eigenvalues that are returned.
+   */
+  template<typename elt_t>
+  void test_shifted_eig_power(int n) {
+    if (n < 3) {
+      return;
+    }
+    Tensor<elt_t> A = matrix_with_spectrum<elt_t>(n, true, true);
+    Tensor<elt_t> R0, R1;
+    int plain, shifted;
+    Tensor<elt_t> l0 = linalg::eig_power_right(A, 2, &R0, 0.0, 1000, 1e-12, &plain);
+    Tensor<elt_t> l1 = linalg::eig_power_right(A, 2, &R1, 2.0, 1000, 1e-12, &shifted);
+    EXPECT_TRUE(approx_eq(l0, l1, 1e-9));
+    EXPECT_LT(tensor::abs(l1[0] - 5.0), 1e-9);
+    EXPECT_LT(tensor::abs(l1[1] - 4.0), 1e-9);
+    EXPECT_LT(shifted, plain);
+
+    int warm;
+    linalg::eig_power_right(A, 2, &R1, 2.0, 1000, 1e-12, &warm);
+    EXPECT_LT(warm, shifted);
+  }
+
   //////////////////////////////////////////////////////////////////////
   // REAL SPECIALIZATIONS
   //
@@ -120,6 +205,14 @@ namespace tensor_test {
     test_over_integers(0, 32, test_random_eig_power_right<double>);
   }
 
+  TEST(RMatrixTest, DeflatedEigPowerTest) {
+    test_over_integers(0, 32, test_deflated_eig_power<double>);
+  }
+
+  TEST(RMatrixTest, ShiftedEigPowerTest) {
+    test_over_integers(0, 32, test_shifted_eig_power<double>);
+  }
+
   //////////////////////////////////////////////////////////////////////
   // REAL SPECIALIZATIONS
   //
@@ -140,4 +233,12 @@ namespace tensor_test {
     test_over_integers(0, 32, test_random_eig_power_right<cdouble>);
   }
 
+  TEST(CMatrixTest, DeflatedEigPowerTest) {
+    test_over_integers(0, 32, test_deflated_eig_power<cdouble>);
+  }
+
+  TEST(CMatrixTest, ShiftedEigPowerTest) {
+    test_over_integers(0, 32, test_shifted_eig_power<cdouble>);
+  }
+
 } // namespace linalg_test
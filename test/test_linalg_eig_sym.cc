@@ -69,6 +69,55 @@ namespace tensor_test {
     }
   }
 
+  template<typename elt_t, linalg::EigSymAlgorithm algorithm>
+  void test_algorithm_eig_sym(int n) {
+    linalg::EigSymAlgorithm old = linalg::eig_sym_algorithm;
+    linalg::eig_sym_algorithm = algorithm;
+    /* MRRR may return any basis of a degenerate eigenspace */
+    if (algorithm != linalg::EIG_SYM_SYEVR) {
+      test_eye_eig_sym<elt_t>(n);
+    }
+    test_random_eig_sym<elt_t>(n);
+    linalg::eig_sym_algorithm = old;
+  }
+
+  /*
+   * Selected eigenpairs coincide with those of the full decomposition.
+   */
+  template<typename elt_t>
+  void test_subset_eig_sym(int n) {
+    if (n == 0) {
+      return;
+    }
+    Tensor<elt_t> A = Tensor<elt_t>::random(n,n);
+    A = A + adjoint(A);
+    RTensor s = linalg::eig_sym(A);
+    for (int first = 0; first < n; first += 3) {
+      for (int last = first; last < n; last += 2) {
+        Tensor<elt_t> R;
+        RTensor s2 = linalg::eig_sym(A, &R, first, last);
+        EXPECT_EQ(last - first + 1, s2.size());
+        EXPECT_TRUE(approx_eq(s2, RTensor(s(range(first, last))), 1e-12));
+        EXPECT_EQ(R.rows(), n);
+        EXPECT_EQ(R.columns(), s2.size());
+        EXPECT_TRUE(unitaryp(R, 1e-10));
+        EXPECT_TRUE(approx_eq(mmult(A, R), mmult(R, diag(s2)), 1e-11));
+        EXPECT_TRUE(approx_eq(linalg::eig_sym(A, 0, first, last), s2, 1e-12));
+      }
+    }
+    /* An interval around the eigenvalues 'first' to 'last' */
+    int first = n / 3, last = (2 * n) / 3;
+    double lower = (first == 0)? s[0] - 1.0 : (s[first - 1] + s[first]) / 2;
+    double upper = (last == n - 1)? s[n - 1] + 1.0 : (s[last] + s[last + 1]) / 2;
+    Tensor<elt_t> R;
+    RTensor s3 = linalg::eig_sym_interval(A, &R, lower, upper);
+    EXPECT_TRUE(approx_eq(s3, RTensor(s(range(first, last))), 1e-12));
+    EXPECT_TRUE(approx_eq(mmult(A, R), mmult(R, diag(s3)), 1e-11));
+    /* No eigenvalue is found above the largest one */
+    EXPECT_EQ(0, linalg::eig_sym_interval(A, &R, s[n - 1] + 1.0,
+                                          s[n - 1] + 2.0).size());
+  }
+
   //////////////////////////////////////////////////////////////////////
   // REAL SPECIALIZATIONS
   //
@@ -81,6 +130,18 @@ namespace tensor_test {
     test_over_integers(0, 32, test_random_eig_sym<double>);
   }
 
+  TEST(RMatrixTest, SyevEigTest) {
+    test_over_integers(0, 32, test_algorithm_eig_sym<double,linalg::EIG_SYM_SYEV>);
+  }
+
+  TEST(RMatrixTest, SyevrEigTest) {
+    test_over_integers(0, 32, test_algorithm_eig_sym<double,linalg::EIG_SYM_SYEVR>);
+  }
+
+  TEST(RMatrixTest, SubsetEigTest) {
+    test_over_integers(0, 32, test_subset_eig_sym<double>);
+  }
+
   //////////////////////////////////////////////////////////////////////
   // COMPLEX SPECIALIZATIONS
   //
@@ -93,4 +154,16 @@ namespace tensor_test {
     test_over_integers(0, 32, test_random_eig_sym<cdouble>);
   }
 
+  TEST(CMatrixTest, SyevEigTest) {
+    test_over_integers(0, 32, test_algorithm_eig_sym<cdouble,linalg::EIG_SYM_SYEV>);
+  }
+
+  TEST(CMatrixTest, SyevrEigTest) {
+    test_over_integers(0, 32, test_algorithm_eig_sym<cdouble,linalg::EIG_SYM_SYEVR>);
+  }
+
+  TEST(CMatrixTest, SubsetEigTest) {
+    test_over_integers(0, 32, test_subset_eig_sym<cdouble>);
+  }
+
 } // namespace linalg_test
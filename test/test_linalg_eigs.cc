@@ -21,6 +21,8 @@
 #include <gtest/gtest.h>
 #include <tensor/tensor.h>
 #include <tensor/linalg.h>
+#include <tensor/arpack.h>
+#include <tensor/sdf.h>
 
 namespace tensor_test {
 
@@ -92,6 +94,191 @@ namespace tensor_test {
     EXPECT_CEQ(1.0, abs(fold(en, 0, U, 0))(0));
   }
 
+  template<class Matrix>
+  void test_eigs_sym_permuted_diagonal(int n) {
+    typedef typename Matrix::elt_t elt_t;
+    RTensor p = random_permutation(n, n);
+    RTensor pinv = adjoint(p);
+    RTensor d = diag(linspace((double)1.0, n, n), 0);
+
+    Tensor<elt_t> e1 = RTensor::zeros(igen << n);
+    e1.at(0) = 1.0;
+    e1 = mmult(pinv, e1);
+
+    Tensor<elt_t> en = RTensor::zeros(igen << n);
+    en.at(n-1) = 1.0;
+    en = mmult(pinv, en);
+
+    Tensor<elt_t> Afull = mmult(pinv, mmult(d, p));
+    Matrix A(Sparse<elt_t>(Afull), 0.0);
+    Tensor<elt_t> U;
+
+    RTensor E = eigs_sym(A, SmallestAlgebraic, 1, &U);
+    EXPECT_EQ(2, U.rank());
+    EXPECT_EQ(n, U.dimension(0));
+    EXPECT_EQ(1, U.dimension(1));
+    EXPECT_EQ(1, E.size());
+    EXPECT_CEQ(1.0, E(0));
+    EXPECT_CEQ(1.0, abs(fold(e1, 0, U, 0))(0));
+
+    E = eigs_sym(A, LargestAlgebraic, 1, &U);
+    EXPECT_EQ(1, E.size());
+    EXPECT_TRUE(simeq((double)n, E(0), 20*EPSILON));
+    EXPECT_CEQ(1.0, abs(fold(en, 0, U, 0))(0));
+  }
+
+  /* Hermitian matrix with eigenvalues 1, 2, ... n. */
+  template<typename elt_t>
+  Tensor<elt_t> hermitian_linspace(int n) {
+    Tensor<elt_t> U = random_unitary<elt_t>(n);
+    Tensor<elt_t> d = diag(Tensor<elt_t>(linspace((double)1.0, n, n)), 0);
+    Tensor<elt_t> A = mmult(U, mmult(d, adjoint(U)));
+    return 0.5 * (A + adjoint(A));
+  }
+
+  /*
+   * A reusable solver gives the same eigenpairs as eigs() on many
+   * matrices, dense or sparse, and starting from the previous Ritz
+   * vectors speeds up the solution of a slightly perturbed matrix.
+   */
+  template<typename elt_t>
+  void test_eigs_solver(int n) {
+    typedef Tensor<elt_t> Matrix;
+    EigsSolver<Matrix> solver(n, LargestMagnitude, 2);
+    for (int times = 0; times < 3; times++) {
+      Matrix A = hermitian_linspace<elt_t>(n), U;
+      Matrix E = solver.solve(A, &U);
+      EXPECT_EQ(2, E.size());
+      EXPECT_EQ(n, U.rows());
+      EXPECT_EQ(2, U.columns());
+      EXPECT_TRUE(simeq(2.0 * n - 1.0, tensor::abs(sum(E)), 1e-10));
+      EXPECT_LT(norm0(mmult(A, U) - mmult(U, Matrix(diag(E)))), 1e-10);
+
+      Matrix E2 = solver.solve(Sparse<elt_t>(A), &U);
+      EXPECT_TRUE(simeq(2.0 * n - 1.0, tensor::abs(sum(E2)), 1e-10));
+      EXPECT_LT(norm0(mmult(A, U) - mmult(U, Matrix(diag(E2)))), 1e-10);
+    }
+    if (n > 4) {
+      Matrix A = hermitian_linspace<elt_t>(n);
+      solver.set_ncv(n);
+      solver.set_tolerance(1e-6);
+      solver.set_maxiter(1000);
+      EXPECT_EQ(n, solver.ncv());
+      EXPECT_EQ(1e-6, solver.tolerance());
+      EXPECT_EQ(1000, solver.maxiter());
+      bool converged = false;
+      Matrix E = solver.solve(A, NULL, &converged);
+      EXPECT_TRUE(converged);
+      EXPECT_TRUE(simeq(2.0 * n - 1.0, tensor::abs(sum(E)), 1e-5));
+
+      /* Zero restores the default number of iterations */
+      Arpack<Matrix> arpack(n, LargestMagnitude, 2);
+      size_t default_maxiter = arpack.get_maxiter();
+      arpack.set_maxiter(5);
+      EXPECT_EQ(5, arpack.get_maxiter());
+      arpack.set_maxiter(0);
+      EXPECT_EQ(default_maxiter, arpack.get_maxiter());
+    }
+  }
+
+  /*
+   * Starting from the previous Ritz vectors needs fewer matrix-vector
+   * products than a random start. The matrix is larger than the Krylov
+   * basis, so that ARPACK has to restart.
+   */
+  template<typename elt_t>
+  void test_eigs_solver_warm_start() {
+    typedef Tensor<elt_t> Matrix;
+    int n = 60;
+    EigsSolver<Matrix> solver(n, LargestMagnitude, 2);
+    Matrix A = hermitian_linspace<elt_t>(n);
+    Matrix B = A + 1e-4 * hermitian_linspace<elt_t>(n);
+    solver.set_warm_start(false);
+    solver.solve(B);
+    size_t cold = solver.matvecs();
+    solver.set_warm_start(true);
+    solver.solve(A);
+    solver.solve(B);
+    size_t warm = solver.matvecs();
+    EXPECT_GT(cold, n);
+    EXPECT_LT(warm, cold);
+  }
+
+  /*
+   * An eigenvalue problem interrupted and saved to a file is continued
+   * by a new object, even after other problems have used ARPACK, with
+   * exactly the same products and results as an uninterrupted run.
+   */
+  template<typename elt_t>
+  void test_eigs_checkpoint() {
+    typedef Tensor<elt_t> Matrix;
+    const char *filename = "eigs_checkpoint.dat";
+    int n = 60;
+    Matrix A = hermitian_linspace<elt_t>(n);
+    Matrix start = Matrix::random(igen << n);
+    Matrix E0, x0;
+    size_t cold = 0;
+    {
+      Arpack<Matrix> arpack(n, LargestMagnitude, 2);
+      arpack.set_tolerance(1e-12);
+      arpack.set_start_vector(start.begin());
+      while (arpack.update() < Arpack<Matrix>::Finished) {
+        if (cold == 20) {
+          x0 = Matrix(igen << n);
+          std::copy(arpack.get_x_vector(), arpack.get_x_vector() + n,
+                    x0.begin());
+        }
+        arpack.set_y(mmult(A, arpack.get_x()));
+        cold++;
+      }
+      ASSERT_EQ(Arpack<Matrix>::Finished, arpack.get_status());
+      E0 = arpack.get_data((Matrix*)NULL);
+    }
+    ASSERT_GT(cold, 40);
+    size_t done = 0;
+    {
+      Arpack<Matrix> arpack(n, LargestMagnitude, 2);
+      arpack.set_tolerance(1e-12);
+      arpack.set_start_vector(start.begin());
+      while (done < 20 && arpack.update() < Arpack<Matrix>::Finished) {
+        arpack.set_y(mmult(A, arpack.get_x()));
+        done++;
+      }
+      sdf::OutDataFile file(filename, sdf::DataFile::SDF_PARANOID);
+      arpack.save_checkpoint(file);
+    }
+    // Another problem overwrites the state of the Fortran routines
+    eigs(hermitian_linspace<elt_t>(n / 2), LargestMagnitude, 3);
+    {
+      Arpack<Matrix> arpack(n, LargestMagnitude, 2);
+      sdf::InDataFile file(filename);
+      arpack.load_checkpoint(file);
+      EXPECT_EQ(1e-12, arpack.get_tolerance());
+      size_t more = 0;
+      while (arpack.update() < Arpack<Matrix>::Finished) {
+        if (more == 0) {
+          EXPECT_TRUE(all_equal(x0, arpack.get_x()));
+        }
+        arpack.set_y(mmult(A, arpack.get_x()));
+        more++;
+      }
+      ASSERT_EQ(Arpack<Matrix>::Finished, arpack.get_status());
+      EXPECT_TRUE(all_equal(E0, arpack.get_data((Matrix*)NULL)));
+      EXPECT_EQ(cold, done + more);
+    }
+    EigsSolver<Matrix> solver(n, LargestMagnitude, 2);
+    solver.set_checkpoint(filename, 10);
+    Matrix U;
+    Matrix E = solver.solve(A, &U);
+    EXPECT_EQ(cold - done, solver.matvecs());
+    // The values come in another order when the vectors are also computed
+    Indices i0 = Arpack<Matrix>::sort_values(E0, LargestMagnitude);
+    Indices i = Arpack<Matrix>::sort_values(E, LargestMagnitude);
+    EXPECT_LT(norm0(E0(range(i0)) - E(range(i))), 1e-12);
+    EXPECT_LT(norm0(mmult(A, U) - mmult(U, Matrix(diag(E)))), 1e-10);
+    EXPECT_FALSE(sdf::file_exists(filename));
+  }
+
   //////////////////////////////////////////////////////////////////////
   // REAL SPECIALIZATIONS
   //
@@ -112,6 +299,19 @@ namespace tensor_test {
     test_over_integers(1, 22, test_eigs_permuted_diagonal<RTensor>);
   }
 
+  TEST(RArpackTest, EigsSymRSymSparsePermutedDiagonal) {
+    test_over_integers(1, 22, test_eigs_sym_permuted_diagonal<RSymSparse>);
+  }
+
+  TEST(RArpackTest, EigsSolver) {
+    test_over_integers(2, 40, test_eigs_solver<double>);
+    test_eigs_solver_warm_start<double>();
+  }
+
+  TEST(RArpackTest, EigsCheckpoint) {
+    test_eigs_checkpoint<double>();
+  }
+
   //////////////////////////////////////////////////////////////////////
   // COMPLEX SPECIALIZATIONS
   //
@@ -132,4 +332,17 @@ namespace tensor_test {
     test_over_integers(1, 22, test_eigs_permuted_diagonal<CTensor>);
   }
 
+  TEST(CArpackTest, EigsSymCSymSparsePermutedDiagonal) {
+    test_over_integers(1, 22, test_eigs_sym_permuted_diagonal<CSymSparse>);
+  }
+
+  TEST(CArpackTest, EigsSolver) {
+    test_over_integers(2, 40, test_eigs_solver<cdouble>);
+    test_eigs_solver_warm_start<cdouble>();
+  }
+
+  TEST(CArpackTest, EigsCheckpoint) {
+    test_eigs_checkpoint<cdouble>();
+  }
+
 } // namespace linalg_test
@@ -0,0 +1,222 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include "loops.h"
+#include <gtest/gtest.h>
+#include <tensor/tensor.h>
+#include <tensor/sparse.h>
+#include <tensor/linalg.h>
+
+namespace tensor_test {
+
+  using namespace tensor;
+  using namespace linalg;
+
+  //////////////////////////////////////////////////////////////////////
+  // THICK-RESTART LANCZOS
+  //
+
+  template<class Matrix>
+  RTensor lanczos(const Matrix &A, int eig_type, size_t neig,
+                  Tensor<typename Matrix::elt_t> *U, bool *converged = 0)
+  {
+    return do_eigs_lanczos(new MatrixMap<Matrix>(A), A.columns(), eig_type,
+                           neig, U, converged);
+  }
+
+  template<typename elt_t>
+  const Tensor<elt_t> random_hermitian_matrix(int n) {
+    Tensor<elt_t> A = Tensor<elt_t>::random(n, n);
+    return A + adjoint(A);
+  }
+
+  /* Compare with the dense solver and verify that the columns of U are
+   * orthonormal eigenvectors. */
+  template<class Matrix>
+  void check_lanczos(const Matrix &A, const RTensor &exact, int eig_type,
+                     size_t neig)
+  {
+    typedef typename Matrix::elt_t elt_t;
+    Tensor<elt_t> U;
+    bool converged = false;
+    RTensor E = lanczos(A, eig_type, neig, &U, &converged);
+    EXPECT_TRUE(converged);
+    ASSERT_EQ(neig, E.size());
+    ASSERT_EQ(2, U.rank());
+    ASSERT_EQ(A.columns(), U.dimension(0));
+    ASSERT_EQ(neig, U.dimension(1));
+    RTensor key;
+    switch (eig_type) {
+    case LargestMagnitude: key = -abs(exact); break;
+    case SmallestMagnitude: key = abs(exact); break;
+    case LargestAlgebraic: key = -exact; break;
+    default: key = exact;
+    }
+    Indices ndx = sort_indices(key);
+    double scale = std::max(1.0, max(abs(exact)));
+    for (size_t i = 0; i < neig; i++) {
+      EXPECT_TRUE(simeq(exact(ndx[i]), E(i), 1e-10 * scale));
+    }
+    Tensor<elt_t> AU = mmult(A, U);
+    Tensor<elt_t> UE = mmult(U, diag(Tensor<elt_t>(E)));
+    EXPECT_LT(norm0(AU - UE), 1e-9 * scale);
+    EXPECT_TRUE(approx_eq(mmult(adjoint(U), U), Tensor<elt_t>::eye(neig),
+                          1e-10));
+  }
+
+  template<typename elt_t>
+  void test_lanczos_random(int n) {
+    Tensor<elt_t> A = random_hermitian_matrix<elt_t>(n);
+    RTensor exact = eig_sym(A);
+    for (int neig = 1; neig <= std::min(n, 4); neig++) {
+      check_lanczos(A, exact, LargestMagnitude, neig);
+      check_lanczos(A, exact, LargestAlgebraic, neig);
+      check_lanczos(A, exact, SmallestAlgebraic, neig);
+    }
+  }
+
+  /* Needs several restarts because the smallest eigenvalues are close. */
+  template<typename elt_t>
+  void test_lanczos_restart(int n) {
+    RTensor d = linspace(1.0, (double)n, n);
+    d.at(1) = 1.001;
+    d.at(2) = 1.002;
+    Tensor<elt_t> U0 = random_hermitian_matrix<elt_t>(n);
+    eig_sym(U0, &U0);
+    Tensor<elt_t> A = mmult(U0, mmult(diag(Tensor<elt_t>(d)), adjoint(U0)));
+    A = 0.5 * (A + adjoint(A));
+    check_lanczos(A, d, SmallestAlgebraic, 3);
+    check_lanczos(A, d, LargestAlgebraic, 5);
+    check_lanczos(A, d, SmallestMagnitude, 2);
+  }
+
+  /* A degenerate spectrum produces an invariant Krylov space right away. */
+  template<typename elt_t>
+  void test_lanczos_eye(int n) {
+    Tensor<elt_t> A = Tensor<elt_t>::eye(n);
+    for (int neig = 1; neig <= std::min(n, 4); neig++) {
+      check_lanczos(A, RTensor::ones(igen << n), LargestMagnitude, neig);
+    }
+  }
+
+  /* Diagonal matrix, applied without storing it. */
+  template<class Tensor>
+  struct DiagonalMap : public Map<Tensor> {
+    DiagonalMap(const RTensor &d) : d_(d) {}
+    virtual ~DiagonalMap() {};
+    virtual const Tensor operator()(const Tensor &x) const {
+      Tensor y(x.dimensions());
+      for (tensor::index i = 0; i < x.size(); i++)
+        y.at(i) = d_[i] * x[i];
+      return y;
+    }
+  private:
+    const RTensor d_;
+  };
+
+  /* The largest eigenvalues of 1-(k/n)^2 are too close for the solver to
+   * converge within its iterations. The vectors it returns must still be
+   * the orthonormal Ritz vectors of the last cycle, with residuals that
+   * are orthogonal to them. */
+  template<typename elt_t>
+  void test_lanczos_maxit() {
+    int n = 1000;
+    RTensor d(n);
+    for (int k = 0; k < n; k++)
+      d.at(k) = 1.0 - (double)k * k / ((double)n * n);
+    Tensor<elt_t> U;
+    bool converged = true;
+    RTensor E = do_eigs_lanczos(new DiagonalMap<Tensor<elt_t> >(d), n,
+                                LargestAlgebraic, 2, &U, &converged);
+    EXPECT_FALSE(converged);
+    ASSERT_EQ(n, U.dimension(0));
+    ASSERT_EQ(2, U.dimension(1));
+    Tensor<elt_t> AU = mmult(Tensor<elt_t>(diag(Tensor<elt_t>(d))), U);
+    Tensor<elt_t> R = AU - mmult(U, diag(Tensor<elt_t>(E)));
+    EXPECT_LT(norm0(R), 1e-3);
+    EXPECT_LT(norm0(mmult(adjoint(U), R)), 1e-10);
+    EXPECT_TRUE(approx_eq(mmult(adjoint(U), U), Tensor<elt_t>::eye(2),
+                          1e-10));
+  }
+
+  template<typename elt_t>
+  void test_lanczos_sparse(int n) {
+    Sparse<elt_t> B = Sparse<elt_t>::random(n, n, 0.1);
+    Sparse<elt_t> A = B + adjoint(B);
+    RTensor exact = eig_sym(full(A));
+    check_lanczos(A, exact, SmallestAlgebraic, 2);
+    check_lanczos(SymSparse<elt_t>(A), exact, LargestAlgebraic, 2);
+
+    /* The same solver through eigs_sym() */
+    int old = set_eigs_sym_backend(EigsLanczos);
+    Tensor<elt_t> U;
+    RTensor E = eigs_sym(SymSparse<elt_t>(A), SmallestAlgebraic, 1, &U);
+    EXPECT_TRUE(simeq(min(exact), E(0), 1e-10 * std::max(1.0, max(abs(exact)))));
+    EXPECT_EQ(EigsLanczos, set_eigs_sym_backend(old));
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // REAL SPECIALIZATIONS
+  //
+
+  TEST(RLanczosTest, Random) {
+    test_over_integers(1, 40, test_lanczos_random<double>);
+  }
+
+  TEST(RLanczosTest, Restart) {
+    test_lanczos_restart<double>(200);
+  }
+
+  TEST(RLanczosTest, MaxIterations) {
+    test_lanczos_maxit<double>();
+  }
+
+  TEST(RLanczosTest, Eye) {
+    test_over_integers(1, 30, test_lanczos_eye<double>);
+  }
+
+  TEST(RLanczosTest, Sparse) {
+    test_over_integers(10, 100, test_lanczos_sparse<double>);
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // COMPLEX SPECIALIZATIONS
+  //
+
+  TEST(CLanczosTest, Random) {
+    test_over_integers(1, 40, test_lanczos_random<cdouble>);
+  }
+
+  TEST(CLanczosTest, Restart) {
+    test_lanczos_restart<cdouble>(200);
+  }
+
+  TEST(CLanczosTest, MaxIterations) {
+    test_lanczos_maxit<cdouble>();
+  }
+
+  TEST(CLanczosTest, Eye) {
+    test_over_integers(1, 30, test_lanczos_eye<cdouble>);
+  }
+
+  TEST(CLanczosTest, Sparse) {
+    test_over_integers(10, 100, test_lanczos_sparse<cdouble>);
+  }
+
+} // namespace tensor_test
@@ -74,6 +74,36 @@ namespace tensor_test {
       return cos(phi) * id + to_complex(0.0,sin(phi)) * A;
   }
 
+  /*
+   * Exponential of a nonnormal 2x2 triangular matrix with a large
+   * off-diagonal element, for which ||A|| greatly overestimates the
+   * scaling that is needed.
+   */
+  template<typename elt_t>
+  const Tensor<elt_t>
+  expm_triangular(double a, double d, double c, Tensor<elt_t> *pexponent)
+  {
+    Tensor<elt_t> A = Tensor<elt_t>::zeros(2, 2);
+    A.at(0,0) = a;
+    A.at(1,1) = d;
+    A.at(0,1) = c;
+    *pexponent = A;
+    Tensor<elt_t> E = Tensor<elt_t>::zeros(2, 2);
+    E.at(0,0) = exp(a);
+    E.at(1,1) = exp(d);
+    E.at(0,1) = c * (exp(a) - exp(d)) / (a - d);
+    return E;
+  }
+
+  template<typename elt_t>
+  void test_expm_triangular() {
+    for (double c = 1.0; c < 1e8; c *= 10) {
+      Tensor<elt_t> A, expA = expm_triangular(0.5, -0.5, c, &A);
+      Tensor<elt_t> E = linalg::expm(A);
+      EXPECT_TRUE(approx_eq(E / c, expA / c, 1e-13));
+    }
+  }
+
   template<typename elt_t>
   void test_expm_diag(int n) {
     if (n == 0) {
@@ -107,6 +137,22 @@ namespace tensor_test {
     }
   }
 
+  /*
+   * The fixed order Pade approximant is still available.
+   */
+  TEST(RMatrixTest, ExpmFixedOrder) {
+    for (int i = 0; i < 30; i++) {
+      double theta = rand(M_PI);
+      double phi = rand(M_PI);
+      RTensor fA, expfA = pauli_exponential(theta, phi, &fA);
+      EXPECT_TRUE(approx_eq(linalg::expm(fA, 7), expfA, 1e-13));
+    }
+  }
+
+  TEST(RMatrixTest, ExpmNonnormal) {
+    test_expm_triangular<double>();
+  }
+
   /*
    * exp(A + B) = exp(A) exp(B) if A and B commute
    */
@@ -146,6 +192,22 @@ namespace tensor_test {
     }
   }
 
+  /*
+   * The fixed order Pade approximant is still available.
+   */
+  TEST(CMatrixTest, ExpmFixedOrder) {
+    for (int i = 0; i < 30; i++) {
+      double theta = rand(M_PI);
+      double phi = rand(M_PI);
+      CTensor fA, expfA = pauli_exponential(theta, phi, &fA);
+      EXPECT_TRUE(approx_eq(linalg::expm(fA, 7), expfA, 1e-13));
+    }
+  }
+
+  TEST(CMatrixTest, ExpmNonnormal) {
+    test_expm_triangular<cdouble>();
+  }
+
   /*
    * exp(A + B) = exp(A) exp(B) if A and B commute
    */
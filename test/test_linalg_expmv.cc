@@ -0,0 +1,124 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include "loops.h"
+#include <gtest/gtest.h>
+#include <tensor/tensor.h>
+#include <tensor/sparse.h>
+#include <tensor/linalg.h>
+
+namespace tensor_test {
+
+  using namespace tensor;
+  using namespace linalg;
+
+  //////////////////////////////////////////////////////////////////////
+  // ACTION OF THE MATRIX EXPONENTIAL
+  //
+
+  template<typename elt_t>
+  void check_expmv(const Tensor<elt_t> &A, elt_t t, const Tensor<elt_t> &v,
+                   int krylov_dim) {
+    MatrixMap<Tensor<elt_t> > op(A);
+    Tensor<elt_t> exact = mmult(expm(t * A), v);
+    Tensor<elt_t> w = expmv(&op, t, v, 1e-10, krylov_dim);
+    ASSERT_TRUE(all_equal(w.dimensions(), v.dimensions()));
+    EXPECT_LE(norm2(w - exact), 1e-8 * std::max(1.0, norm2(exact)));
+  }
+
+  template<typename elt_t>
+  void test_expmv_random(int n) {
+    Tensor<elt_t> A = Tensor<elt_t>::random(n, n) - 0.5;
+    Tensor<elt_t> v = Tensor<elt_t>::random(n);
+    /* Short times are one step, long times need several */
+    check_expmv<elt_t>(A, number_one<elt_t>() * 0.1, v, 0);
+    check_expmv<elt_t>(A, number_one<elt_t>() * 3.0, v, 0);
+    check_expmv<elt_t>(A, number_one<elt_t>() * -2.0, v, 4);
+  }
+
+  template<typename elt_t>
+  void test_expmv_trivial(int n) {
+    Tensor<elt_t> A = Tensor<elt_t>::random(n, n);
+    MatrixMap<Tensor<elt_t> > op(A);
+    Tensor<elt_t> v = Tensor<elt_t>::random(n);
+    EXPECT_CEQ(v, expmv(&op, number_zero<elt_t>(), v));
+    Tensor<elt_t> zero = Tensor<elt_t>::zeros(igen << n);
+    EXPECT_CEQ(zero, expmv(&op, number_one<elt_t>(), zero));
+    /* The identity produces an invariant subspace at once */
+    MatrixMap<Tensor<elt_t> > eye(Tensor<elt_t>::eye(n));
+    EXPECT_TRUE(approx_eq(exp(1.5) * v, expmv(&eye, number_one<elt_t>() * 1.5, v), 1e-12));
+  }
+
+  /* Evolution of a particle in a tight-binding chain, exp(-iHt)psi */
+  void test_expmv_unitary(int n) {
+    RTensor t = RTensor::zeros(n, n);
+    for (int i = 0; i + 1 < n; i++)
+      t.at(i, i+1) = t.at(i+1, i) = -1.0;
+    RSparse H(t + diag(RTensor::random(igen << n)));
+    CTensor psi = CTensor::zeros(igen << n);
+    psi.at(n / 2) = 1.0;
+    cdouble dt = to_complex(0.0, -10.0);
+    CTensor exact = mmult(expm(dt * CTensor(full(H))), psi);
+    CTensor phi = expmv(H, dt, psi, 1e-10, 8);
+    EXPECT_LE(norm2(phi - exact), 1e-8);
+    EXPECT_TRUE(simeq(1.0, norm2(phi), 1e-10));
+    phi = expmv(CSparse(H), dt, psi);
+    EXPECT_LE(norm2(phi - exact), 1e-8);
+  }
+
+  void test_expmv_sparse(int n) {
+    RSparse A = RSparse::random(n, n, 0.2);
+    RTensor v = RTensor::random(n);
+    RTensor exact = mmult(expm(full(A)), v);
+    EXPECT_LE(norm2(expmv(A, 1.0, v) - exact), 1e-8 * std::max(1.0, norm2(exact)));
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // REAL SPECIALIZATIONS
+  //
+
+  TEST(RExpmvTest, Random) {
+    test_over_integers(1, 40, test_expmv_random<double>);
+  }
+
+  TEST(RExpmvTest, Trivial) {
+    test_over_integers(1, 20, test_expmv_trivial<double>);
+  }
+
+  TEST(RExpmvTest, Sparse) {
+    test_over_integers(1, 60, test_expmv_sparse);
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // COMPLEX SPECIALIZATIONS
+  //
+
+  TEST(CExpmvTest, Random) {
+    test_over_integers(1, 40, test_expmv_random<cdouble>);
+  }
+
+  TEST(CExpmvTest, Trivial) {
+    test_over_integers(1, 20, test_expmv_trivial<cdouble>);
+  }
+
+  TEST(CExpmvTest, Unitary) {
+    test_over_integers(2, 80, test_expmv_unitary);
+  }
+
+} // namespace tensor_test
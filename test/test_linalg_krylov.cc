@@ -0,0 +1,232 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include "loops.h"
+#include <gtest/gtest.h>
+#include <tensor/tensor.h>
+#include <tensor/sparse.h>
+#include <tensor/linalg.h>
+
+namespace tensor_test {
+
+  using namespace tensor;
+  using namespace linalg;
+
+  //////////////////////////////////////////////////////////////////////
+  // KRYLOV SOLVERS
+  //
+
+  /* Sparse matrix with a diagonal between 1 and 'scale' plus a random
+   * coupling, Hermitian positive definite if 'hermitian'. */
+  template<typename elt_t>
+  const Sparse<elt_t> krylov_matrix(int n, bool hermitian, double scale = 10.0) {
+    Sparse<elt_t> B = Sparse<elt_t>::random(n, n, 0.1);
+    B = 0.1 * (B + (hermitian? adjoint(B) : B));
+    Tensor<elt_t> d = Tensor<elt_t>(linspace(1.0, scale, n));
+    RTensor absB = abs(full(B));
+    for (int i = 0; i < n; i++)
+      for (int j = 0; j < n; j++)
+        d.at(i) += absB(i, j);
+    return B + Sparse<elt_t>(diag(d));
+  }
+
+  template<typename elt_t>
+  void check_solution(const Sparse<elt_t> &A, const Tensor<elt_t> &x,
+                      const Tensor<elt_t> &b, const RTensor &history,
+                      double tol = 1e-10) {
+    ASSERT_TRUE(all_equal(x.dimensions(), b.dimensions()));
+    ASSERT_LT(0, history.size());
+    EXPECT_DOUBLE_EQ(1.0, history[0]);
+    EXPECT_LE(history[history.size()-1], tol);
+    EXPECT_LE(norm2(mmult(A, x) - b), 10 * tol * norm2(b));
+  }
+
+  template<typename elt_t>
+  void test_pcg(int n) {
+    Sparse<elt_t> A = krylov_matrix<elt_t>(n, true, 1e4);
+    Tensor<elt_t> b = Tensor<elt_t>::random(n);
+    RTensor plain, jacobi, ilu;
+    Tensor<elt_t> x = pcg(A, b, 0, 0, 0, 0, &plain);
+    check_solution(A, x, b, plain);
+
+    JacobiPreconditioner<elt_t> J(A);
+    x = pcg(A, b, &J, 0, 0, 0, &jacobi);
+    check_solution(A, x, b, jacobi);
+    EXPECT_LE(jacobi.size(), plain.size());
+
+    /* A good starting point converges right away */
+    RTensor history;
+    x = pcg(A, b, &J, &x, 0, 0, &history);
+    EXPECT_EQ(1, history.size());
+
+    /* Dense version, several right-hand sides */
+    Tensor<elt_t> B = Tensor<elt_t>::random(n, 2);
+    x = pcg(full(A), B, &J, 0, 0, 0, &history);
+    check_solution(A, x, B, history);
+  }
+
+  template<typename elt_t>
+  void test_bicgstab(int n) {
+    Sparse<elt_t> A = krylov_matrix<elt_t>(n, false, 1e3);
+    Tensor<elt_t> b = Tensor<elt_t>::random(n);
+    RTensor plain, jacobi, ilu;
+    Tensor<elt_t> x = bicgstab(A, b, 0, 0, 0, 0, &plain);
+    check_solution(A, x, b, plain);
+
+    JacobiPreconditioner<elt_t> J(A);
+    x = bicgstab(A, b, &J, 0, 0, 0, &jacobi);
+    check_solution(A, x, b, jacobi);
+
+    ILU0Preconditioner<elt_t> L(A);
+    x = bicgstab(A, b, &L, 0, 0, 0, &ilu);
+    check_solution(A, x, b, ilu);
+    EXPECT_LE(ilu.size(), plain.size());
+  }
+
+  template<typename elt_t>
+  void test_gmres(int n) {
+    Sparse<elt_t> A = krylov_matrix<elt_t>(n, false, 1e2);
+    Tensor<elt_t> b = Tensor<elt_t>::random(n);
+    RTensor plain, restarted, ilu;
+    Tensor<elt_t> x = gmres(A, b, 0, 0, 0, 0, &plain);
+    check_solution(A, x, b, plain);
+
+    /* Short restarts need a well conditioned problem */
+    Sparse<elt_t> A2 = krylov_matrix<elt_t>(n, false, 3.0);
+    x = gmres(A2, b, 0, 0, 20 * n + 50, 0, &restarted, 5);
+    check_solution(A2, x, b, restarted);
+
+    ILU0Preconditioner<elt_t> L(A);
+    x = gmres(full(A), b, &L, 0, 0, 0, &ilu);
+    check_solution(A, x, b, ilu);
+    EXPECT_LE(ilu.size(), plain.size());
+  }
+
+  /* The shift matrix maps e_i to e_{i+1} and the last vector to zero, so
+   * that the Arnoldi process on b = e_0 ends with a zero column. GMRES has
+   * to stop there with a finite least squares solution, which is zero
+   * because b is orthogonal to the range of the matrix. */
+  template<typename elt_t>
+  void test_gmres_breakdown(int n) {
+    Tensor<elt_t> S = Tensor<elt_t>::zeros(n, n);
+    for (int i = 1; i < n; i++)
+      S.at(i, i-1) = number_one<elt_t>();
+    Tensor<elt_t> b = Tensor<elt_t>::zeros(igen << n);
+    b.at(0) = number_one<elt_t>();
+    RTensor history;
+    Tensor<elt_t> x = gmres(Sparse<elt_t>(S), b, 0, 0, 3 * n, 0, &history);
+    ASSERT_EQ(n, x.size());
+    for (int i = 0; i < n; i++)
+      EXPECT_LT(abs(x[i]), 1e-12);
+    for (tensor::index i = 0; i < history.size(); i++)
+      EXPECT_LT(history[i], 1.0 + 1e-12);
+  }
+
+  /* ILU(0) is exact for tridiagonal matrices, so that the preconditioned
+   * GMRES converges in one iteration. */
+  template<typename elt_t>
+  void test_ilu0_tridiagonal(int n) {
+    Tensor<elt_t> T = Tensor<elt_t>::zeros(n, n);
+    for (int i = 0; i < n; i++) {
+      T.at(i, i) = 4.0;
+      if (i) T.at(i, i-1) = -1.0;
+      if (i+1 < n) T.at(i, i+1) = -2.0;
+    }
+    Sparse<elt_t> A(T);
+    Tensor<elt_t> b = Tensor<elt_t>::random(n);
+    ILU0Preconditioner<elt_t> L(A);
+    EXPECT_TRUE(approx_eq(mmult(T, L(b)), b, 1e-12));
+    RTensor history;
+    Tensor<elt_t> x = gmres(A, b, &L, 0, 0, 0, &history);
+    check_solution(A, x, b, history);
+    EXPECT_EQ(2, history.size());
+  }
+
+  template<typename elt_t>
+  const Tensor<elt_t> scale_by_two(const Tensor<elt_t> &x) {
+    return 2.0 * x;
+  }
+
+  template<typename elt_t>
+  void test_krylov_functor(int n) {
+    Tensor<elt_t> b = Tensor<elt_t>::random(n);
+    /* FunctionMap keeps a reference to the function */
+    const Tensor<elt_t> (*g)(const Tensor<elt_t> &) = scale_by_two<elt_t>;
+    EXPECT_TRUE(approx_eq(pcg(g, b), 0.5 * b, 1e-12));
+    EXPECT_TRUE(approx_eq(bicgstab(g, b), 0.5 * b, 1e-12));
+    EXPECT_TRUE(approx_eq(gmres(g, b), 0.5 * b, 1e-12));
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // REAL SPECIALIZATIONS
+  //
+
+  TEST(RKrylovTest, PCG) {
+    test_over_integers(1, 60, test_pcg<double>);
+  }
+
+  TEST(RKrylovTest, BiCGSTAB) {
+    test_over_integers(1, 60, test_bicgstab<double>);
+  }
+
+  TEST(RKrylovTest, GMRES) {
+    test_over_integers(1, 60, test_gmres<double>);
+  }
+
+  TEST(RKrylovTest, GMRESBreakdown) {
+    test_over_integers(1, 10, test_gmres_breakdown<double>);
+  }
+
+  TEST(RKrylovTest, ILU0) {
+    test_over_integers(1, 30, test_ilu0_tridiagonal<double>);
+  }
+
+  TEST(RKrylovTest, Functor) {
+    test_over_integers(1, 10, test_krylov_functor<double>);
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // COMPLEX SPECIALIZATIONS
+  //
+
+  TEST(CKrylovTest, PCG) {
+    test_over_integers(1, 60, test_pcg<cdouble>);
+  }
+
+  TEST(CKrylovTest, BiCGSTAB) {
+    test_over_integers(1, 60, test_bicgstab<cdouble>);
+  }
+
+  TEST(CKrylovTest, GMRES) {
+    test_over_integers(1, 60, test_gmres<cdouble>);
+  }
+
+  TEST(CKrylovTest, GMRESBreakdown) {
+    test_over_integers(1, 10, test_gmres_breakdown<cdouble>);
+  }
+
+  TEST(CKrylovTest, ILU0) {
+    test_over_integers(1, 30, test_ilu0_tridiagonal<cdouble>);
+  }
+
+  TEST(CKrylovTest, Functor) {
+    test_over_integers(1, 10, test_krylov_functor<cdouble>);
+  }
+
+} // namespace tensor_test
@@ -0,0 +1,135 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include "loops.h"
+#include <gtest/gtest.h>
+#include <tensor/tensor.h>
+#include <tensor/sparse.h>
+#include <tensor/linalg.h>
+
+namespace tensor_test {
+
+  using namespace tensor;
+  using namespace linalg;
+
+  //////////////////////////////////////////////////////////////////////
+  // LOBPCG
+  //
+
+  /* Compare with the dense solver and verify that the columns of U are
+   * orthonormal eigenvectors. */
+  template<class Matrix, class Tensor>
+  void check_lobpcg(const Matrix &A, const Tensor &Afull, const RTensor &E,
+                    const Tensor &U, int eig_type)
+  {
+    size_t neig = E.size();
+    RTensor exact = eig_sym(Afull);
+    ASSERT_EQ(2, U.rank());
+    ASSERT_EQ(A.columns(), U.dimension(0));
+    ASSERT_EQ(neig, U.dimension(1));
+    double scale = std::max(1.0, max(abs(exact)));
+    for (size_t i = 0; i < neig; i++) {
+      double value = (eig_type == SmallestAlgebraic)? exact(i) : exact(exact.size()-1-i);
+      EXPECT_TRUE(simeq(value, E(i), 1e-9 * scale));
+    }
+    Tensor R = mmult(Afull, U) - mmult(U, diag(Tensor(E)));
+    EXPECT_LT(norm0(R), 1e-8 * scale);
+    EXPECT_TRUE(approx_eq(mmult(adjoint(U), U), Tensor::eye(neig), 1e-10));
+  }
+
+  template<typename elt_t>
+  void test_lobpcg_random(int n) {
+    Tensor<elt_t> A = Tensor<elt_t>::random(n, n);
+    A = A + adjoint(A);
+    for (int neig = 1; neig <= std::min(n, 4); neig++) {
+      Tensor<elt_t> U;
+      bool converged = false;
+      RTensor E = lobpcg(A, SmallestAlgebraic, neig, &U, &converged);
+      EXPECT_TRUE(converged);
+      check_lobpcg(A, A, E, U, SmallestAlgebraic);
+      U = Tensor<elt_t>();
+      E = lobpcg(A, LargestAlgebraic, neig, &U, &converged);
+      EXPECT_TRUE(converged);
+      check_lobpcg(A, A, E, U, LargestAlgebraic);
+    }
+  }
+
+  /* Diagonally dominant sparse matrix, with a Jacobi preconditioner that
+   * acts on blocks of vectors. */
+  template<typename elt_t>
+  struct BlockJacobi {
+    Tensor<elt_t> inv_diag;
+    BlockJacobi(const Tensor<elt_t> &d) : inv_diag(d) {
+      for (tensor::index i = 0; i < d.size(); i++) inv_diag.at(i) = 1.0 / d[i];
+    }
+    const Tensor<elt_t> operator()(const Tensor<elt_t> &X) const {
+      return mmult(diag(inv_diag), X);
+    }
+  };
+
+  template<typename elt_t>
+  void test_lobpcg_sparse(int n) {
+    Sparse<elt_t> B = Sparse<elt_t>::random(n, n, 0.05);
+    Tensor<elt_t> d = Tensor<elt_t>(linspace(1.0, (double)n, n));
+    Sparse<elt_t> A = B + adjoint(B) + Sparse<elt_t>(diag(d));
+    Tensor<elt_t> Afull = full(A);
+    Tensor<elt_t> U;
+    bool converged = false;
+    RTensor E = lobpcg(A, SmallestAlgebraic, 3, &U, &converged);
+    EXPECT_TRUE(converged);
+    check_lobpcg(A, Afull, E, U, SmallestAlgebraic);
+
+    BlockJacobi<elt_t> jacobi(d);
+    FunctionMap<BlockJacobi<elt_t>, Tensor<elt_t> > preconditioner(jacobi);
+    E = lobpcg(SymSparse<elt_t>(A), SmallestAlgebraic, 3, &U, &converged,
+               &preconditioner);
+    EXPECT_TRUE(converged);
+    check_lobpcg(A, Afull, E, U, SmallestAlgebraic);
+
+    /* Start from the previous solution */
+    E = lobpcg(A, SmallestAlgebraic, 3, &U, &converged);
+    EXPECT_TRUE(converged);
+    check_lobpcg(A, Afull, E, U, SmallestAlgebraic);
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // REAL SPECIALIZATIONS
+  //
+
+  TEST(RLobpcgTest, Random) {
+    test_over_integers(1, 30, test_lobpcg_random<double>);
+  }
+
+  TEST(RLobpcgTest, Sparse) {
+    test_over_integers(20, 120, test_lobpcg_sparse<double>);
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // COMPLEX SPECIALIZATIONS
+  //
+
+  TEST(CLobpcgTest, Random) {
+    test_over_integers(1, 30, test_lobpcg_random<cdouble>);
+  }
+
+  TEST(CLobpcgTest, Sparse) {
+    test_over_integers(20, 120, test_lobpcg_sparse<cdouble>);
+  }
+
+} // namespace tensor_test
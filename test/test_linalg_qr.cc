@@ -0,0 +1,157 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <algorithm>
+#include "loops.h"
+#include <gtest/gtest.h>
+#include <tensor/tensor.h>
+#include <tensor/linalg.h>
+
+namespace tensor_test {
+
+  using namespace tensor;
+
+  template<typename elt_t>
+  bool upper_triangularp(const Tensor<elt_t> &R) {
+    for (tensor::index j = 0; j < R.columns(); j++)
+      for (tensor::index i = j + 1; i < R.rows(); i++)
+        if (R(i, j) != number_zero<elt_t>())
+          return false;
+    return true;
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // QR DECOMPOSITIONS
+  //
+
+  template<typename elt_t>
+  void test_random_qr(int n) {
+    if (n == 0) {
+      return;
+    }
+    for (int m = 1; m < 2*n; ++m) {
+      Tensor<elt_t> A(m, n);
+      A.randomize();
+      int k = std::min(m, n);
+      for (int economic = 0; economic < 2; economic++) {
+        Tensor<elt_t> Q, R;
+        linalg::qr(A, &Q, &R, economic);
+        EXPECT_EQ(Q.rows(), m);
+        EXPECT_EQ(Q.columns(), economic? k : m);
+        EXPECT_EQ(R.rows(), economic? k : m);
+        EXPECT_EQ(R.columns(), n);
+        EXPECT_TRUE(unitaryp(Q, 1e-10));
+        EXPECT_TRUE(upper_triangularp(R));
+        EXPECT_TRUE(approx_eq(A, mmult(Q, R)));
+
+        Tensor<elt_t> Q2;
+        linalg::qr(A, &Q2, 0, economic);
+        EXPECT_TRUE(all_equal(Q, Q2));
+      }
+    }
+  }
+
+  template<typename elt_t>
+  void test_random_lq(int n) {
+    if (n == 0) {
+      return;
+    }
+    for (int m = 1; m < 2*n; ++m) {
+      Tensor<elt_t> A(m, n);
+      A.randomize();
+      int k = std::min(m, n);
+      for (int economic = 0; economic < 2; economic++) {
+        Tensor<elt_t> L, Q;
+        linalg::lq(A, &L, &Q, economic);
+        EXPECT_EQ(L.rows(), m);
+        EXPECT_EQ(L.columns(), economic? k : n);
+        EXPECT_EQ(Q.rows(), economic? k : n);
+        EXPECT_EQ(Q.columns(), n);
+        EXPECT_TRUE(unitaryp(Q, 1e-10));
+        EXPECT_TRUE(upper_triangularp(transpose(L)));
+        EXPECT_TRUE(approx_eq(A, mmult(L, Q)));
+      }
+    }
+  }
+
+  /*
+   * With column pivoting, the diagonal of R decreases and reveals the rank
+   * of a matrix built from 'r' independent columns.
+   */
+  template<typename elt_t>
+  void test_pivoted_qr(int n) {
+    if (n == 0) {
+      return;
+    }
+    for (int m = n; m < 2*n; ++m) {
+      for (int r = 1; r <= n; r++) {
+        Tensor<elt_t> B(m, r), C(r, n);
+        B.randomize();
+        C.randomize();
+        Tensor<elt_t> A = mmult(B, C);
+        Tensor<elt_t> Q, R;
+        Indices p = linalg::qr_pivoted(A, &Q, &R, true);
+        EXPECT_TRUE(unitaryp(Q, 1e-10));
+        EXPECT_TRUE(upper_triangularp(R));
+        EXPECT_TRUE(approx_eq(Tensor<elt_t>(A(range(), range(p))),
+                              mmult(Q, R), 1e-12));
+        double r0 = abs(R(0, 0));
+        for (int i = 1; i < n; i++) {
+          EXPECT_LE(abs(R(i, i)), abs(R(i-1, i-1)) * (1 + 1e-12));
+        }
+        if (r < n) {
+          EXPECT_LT(abs(R(r, r)), 1e-10 * r0);
+        }
+      }
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // REAL SPECIALIZATIONS
+  //
+
+  TEST(RMatrixTest, RandomQrTest) {
+    test_over_integers(0, 16, test_random_qr<double>);
+  }
+
+  TEST(RMatrixTest, RandomLqTest) {
+    test_over_integers(0, 16, test_random_lq<double>);
+  }
+
+  TEST(RMatrixTest, PivotedQrTest) {
+    test_over_integers(0, 10, test_pivoted_qr<double>);
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // COMPLEX SPECIALIZATIONS
+  //
+
+  TEST(CMatrixTest, RandomQrTest) {
+    test_over_integers(0, 16, test_random_qr<cdouble>);
+  }
+
+  TEST(CMatrixTest, RandomLqTest) {
+    test_over_integers(0, 16, test_random_lq<cdouble>);
+  }
+
+  TEST(CMatrixTest, PivotedQrTest) {
+    test_over_integers(0, 10, test_pivoted_qr<cdouble>);
+  }
+
+} // namespace tensor_test
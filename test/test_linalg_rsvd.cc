@@ -0,0 +1,144 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <algorithm>
+#include <functional>
+#include "loops.h"
+#include <gtest/gtest.h>
+#include <tensor/tensor.h>
+#include <tensor/sparse.h>
+#include <tensor/linalg.h>
+
+namespace tensor_test {
+
+  using namespace tensor;
+
+  /*
+   * Random m x n matrix of rank 'r' with singular values 1, 1/2, 1/4,...
+   */
+  template<typename elt_t>
+  Tensor<elt_t> low_rank_matrix(int m, int n, int r, RTensor &s)
+  {
+    Tensor<elt_t> U = random_unitary<elt_t>(m);
+    Tensor<elt_t> V = random_unitary<elt_t>(n);
+    s = RTensor::zeros(igen << std::min(m, n));
+    for (int i = 0; i < r; i++)
+      s.at(i) = pow(0.5, i);
+    return mmult(U, mmult(diag(s, 0, m, n), V));
+  }
+
+  template<typename elt_t>
+  void test_rsvd_low_rank(int m, int n) {
+    int r = std::min(m, n) / 3 + 1;
+    RTensor s;
+    Tensor<elt_t> A = low_rank_matrix<elt_t>(m, n, r, s);
+    for (int rank = 1; rank <= r; rank++) {
+      Tensor<elt_t> U, VT;
+      /* Enough oversampling to capture the whole range of A */
+      RTensor s2 = linalg::rsvd(A, rank, r, 1, &U, &VT);
+      EXPECT_EQ(rank, s2.size());
+      EXPECT_TRUE(approx_eq(s2, RTensor(s(range(0, rank-1))), 1e-10));
+      EXPECT_EQ(U.rows(), m);
+      EXPECT_EQ(U.columns(), rank);
+      EXPECT_EQ(VT.rows(), rank);
+      EXPECT_EQ(VT.columns(), n);
+      EXPECT_TRUE(unitaryp(U, 1e-10));
+      EXPECT_TRUE(unitaryp(VT, 1e-10));
+      if (rank == r) {
+        EXPECT_TRUE(approx_eq(A, mmult(U, mmult(diag(s2), VT)), 1e-10));
+      }
+    }
+  }
+
+  /*
+   * Without any gap in the spectrum, the power iterations improve the
+   * estimates of the singular values.
+   */
+  template<typename elt_t>
+  void test_rsvd_power(int n) {
+    Tensor<elt_t> A = Tensor<elt_t>::random(n, n);
+    RTensor s = linalg::svd(A);
+    int rank = 5;
+    RTensor exact = s(range(0, rank-1));
+    RTensor s0 = linalg::rsvd(A, rank, 5, 0);
+    RTensor s4 = linalg::rsvd(A, rank, 5, 4);
+    EXPECT_TRUE(approx_eq(s4, exact, 1e-2 * exact[0]));
+    EXPECT_LE(norm2(s4 - exact), norm2(s0 - exact));
+    /* Random projections never overestimate the singular values */
+    for (int i = 0; i < rank; i++) {
+      EXPECT_LE(s4[i], exact[i] * (1 + 1e-12));
+    }
+  }
+
+  template<typename elt_t>
+  void test_rsvd_sparse() {
+    int n = 50;
+    Tensor<elt_t> A = Tensor<elt_t>::zeros(n, 2*n);
+    for (int i = 0; i < n; i++) {
+      A.at(i, 2*i) = 1.0 / (i + 1);
+      A.at(i, (2*i + 7) % (2*n)) = 0.5 / (i + 1);
+    }
+    Sparse<elt_t> S(A);
+    RTensor exact = linalg::svd(A);
+    Tensor<elt_t> U, VT;
+    RTensor s = linalg::rsvd(S, 4, 10, 3, &U, &VT);
+    EXPECT_TRUE(approx_eq(s, RTensor(exact(range(0, 3))), 1e-6));
+    EXPECT_TRUE(unitaryp(U, 1e-10));
+    EXPECT_TRUE(unitaryp(VT, 1e-10));
+    EXPECT_TRUE(approx_eq(mmult(adjoint(U), mmult(A, adjoint(VT))),
+                          Tensor<elt_t>(diag(s)), 1e-6));
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // REAL SPECIALIZATIONS
+  //
+
+  TEST(RRsvdTest, LowRank) {
+    test_rsvd_low_rank<double>(30, 30);
+    test_rsvd_low_rank<double>(60, 20);
+    test_rsvd_low_rank<double>(20, 60);
+  }
+
+  TEST(RRsvdTest, PowerIterations) {
+    test_rsvd_power<double>(100);
+  }
+
+  TEST(RRsvdTest, Sparse) {
+    test_rsvd_sparse<double>();
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // COMPLEX SPECIALIZATIONS
+  //
+
+  TEST(CRsvdTest, LowRank) {
+    test_rsvd_low_rank<cdouble>(30, 30);
+    test_rsvd_low_rank<cdouble>(60, 20);
+    test_rsvd_low_rank<cdouble>(20, 60);
+  }
+
+  TEST(CRsvdTest, PowerIterations) {
+    test_rsvd_power<cdouble>(100);
+  }
+
+  TEST(CRsvdTest, Sparse) {
+    test_rsvd_sparse<cdouble>();
+  }
+
+} // namespace tensor_test
@@ -63,6 +63,168 @@ namespace tensor_test {
     }
   }
 
+  /*
+   * Matrices of the three kinds that the factorizations accept: general,
+   * Hermitian positive definite, and Hermitian indefinite.
+   */
+  template<class Tensor>
+  Tensor factor_test_matrix(int n, int kind) {
+    Tensor M = Tensor::random(n, n) - 0.5 * Tensor::ones(n, n);
+    if (kind == 1)
+      return mmult(M, adjoint(M)) + Tensor::eye(n, n);
+    if (kind == 2)
+      return M + adjoint(M);
+    return M;
+  }
+
+  template<class Tensor, class Factorization, int kind>
+  void test_factorization(int n) {
+    if (n == 0) {
+      return;
+    }
+    Tensor A = factor_test_matrix<Tensor>(n, kind);
+    Factorization F(A);
+    EXPECT_EQ(F.size(), n);
+    EXPECT_TRUE(F.rcond() > 0 && F.rcond() <= 1 + 1e-12);
+    for (int cols = 1; cols < n; cols++) {
+      Tensor x = Tensor::random(n, cols);
+      Tensor y = mmult(A, x);
+      EXPECT_TRUE(approx_eq(x, F.solve(y), 1e-9));
+      F.solve_in_place(y);
+      EXPECT_TRUE(approx_eq(x, y, 1e-9));
+    }
+    Tensor x = Tensor::random(n);
+    EXPECT_TRUE(approx_eq(x, F.solve(mmult(A, x)), 1e-9));
+  }
+
+  /*
+   * The condition estimate is within a small factor of the exact
+   * reciprocal condition number of a diagonal matrix.
+   */
+  template<class Tensor, class Factorization>
+  void test_factorization_rcond() {
+    Tensor A = Tensor::eye(4, 4);
+    A.at(3, 3) = 1e-8;
+    Factorization F(A);
+    EXPECT_NEAR(F.rcond(), 1e-8, 1e-9);
+  }
+
+  /*
+   * Solving without a factored matrix, either because none was given or
+   * because factor() failed, aborts instead of returning garbage.
+   */
+  template<class Tensor, class Factorization>
+  void test_factorization_failure() {
+    Factorization F;
+    EXPECT_EQ(F.size(), 0);
+    ASSERT_DEATH(F.solve(Tensor::ones(igen << 3)), "no matrix has been factored");
+    EXPECT_FALSE(F.factor(Tensor::zeros(3, 3)));
+    EXPECT_EQ(F.size(), 0);
+    EXPECT_EQ(F.rcond(), 0.0);
+    ASSERT_DEATH(F.solve(Tensor::ones(igen << 3)), "no matrix has been factored");
+  }
+
+  template<class Tensor>
+  void test_solve_algorithm(int n) {
+    if (n == 0) {
+      return;
+    }
+    for (int kind = 0; kind < 3; kind++) {
+      Tensor A = factor_test_matrix<Tensor>(n, kind);
+      Tensor x = Tensor::random(n, 2);
+      Tensor y = mmult(A, x);
+      EXPECT_TRUE(approx_eq(x, solve(A, y, SOLVE_AUTO), 1e-9));
+      EXPECT_TRUE(approx_eq(x, solve(A, y, SOLVE_LU), 1e-9));
+      if (kind == 1) {
+        EXPECT_TRUE(approx_eq(x, solve(A, y, SOLVE_CHOLESKY), 1e-9));
+      }
+    }
+    Cholesky<Tensor> F;
+    EXPECT_FALSE(F.factor(-Tensor::eye(n, n)));
+  }
+
+  /*
+   * Mixed precision solutions are as accurate as those of solve(), with a
+   * few refinement steps for well conditioned matrices and a fallback to
+   * double precision for very badly conditioned ones.
+   */
+  template<class Tensor>
+  void test_solve_refined(int n) {
+    if (n == 0) {
+      return;
+    }
+    typedef typename Tensor::elt_t elt_t;
+    Tensor A = factor_test_matrix<Tensor>(n, 0) + (double)n * Tensor::eye(n, n);
+    Tensor x = Tensor::random(n, 3);
+    Tensor y = mmult(A, x);
+    int iterations;
+    double error;
+    Tensor x0 = solve_refined(A, y, &iterations, &error);
+    EXPECT_TRUE(approx_eq(x, x0, 1e-10));
+    EXPECT_GE(iterations, 0);
+    EXPECT_LE(iterations, 5);
+    EXPECT_LT(error, 1e-15);
+    EXPECT_TRUE(approx_eq(solve(A, Tensor(y(range(), range(0)))),
+                          solve_refined(A, Tensor(y(range(), range(0))))));
+
+    if (n > 2) {
+      RTensor s = RTensor::ones(igen << n);
+      s.at(0) = 1e-12;
+      Tensor U = random_unitary<elt_t>(n), V = random_unitary<elt_t>(n);
+      Tensor B = mmult(U, mmult(Tensor(diag(s)), V));
+      solve_refined(B, mmult(B, x), &iterations, &error);
+      EXPECT_LT(error, 1e-15);
+    }
+
+    Tensor C = 1e40 * A;
+    Tensor x2 = solve_refined(C, mmult(C, x), &iterations, &error);
+    EXPECT_EQ(iterations, -1);
+    EXPECT_LT(error, 1e-15);
+    EXPECT_TRUE(approx_eq(x, x2, 1e-10));
+  }
+
+  /*
+   * The pseudoinverse of a rank deficient matrix satisfies the four
+   * Moore-Penrose conditions, and solve_with_svd() agrees with it.
+   */
+  template<class Tensor>
+  void test_pseudo_inverse(int n) {
+    if (n == 0) {
+      return;
+    }
+    int m = n + 2, r = n / 2 + 1;
+    Tensor A = mmult(Tensor::random(m, r), Tensor::random(r, n));
+    PseudoInverse<Tensor> pinv(A, 1e-10);
+    EXPECT_EQ(pinv.rank(), r);
+    EXPECT_EQ(pinv.singular_values().size(), std::min(m, n));
+
+    Tensor P = pinv.solve(Tensor::eye(m, m));
+    EXPECT_EQ(P.rows(), n);
+    EXPECT_EQ(P.columns(), m);
+    EXPECT_TRUE(approx_eq(mmult(A, mmult(P, A)), A, 1e-10));
+    EXPECT_TRUE(approx_eq(mmult(P, mmult(A, P)), P, 1e-10));
+    Tensor AP = mmult(A, P), PA = mmult(P, A);
+    EXPECT_TRUE(approx_eq(AP, adjoint(AP), 1e-10));
+    EXPECT_TRUE(approx_eq(PA, adjoint(PA), 1e-10));
+
+    Tensor b = Tensor::random(m);
+    Tensor x = pinv.solve(b);
+    EXPECT_EQ(x.rank(), 1);
+    EXPECT_EQ(x.size(), n);
+    EXPECT_TRUE(approx_eq(x, mmult(P, b), 1e-10));
+    EXPECT_TRUE(approx_eq(x, solve_with_svd(A, b, 1e-10), 1e-10));
+
+    Tensor B = Tensor::random(m, 3), X(n, 3);
+    const typename Tensor::elt_t *p = X.begin_const();
+    pinv.solve(B, &X);
+    EXPECT_EQ(p, X.begin_const());
+    EXPECT_TRUE(approx_eq(X, mmult(P, B), 1e-10));
+
+    PseudoInverse<Tensor> zero(Tensor::zeros(m, n));
+    EXPECT_EQ(zero.rank(), 0);
+    EXPECT_TRUE(all_equal(zero.solve(B), Tensor::zeros(n, 3)));
+  }
+
   //////////////////////////////////////////////////////////////////////
   // REAL SPECIALIZATIONS
   //
@@ -79,6 +241,36 @@ namespace tensor_test {
     test_over_integers(1, 22, test_solve_unitary<RTensor>);
   }
 
+  TEST(RSolve, LU) {
+    test_over_integers(0, 22, test_factorization<RTensor,LU<RTensor>,0>);
+    test_factorization_rcond<RTensor,LU<RTensor> >();
+    test_factorization_failure<RTensor,LU<RTensor> >();
+  }
+
+  TEST(RSolve, Cholesky) {
+    test_over_integers(0, 22, test_factorization<RTensor,Cholesky<RTensor>,1>);
+    test_factorization_rcond<RTensor,Cholesky<RTensor> >();
+    test_factorization_failure<RTensor,Cholesky<RTensor> >();
+  }
+
+  TEST(RSolve, LDLT) {
+    test_over_integers(0, 22, test_factorization<RTensor,LDLT<RTensor>,2>);
+    test_factorization_rcond<RTensor,LDLT<RTensor> >();
+    test_factorization_failure<RTensor,LDLT<RTensor> >();
+  }
+
+  TEST(RSolve, Algorithm) {
+    test_over_integers(0, 22, test_solve_algorithm<RTensor>);
+  }
+
+  TEST(RSolve, Refined) {
+    test_over_integers(0, 40, test_solve_refined<RTensor>);
+  }
+
+  TEST(RSolve, PseudoInverse) {
+    test_over_integers(0, 22, test_pseudo_inverse<RTensor>);
+  }
+
   //////////////////////////////////////////////////////////////////////
   // COMPLEX SPECIALIZATIONS
   //
@@ -95,4 +287,34 @@ namespace tensor_test {
     test_over_integers(1, 22, test_solve_unitary<CTensor>);
   }
 
+  TEST(CSolve, LU) {
+    test_over_integers(0, 22, test_factorization<CTensor,LU<CTensor>,0>);
+    test_factorization_rcond<CTensor,LU<CTensor> >();
+    test_factorization_failure<CTensor,LU<CTensor> >();
+  }
+
+  TEST(CSolve, Cholesky) {
+    test_over_integers(0, 22, test_factorization<CTensor,Cholesky<CTensor>,1>);
+    test_factorization_rcond<CTensor,Cholesky<CTensor> >();
+    test_factorization_failure<CTensor,Cholesky<CTensor> >();
+  }
+
+  TEST(CSolve, LDLT) {
+    test_over_integers(0, 22, test_factorization<CTensor,LDLT<CTensor>,2>);
+    test_factorization_rcond<CTensor,LDLT<CTensor> >();
+    test_factorization_failure<CTensor,LDLT<CTensor> >();
+  }
+
+  TEST(CSolve, Algorithm) {
+    test_over_integers(0, 22, test_solve_algorithm<CTensor>);
+  }
+
+  TEST(CSolve, Refined) {
+    test_over_integers(0, 40, test_solve_refined<CTensor>);
+  }
+
+  TEST(CSolve, PseudoInverse) {
+    test_over_integers(0, 22, test_pseudo_inverse<CTensor>);
+  }
+
 } // namespace linalg_test
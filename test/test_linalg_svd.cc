@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <limits>
 #include "loops.h"
 #include <gtest/gtest.h>
 #include <tensor/tensor.h>
@@ -121,6 +122,123 @@ namespace tensor_test {
     }
   }
 
+  template<typename elt_t, linalg::SVDAlgorithm algorithm>
+  void test_algorithm_svd(int n) {
+    linalg::SVDAlgorithm old = linalg::svd_algorithm;
+    linalg::svd_algorithm = algorithm;
+    test_random_svd<elt_t,false>(n);
+    linalg::svd_algorithm = old;
+  }
+
+  /*
+   * The truncated decomposition agrees with the leading singular triplets
+   * of the full one, for every LAPACK driver.
+   */
+  template<typename elt_t, linalg::SVDAlgorithm algorithm>
+  void test_truncated_svd(int n) {
+    if (n == 0) {
+      return;
+    }
+    linalg::SVDAlgorithm old = linalg::svd_algorithm;
+    linalg::svd_algorithm = algorithm;
+    for (int m = 1; m < 2*n; m += 3) {
+      Tensor<double> true_s;
+      Tensor<elt_t> A = random_svd_matrix<elt_t>(m,n,true_s);
+      std::sort(true_s.begin(), true_s.end(), std::greater<double>());
+      int k = std::min(m, n);
+      for (int r = 1; r <= k; r++) {
+        Tensor<elt_t> U, Vt;
+        RTensor s = linalg::svd(A, r, 0.0, &U, &Vt);
+        EXPECT_EQ(r, s.size());
+        EXPECT_TRUE(approx_eq(s, RTensor(true_s(range(0, r-1)))));
+        EXPECT_EQ(U.rows(), m);
+        EXPECT_EQ(U.columns(), r);
+        EXPECT_EQ(Vt.rows(), r);
+        EXPECT_EQ(Vt.columns(), n);
+        EXPECT_TRUE(unitaryp(U,1e-10));
+        EXPECT_TRUE(unitaryp(Vt,1e-10));
+        /* A - U S V is orthogonal to the kept singular vectors */
+        Tensor<elt_t> R = A - mmult(U, mmult(diag(s), Vt));
+        EXPECT_TRUE(approx_eq(mmult(adjoint(U), R),
+                              Tensor<elt_t>::zeros(r, n), 1e-10));
+        EXPECT_TRUE(approx_eq(linalg::svd(A, r, 0.0), s));
+      }
+    }
+    linalg::svd_algorithm = old;
+  }
+
+  template<typename elt_t>
+  void test_tolerance_svd() {
+    RTensor s(igen << 5, rgen << 1.0 << 0.5 << 1e-3 << 1e-8 << 1e-12);
+    Tensor<elt_t> U = random_unitary<elt_t>(5);
+    Tensor<elt_t> V = random_unitary<elt_t>(7);
+    Tensor<elt_t> A = mmult(U, mmult(diag(s, 0, 5, 7), V));
+    EXPECT_EQ(3, linalg::svd(A, 0, 1e-6).size());
+    EXPECT_EQ(2, linalg::svd(A, 2, 1e-6).size());
+    EXPECT_EQ(5, linalg::svd(A, 0, 1e-14).size());
+    EXPECT_EQ(1, linalg::svd(A, 0, 2.0).size());
+  }
+
+  /* The random number generator of the library, in the form that
+   * std::shuffle() expects. */
+  struct shuffle_generator {
+    typedef unsigned int result_type;
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() {
+      return std::numeric_limits<result_type>::max();
+    }
+    result_type operator()() { return tensor::rand<unsigned int>(); }
+  };
+
+  /*
+   * A block diagonal matrix with 'n' blocks of different shapes, an empty
+   * row and two empty columns, with rows and columns shuffled. The blocks
+   * are found and the decomposition is complete also for the sparse form.
+   */
+  template<typename elt_t>
+  void test_block_diagonal_svd(int n) {
+    if (n == 0) {
+      return;
+    }
+    tensor::index rows = 1, cols = 2;
+    for (int b = 0; b < n; b++) {
+      rows += 1 + (b % 3);
+      cols += 1 + ((b + 1) % 3);
+    }
+    Tensor<elt_t> A0 = Tensor<elt_t>::zeros(rows, cols);
+    for (tensor::index b = 0, r = 0, c = 0; b < n; b++) {
+      tensor::index nr = 1 + (b % 3), nc = 1 + ((b + 1) % 3);
+      Tensor<elt_t> block(nr, nc);
+      block.randomize();
+      A0.at(range(r, r + nr - 1), range(c, c + nc - 1)) = block;
+      r += nr;
+      c += nc;
+    }
+    Indices prow = iota(0, rows - 1), pcol = iota(0, cols - 1);
+    shuffle_generator generator;
+    std::shuffle(prow.begin(), prow.end(), generator);
+    std::shuffle(pcol.begin(), pcol.end(), generator);
+    Tensor<elt_t> A = A0(range(prow), range(pcol));
+    RTensor s0 = linalg::svd(A);
+
+    for (int sparse = 0; sparse < 2; sparse++) {
+      for (int economic = 0; economic < 2; economic++) {
+        Tensor<elt_t> U, Vt;
+        RTensor s = sparse?
+          linalg::block_svd(Sparse<elt_t>(A), &U, &Vt, economic) :
+          linalg::block_svd(A, &U, &Vt, economic);
+        EXPECT_TRUE(approx_eq(s, s0));
+        EXPECT_TRUE(unitaryp(U, 1e-10));
+        EXPECT_TRUE(unitaryp(Vt, 1e-10));
+        tensor::index k = s.size();
+        Tensor<elt_t> S = economic? diag(s) : diag(s, 0, rows, cols);
+        EXPECT_TRUE(approx_eq(A, mmult(U, mmult(S, Vt))));
+        EXPECT_EQ(U.columns(), economic? k : rows);
+        EXPECT_EQ(Vt.rows(), economic? k : cols);
+      }
+    }
+  }
+
   //////////////////////////////////////////////////////////////////////
   // REAL SPECIALIZATIONS
   //
@@ -133,6 +251,20 @@ namespace tensor_test {
     test_over_integers(0, 32, test_random_svd<double,false>);
   }
 
+  TEST(RMatrixTest, RandomGesvdTest) {
+    test_over_integers(0, 32, test_algorithm_svd<double,linalg::SVD_GESVD>);
+  }
+
+  TEST(RMatrixTest, TruncatedSvdTest) {
+    test_over_integers(0, 12, test_truncated_svd<double,linalg::SVD_GESVD>);
+    test_over_integers(0, 12, test_truncated_svd<double,linalg::SVD_GESDD>);
+    test_over_integers(0, 12, test_truncated_svd<double,linalg::SVD_GESVDX>);
+  }
+
+  TEST(RMatrixTest, TruncatedSvdToleranceTest) {
+    test_tolerance_svd<double>();
+  }
+
   TEST(RMatrixTest, EyeBlockSvdTest) {
     test_over_integers(0, 32, test_eye_svd<double,true>);
   }
@@ -141,6 +273,10 @@ namespace tensor_test {
     test_over_integers(0, 32, test_random_svd<double,true>);
   }
 
+  TEST(RMatrixTest, BlockDiagonalSvdTest) {
+    test_over_integers(0, 12, test_block_diagonal_svd<double>);
+  }
+
   //////////////////////////////////////////////////////////////////////
   // COMPLEX SPECIALIZATIONS
   //
@@ -153,6 +289,20 @@ namespace tensor_test {
     test_over_integers(0, 32, test_random_svd<cdouble,false>);
   }
 
+  TEST(CMatrixTest, RandomGesvdTest) {
+    test_over_integers(0, 32, test_algorithm_svd<cdouble,linalg::SVD_GESVD>);
+  }
+
+  TEST(CMatrixTest, TruncatedSvdTest) {
+    test_over_integers(0, 12, test_truncated_svd<cdouble,linalg::SVD_GESVD>);
+    test_over_integers(0, 12, test_truncated_svd<cdouble,linalg::SVD_GESDD>);
+    test_over_integers(0, 12, test_truncated_svd<cdouble,linalg::SVD_GESVDX>);
+  }
+
+  TEST(CMatrixTest, TruncatedSvdToleranceTest) {
+    test_tolerance_svd<cdouble>();
+  }
+
   TEST(CMatrixTest, EyeBlockSvdTest) {
     test_over_integers(0, 32, test_eye_svd<cdouble,true>);
   }
@@ -161,4 +311,8 @@ namespace tensor_test {
     test_over_integers(0, 32, test_random_svd<cdouble,true>);
   }
 
+  TEST(CMatrixTest, BlockDiagonalSvdTest) {
+    test_over_integers(0, 12, test_block_diagonal_svd<cdouble>);
+  }
+
 } // namespace linalg_test
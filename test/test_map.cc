@@ -0,0 +1,136 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include "loops.h"
+#include <gtest/gtest.h>
+#include <tensor/tensor.h>
+#include <tensor/sparse.h>
+#include <tensor/map.h>
+
+namespace tensor_test {
+
+  using namespace tensor;
+
+  //////////////////////////////////////////////////////////////////////
+  // APPLYING A MAP INTO AN EXISTING TENSOR
+  //
+
+  template<class Matrix, class Tensor>
+  void test_map_apply_into(const Matrix &A, const Tensor &x, bool transpose)
+  {
+    MatrixMap<Matrix> map(A, transpose);
+    Tensor y = map(x);
+    /* An output of the right size is reused */
+    Tensor output = Tensor::zeros(y.dimensions());
+    const typename Tensor::elt_t *p = output.begin_const();
+    map.apply_into(x, output);
+    EXPECT_EQ(p, output.begin_const());
+    EXPECT_TRUE(approx_eq(y, output));
+    /* An empty output is allocated */
+    Tensor empty;
+    map.apply_into(x, empty);
+    EXPECT_TRUE(approx_eq(y, empty));
+  }
+
+  template<typename elt_t>
+  void test_map_apply_into_matrix(int n) {
+    Tensor<elt_t> A = Tensor<elt_t>::random(n, n+1);
+    test_map_apply_into(A, Tensor<elt_t>(Tensor<elt_t>::random(n+1)), false);
+    test_map_apply_into(A, Tensor<elt_t>(Tensor<elt_t>::random(n+1, 3)), false);
+    test_map_apply_into(A, Tensor<elt_t>(Tensor<elt_t>::random(n)), true);
+    test_map_apply_into(A, Tensor<elt_t>(Tensor<elt_t>::random(2, n)), true);
+  }
+
+  template<typename elt_t>
+  void test_map_apply_into_sparse(int n) {
+    Sparse<elt_t> A = Sparse<elt_t>::random(n, n+1);
+    test_map_apply_into(A, Tensor<elt_t>(Tensor<elt_t>::random(n+1)), false);
+    test_map_apply_into(A, Tensor<elt_t>(Tensor<elt_t>::random(n+1, 3)), false);
+    test_map_apply_into(A, Tensor<elt_t>(Tensor<elt_t>::random(2, n)), true);
+  }
+
+  template<typename elt_t>
+  void test_map_apply_into_sym_sparse(int n) {
+    Sparse<elt_t> A = Sparse<elt_t>::random(n, n);
+    SymSparse<elt_t> S(A + adjoint(A));
+    test_map_apply_into(S, Tensor<elt_t>(Tensor<elt_t>::random(n)), false);
+    test_map_apply_into(S, Tensor<elt_t>(Tensor<elt_t>::random(n, 2)), false);
+    test_map_apply_into(S, Tensor<elt_t>(Tensor<elt_t>::random(3, n)), true);
+  }
+
+  /* Applying the map over raw vectors writes directly into them. */
+  template<typename elt_t>
+  void test_map_apply_raw(int n) {
+    Tensor<elt_t> A = Tensor<elt_t>::random(n, n);
+    Tensor<elt_t> x = Tensor<elt_t>::random(n);
+    Tensor<elt_t> y = mmult(A, x);
+    MatrixMap<Tensor<elt_t> > map(A);
+    Tensor<elt_t> output = Tensor<elt_t>::zeros(igen << n);
+    map.apply(n, x.begin_const(), output.begin());
+    EXPECT_TRUE(approx_eq(y, output));
+    /* The generic fallback, which allocates, gives the same result */
+    typedef const Tensor<elt_t> (*f_ptr)(const Tensor<elt_t> &);
+    f_ptr f = conj;
+    FunctionMap<f_ptr, Tensor<elt_t> > fmap(f);
+    output = Tensor<elt_t>::zeros(igen << n);
+    fmap.apply(n, x.begin_const(), output.begin());
+    EXPECT_TRUE(approx_eq(conj(x), output));
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // REAL SPECIALIZATIONS
+  //
+
+  TEST(RMap, ApplyIntoMatrix) {
+    test_over_integers(1, 20, test_map_apply_into_matrix<double>);
+  }
+
+  TEST(RMap, ApplyIntoSparse) {
+    test_over_integers(1, 20, test_map_apply_into_sparse<double>);
+  }
+
+  TEST(RMap, ApplyIntoSymSparse) {
+    test_over_integers(1, 20, test_map_apply_into_sym_sparse<double>);
+  }
+
+  TEST(RMap, ApplyRaw) {
+    test_over_integers(1, 20, test_map_apply_raw<double>);
+  }
+
+  //////////////////////////////////////////////////////////////////////
+  // COMPLEX SPECIALIZATIONS
+  //
+
+  TEST(CMap, ApplyIntoMatrix) {
+    test_over_integers(1, 20, test_map_apply_into_matrix<cdouble>);
+  }
+
+  TEST(CMap, ApplyIntoSparse) {
+    test_over_integers(1, 20, test_map_apply_into_sparse<cdouble>);
+  }
+
+  TEST(CMap, ApplyIntoSymSparse) {
+    test_over_integers(1, 20, test_map_apply_into_sym_sparse<cdouble>);
+  }
+
+  TEST(CMap, ApplyRaw) {
+    test_over_integers(1, 20, test_map_apply_raw<cdouble>);
+  }
+
+} // namespace tensor_test
@@ -354,6 +354,33 @@ namespace tensor_test {
     test_over_fixed_rank_tensors<cdouble>(test_full<cdouble>, 2, 7);
   }
 
+  //
+  // SPARSE <-> FULL CONVERSION WITH A THRESHOLD
+  //
+  template<typename elt_t>
+  void test_full_threshold(tensor::index rows, tensor::index cols) {
+    Tensor<elt_t> t = Tensor<elt_t>::random(rows, cols);
+    Tensor<elt_t> d = t;
+    for (tensor::index i = 0; i < d.size(); i++) {
+      if (abs(d[i]) <= 0.5) d.at(i) = number_zero<elt_t>();
+    }
+    Sparse<elt_t> s(t, 0.5);
+    EXPECT_TRUE(all_equal(d, full(s)));
+    EXPECT_TRUE(all_equal(s, Sparse<elt_t>(d)));
+  }
+
+  TEST(RSparseTest, RSparseFullThreshold) {
+    test_full_threshold<double>(7, 5);
+    // Large enough for the parallel conversion
+    test_full_threshold<double>(400, 300);
+  }
+
+  TEST(CSparseTest, CSparseFullThreshold) {
+    test_full_threshold<cdouble>(7, 5);
+    // Large enough for the parallel conversion
+    test_full_threshold<cdouble>(400, 300);
+  }
+
   //
   // SPARSE -> COMPLEX CONVERSION, ARBITRARY SIZES
   //
@@ -0,0 +1,106 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <tensor/sparse.h>
+#include "loops.h"
+#include <gtest/gtest.h>
+
+namespace tensor_test {
+
+  //
+  // INSERTION WITH REPEATED ELEMENTS
+  //
+  template<typename elt_t>
+  void test_sparse_builder(Tensor<elt_t> &t) {
+    tensor::index rows = t.rows(), cols = t.columns();
+    for (int nbuffers = 1; nbuffers <= 3; nbuffers++) {
+      SparseBuilder<elt_t> builder(rows, cols, nbuffers);
+      Tensor<elt_t> D = Tensor<elt_t>::zeros(rows, cols);
+      tensor::index n = rows? 3 * t.size() : 0;
+      for (tensor::index i = 0; i < n; i++) {
+        tensor::index r = rand<int>(0, rows);
+        tensor::index c = rand<int>(0, cols);
+        // Small integers, so that sums are exact in any order
+        elt_t v = number_one<elt_t>() * (double)rand<int>(-2, 3);
+        builder.add(r, c, v, i % nbuffers);
+        D.at(r, c) += v;
+      }
+      EXPECT_EQ(n, builder.length());
+      Sparse<elt_t> S = builder.build();
+      EXPECT_TRUE(all_equal(S, D));
+      EXPECT_TRUE(all_equal(S, Sparse<elt_t>(D)));
+    }
+  }
+
+  template<typename elt_t>
+  void test_sparse_builder_cancel() {
+    SparseBuilder<elt_t> builder(3, 4);
+    builder.add(1, 2, number_one<elt_t>());
+    builder.add(2, 3, number_one<elt_t>());
+    builder.add(1, 2, -number_one<elt_t>());
+    builder.add(0, 0, number_zero<elt_t>());
+    Sparse<elt_t> S = builder.build();
+    EXPECT_EQ(1, S.length());
+    EXPECT_TRUE(all_equal(igen << 0 << 0 << 0 << 1, S.priv_row_start()));
+    EXPECT_TRUE(all_equal(igen << 3, S.priv_column()));
+    builder.clear();
+    EXPECT_EQ(0, builder.length());
+    EXPECT_TRUE(all_equal(builder.build(), Sparse<elt_t>(3, 4)));
+  }
+
+  template<typename elt_t>
+  void test_sparse_triplets_sum() {
+    Indices rows = igen << 0 << 2 << 0 << 1;
+    Indices cols = igen << 1 << 0 << 1 << 1;
+    Tensor<elt_t> data(gen<elt_t>(number_one<elt_t>()) << 2.0 << 3.0 << 4.0);
+    Sparse<elt_t> S(rows, cols, data);
+    EXPECT_EQ(3, S.rows());
+    EXPECT_EQ(2, S.columns());
+    Tensor<elt_t> D = Tensor<elt_t>::zeros(3, 2);
+    D.at(0, 1) = 4.0;
+    D.at(1, 1) = 4.0;
+    D.at(2, 0) = 2.0;
+    EXPECT_TRUE(all_equal(S, D));
+  }
+
+  TEST(RSparseBuilderTest, Build) {
+    test_over_fixed_rank_tensors<double>(test_sparse_builder<double>, 2, 6);
+  }
+
+  TEST(CSparseBuilderTest, Build) {
+    test_over_fixed_rank_tensors<cdouble>(test_sparse_builder<cdouble>, 2, 6);
+  }
+
+  TEST(RSparseBuilderTest, Cancel) {
+    test_sparse_builder_cancel<double>();
+  }
+
+  TEST(CSparseBuilderTest, Cancel) {
+    test_sparse_builder_cancel<cdouble>();
+  }
+
+  TEST(RSparseBuilderTest, TripletsSum) {
+    test_sparse_triplets_sum<double>();
+  }
+
+  TEST(CSparseBuilderTest, TripletsSum) {
+    test_sparse_triplets_sum<cdouble>();
+  }
+
+} // namespace tensor_test
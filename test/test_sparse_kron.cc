@@ -103,6 +103,54 @@ namespace tensor_test {
     test_over_fixed_rank_pairs<cdouble>(test_tensor_kron<cdouble>, 2);
   }
 
+  //
+  // PRODUCTS OF SEVERAL FACTORS
+  //
+
+  template<typename elt_t>
+  void test_kron_multi(Tensor<elt_t> &a, Tensor<elt_t> &b)
+  {
+    Sparse<elt_t> sa = Sparse<elt_t>::random(a.rows(), a.columns(), 0.5);
+    Sparse<elt_t> sb = Sparse<elt_t>::random(b.rows(), b.columns(), 0.5);
+    Sparse<elt_t> sc = Sparse<elt_t>::random(b.columns()+1, a.rows()+1, 0.5);
+    std::vector<Sparse<elt_t> > factors;
+    factors.push_back(sa);
+    ASSERT_TRUE(all_equal(kron(factors), sa));
+    factors.push_back(sb);
+    ASSERT_TRUE(all_equal(kron(factors), kron(sa, sb)));
+    factors.push_back(sc);
+    Sparse<elt_t> sk = kron(kron(sa, sb), sc);
+    ASSERT_TRUE(all_equal(kron(sa, sb, sc), sk));
+    ASSERT_TRUE(all_equal(kron(factors), sk));
+    ASSERT_TRUE(approx_eq(full(kron(sa, kron(sb, sc))), full(sk)));
+  }
+
+  TEST(RSparseKronTest, KronMulti) {
+    test_over_fixed_rank_pairs<double>(test_kron_multi<double>, 2);
+  }
+
+  TEST(CSparseKronTest, KronMulti) {
+    test_over_fixed_rank_pairs<cdouble>(test_kron_multi<cdouble>, 2);
+  }
+
+  template<typename elt_t>
+  void test_kron_large()
+  {
+    // Large enough to be built in parallel
+    Sparse<elt_t> sa = Sparse<elt_t>::random(30, 25, 0.9);
+    Sparse<elt_t> sb = Sparse<elt_t>::random(20, 35, 0.9);
+    ASSERT_TRUE(sa.length() * sb.length() > 65536);
+    ASSERT_TRUE(all_equal(kron(full(sa), full(sb)), full(kron(sa, sb))));
+  }
+
+  TEST(RSparseKronTest, KronLarge) {
+    test_kron_large<double>();
+  }
+
+  TEST(CSparseKronTest, KronLarge) {
+    test_kron_large<cdouble>();
+  }
+
 
 
 } // namespace tensor_test
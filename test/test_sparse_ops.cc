@@ -105,4 +105,88 @@ namespace tensor_test {
     test_over_fixed_rank_tensors<cdouble>(test_sparse_binop_random<cdouble>, 2, 7);
   }
 
+  template<typename elt_t>
+  void test_sparse_axpy(Tensor<elt_t> &t) {
+    tensor::index rows = t.rows(), cols = t.columns();
+    elt_t alpha = number_one<elt_t>() * 2.0;
+    for (int i = 0; i < rows*cols; i++) {
+      {
+        // Different sparsity patterns
+        Sparse<elt_t> A = Sparse<elt_t>::random(rows, cols);
+        Sparse<elt_t> B = Sparse<elt_t>::random(rows, cols);
+        Sparse<elt_t> C = A;
+        sparse_axpy_inplace(C, alpha, B);
+        EXPECT_TRUE(all_equal(C, A + alpha * B));
+      }
+      {
+        // Pattern of B contained in that of A, and cancellations
+        Sparse<elt_t> B = Sparse<elt_t>::random(rows, cols);
+        Sparse<elt_t> A = B + Sparse<elt_t>::random(rows, cols);
+        Sparse<elt_t> C = A;
+        sparse_axpy_inplace(C, alpha, B);
+        EXPECT_TRUE(all_equal(C, A + alpha * B));
+        sparse_axpy_inplace(C, -number_one<elt_t>(), C);
+        EXPECT_EQ(0, C.length());
+        EXPECT_TRUE(all_equal(C, Sparse<elt_t>(rows, cols)));
+      }
+    }
+  }
+
+  TEST(RSparseTest, AxpyInplace) {
+    test_over_fixed_rank_tensors<double>(test_sparse_axpy<double>, 2, 7);
+  }
+
+  TEST(CSparseTest, AxpyInplace) {
+    test_over_fixed_rank_tensors<cdouble>(test_sparse_axpy<cdouble>, 2, 7);
+  }
+
+  template<typename elt_t>
+  void test_sparse_sum(Tensor<elt_t> &t) {
+    tensor::index rows = t.rows(), cols = t.columns();
+    for (int n = 0; n < 6; n++) {
+      std::vector<Sparse<elt_t> > terms;
+      Tensor<elt_t> weights(n);
+      Sparse<elt_t> sum(rows, cols), combination(rows, cols);
+      for (int i = 0; i < n; i++) {
+        terms.push_back(Sparse<elt_t>::random(rows, cols));
+        weights.at(i) = number_one<elt_t>() * (double)(i + 1);
+        sum = sum + terms[i];
+        combination = combination + weights[i] * terms[i];
+      }
+      if (n) {
+        EXPECT_TRUE(approx_eq(full(sparse_sum(terms)), full(sum)));
+        EXPECT_TRUE(approx_eq(full(sparse_sum(terms, weights)),
+                              full(combination)));
+      } else {
+        EXPECT_TRUE(sparse_sum(terms).is_empty());
+      }
+    }
+    // Exact cancellation removes the elements
+    Sparse<elt_t> A = Sparse<elt_t>::random(rows, cols);
+    std::vector<Sparse<elt_t> > terms;
+    terms.push_back(A);
+    terms.push_back(-A);
+    EXPECT_EQ(0, sparse_sum(terms).length());
+    // Terms with one element each, which leave most of their rows empty
+    terms.clear();
+    Tensor<elt_t> dense = Tensor<elt_t>::zeros(rows, cols);
+    for (tensor::index i = 0; cols && i < rows; i += 2) {
+      Tensor<elt_t> one = Tensor<elt_t>::zeros(rows, cols);
+      one.at(i, (3 * i) % cols) = number_one<elt_t>() * (double)(i + 1);
+      dense += one;
+      terms.push_back(Sparse<elt_t>(one));
+    }
+    if (terms.size()) {
+      EXPECT_TRUE(all_equal(full(sparse_sum(terms)), dense));
+    }
+  }
+
+  TEST(RSparseTest, Sum) {
+    test_over_fixed_rank_tensors<double>(test_sparse_sum<double>, 2, 7);
+  }
+
+  TEST(CSparseTest, Sum) {
+    test_over_fixed_rank_tensors<cdouble>(test_sparse_sum<cdouble>, 2, 7);
+  }
+
 } // namespace test
@@ -0,0 +1,151 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <tensor/sparse.h>
+#include "loops.h"
+#include <gtest/gtest.h>
+
+namespace tensor_test {
+
+  /* Random list of 'n' indices in [0,max), possibly repeated. */
+  static Indices random_indices(tensor::index n, tensor::index max) {
+    Indices output(n);
+    for (tensor::index i = 0; i < n; i++)
+      output.at(i) = rand<int>(0, max);
+    return output;
+  }
+
+  /* Random permutation of [0,n). */
+  static Indices random_order(tensor::index n) {
+    Indices output = iota(0, n-1);
+    for (tensor::index i = n-1; i > 0; i--)
+      std::swap(output.at(i), output.at(rand<int>(0, i+1)));
+    return output;
+  }
+
+  template<typename elt_t>
+  static Tensor<elt_t> full_submatrix(const Tensor<elt_t> &t, const Indices &rows,
+                                      const Indices &cols) {
+    Tensor<elt_t> output(rows.size(), cols.size());
+    for (tensor::index i = 0; i < rows.size(); i++)
+      for (tensor::index j = 0; j < cols.size(); j++)
+        output.at(i, j) = t(rows[i], cols[j]);
+    return output;
+  }
+
+  //
+  // ELEMENT ACCESS
+  //
+  template<typename elt_t>
+  void test_sparse_access(Tensor<elt_t> &t) {
+    Sparse<elt_t> S = Sparse<elt_t>::random(t.rows(), t.columns());
+    Tensor<elt_t> T = full(S);
+    for (tensor::index i = 0; i < t.rows(); i++)
+      for (tensor::index j = 0; j < t.columns(); j++)
+        EXPECT_EQ(T(i, j), S(i, j));
+  }
+
+  TEST(RSparseSliceTest, Access) {
+    test_over_fixed_rank_tensors<double>(test_sparse_access<double>, 2, 7);
+  }
+
+  TEST(CSparseSliceTest, Access) {
+    test_over_fixed_rank_tensors<cdouble>(test_sparse_access<cdouble>, 2, 7);
+  }
+
+  //
+  // ARBITRARY SUBMATRICES
+  //
+  template<typename elt_t>
+  void test_sparse_submatrix(Tensor<elt_t> &t) {
+    tensor::index rows = t.rows(), cols = t.columns();
+    if (!rows || !cols) return;
+    for (int times = 0; times < 10; times++) {
+      Sparse<elt_t> S = Sparse<elt_t>::random(rows, cols, 0.5);
+      Tensor<elt_t> T = full(S);
+      Indices r = random_indices(rand<int>(0, 2*rows), rows);
+      Indices c = random_indices(rand<int>(0, 2*cols), cols);
+      Sparse<elt_t> sub = S.submatrix(r, c);
+      EXPECT_TRUE(all_equal(sub, Sparse<elt_t>(full_submatrix(T, r, c))));
+      c = iota(0, cols-1);
+      sub = S.submatrix(r, c);
+      EXPECT_TRUE(all_equal(sub, Sparse<elt_t>(full_submatrix(T, r, c))));
+    }
+  }
+
+  TEST(RSparseSliceTest, Submatrix) {
+    test_over_fixed_rank_tensors<double>(test_sparse_submatrix<double>, 2, 7);
+  }
+
+  TEST(CSparseSliceTest, Submatrix) {
+    test_over_fixed_rank_tensors<cdouble>(test_sparse_submatrix<cdouble>, 2, 7);
+  }
+
+  //
+  // ROW RANGES AND COLUMN PERMUTATIONS
+  //
+  template<typename elt_t>
+  void test_sparse_row_range(Tensor<elt_t> &t) {
+    tensor::index rows = t.rows(), cols = t.columns();
+    Sparse<elt_t> S = Sparse<elt_t>::random(rows, cols, 0.5);
+    Tensor<elt_t> T = full(S);
+    for (tensor::index first = 0; first <= rows; first++) {
+      for (tensor::index last = first-1; last < rows; last++) {
+        Indices r = (last < first)? Indices() : iota(first, last);
+        Indices c = cols? iota(0, cols-1) : Indices();
+        Sparse<elt_t> sub = S.row_range(first, last);
+        EXPECT_TRUE(all_equal(sub, Sparse<elt_t>(full_submatrix(T, r, c))));
+      }
+    }
+  }
+
+  TEST(RSparseSliceTest, RowRange) {
+    test_over_fixed_rank_tensors<double>(test_sparse_row_range<double>, 2, 7);
+  }
+
+  TEST(CSparseSliceTest, RowRange) {
+    test_over_fixed_rank_tensors<cdouble>(test_sparse_row_range<cdouble>, 2, 7);
+  }
+
+  template<typename elt_t>
+  void test_sparse_permute_columns(Tensor<elt_t> &t) {
+    tensor::index rows = t.rows(), cols = t.columns();
+    Sparse<elt_t> S = Sparse<elt_t>::random(rows, cols, 0.5);
+    Tensor<elt_t> T = full(S);
+    Indices p = random_order(cols);
+    Indices r = rows? iota(0, rows-1) : Indices();
+    Sparse<elt_t> P = S.permute_columns(p);
+    EXPECT_TRUE(all_equal(P, Sparse<elt_t>(full_submatrix(T, r, p))));
+  }
+
+  TEST(RSparseSliceTest, PermuteColumns) {
+    test_over_fixed_rank_tensors<double>(test_sparse_permute_columns<double>, 2, 7);
+  }
+
+  TEST(CSparseSliceTest, PermuteColumns) {
+    test_over_fixed_rank_tensors<cdouble>(test_sparse_permute_columns<cdouble>, 2, 7);
+  }
+
+  TEST(RSparseSliceTest, PermuteColumnsError) {
+    RSparse S = RSparse::random(3, 3);
+    ASSERT_DEATH(S.permute_columns(igen << 0 << 1 << 1), ".*");
+    ASSERT_DEATH(S.permute_columns(igen << 0 << 1), ".*");
+  }
+
+} // namespace tensor_test
@@ -0,0 +1,106 @@
+// -*- mode: c++; fill-column: 80; c-basic-offset: 2; indent-tabs-mode: nil -*-
+/*
+    Copyright (c) 2010 Juan Jose Garcia Ripoll
+
+    Tensor is free software; you can redistribute it and/or modify it
+    under the terms of the GNU Library General Public License as published
+    by the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU Library General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+*/
+
+#include <tensor/tensor.h>
+#include <tensor/sparse.h>
+#include "loops.h"
+#include <gtest/gtest.h>
+
+namespace tensor_test {
+
+  using namespace tensor;
+
+  template<typename elt_t>
+  const Sparse<elt_t> random_hermitian(tensor::index n) {
+    Sparse<elt_t> A = Sparse<elt_t>::random(n, n);
+    return A + adjoint(A);
+  }
+
+  //
+  // FOLDING A SPARSE MATRIX
+  //
+  template<typename elt_t>
+  void test_sym_sparse_fold(Tensor<elt_t> &t) {
+    tensor::index n = t.rows();
+    Sparse<elt_t> A = random_hermitian<elt_t>(n);
+    SymSparse<elt_t> S(A);
+    EXPECT_EQ(n, S.rows());
+    EXPECT_EQ(n, S.columns());
+    EXPECT_EQ(n+1, S.priv_row_start().size());
+    EXPECT_TRUE(all_equal(full(S), full(A)));
+    // Only the upper triangle and the diagonal are stored
+    for (tensor::index r = 0; r < n; r++) {
+      for (tensor::index j = S.priv_row_start()[r];
+           j < S.priv_row_start()[r+1]; j++) {
+        EXPECT_LE(r, S.priv_column()[j]);
+      }
+    }
+    for (tensor::index r = 0; r < n; r++) {
+      for (tensor::index c = 0; c < n; c++) {
+        EXPECT_EQ(A(r,c), S(r,c));
+      }
+    }
+  }
+
+  TEST(RSymSparseTest, Fold) {
+    test_over_fixed_rank_tensors<double>(test_sym_sparse_fold<double>, 1, 9);
+  }
+
+  TEST(CSymSparseTest, Fold) {
+    test_over_fixed_rank_tensors<cdouble>(test_sym_sparse_fold<cdouble>, 1, 9);
+  }
+
+  TEST(RSymSparseTest, FoldNonSymmetric) {
+    RSparse A(RTensor(igen << 2 << 2, gen<double>(1.0) << 2.0 << 0.0 << 3.0));
+    ASSERT_DEATH(RSymSparse S(A), ".*");
+  }
+
+  TEST(CSymSparseTest, FoldNonHermitian) {
+    CTensor T(igen << 2 << 2, gen<cdouble>(1.0) << to_complex(0.0, 1.0)
+              << to_complex(0.0, 1.0) << 3.0);
+    ASSERT_DEATH(CSymSparse S((CSparse(T))), ".*");
+  }
+
+  //
+  // MULTIPLICATION WITH TENSORS
+  //
+  template<typename elt_t>
+  void test_sym_sparse_mmult(Tensor<elt_t> &t) {
+    tensor::index n = t.rows();
+    for (int i = 0; i < 4; i++) {
+      Sparse<elt_t> A = random_hermitian<elt_t>(n);
+      SymSparse<elt_t> S(A);
+      Tensor<elt_t> v = Tensor<elt_t>::random(n);
+      EXPECT_TRUE(approx_eq(mmult(S, v), mmult(A, v), 10*EPSILON));
+      Tensor<elt_t> M = Tensor<elt_t>::random(n, 3);
+      EXPECT_TRUE(approx_eq(mmult(S, M), mmult(A, M), 10*EPSILON));
+      M = Tensor<elt_t>::random(3, n);
+      EXPECT_TRUE(approx_eq(mmult(M, S), mmult(M, A), 10*EPSILON));
+    }
+  }
+
+  TEST(RSymSparseTest, Mmult) {
+    test_over_fixed_rank_tensors<double>(test_sym_sparse_mmult<double>, 1, 9);
+  }
+
+  TEST(CSymSparseTest, Mmult) {
+    test_over_fixed_rank_tensors<cdouble>(test_sym_sparse_mmult<cdouble>, 1, 9);
+  }
+
+} // namespace tensor_test